@@ -0,0 +1,235 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARK_HPP
+#define EL_BENCHMARK_HPP
+
+#include <El.hpp>
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+// A minimal harness shared by the benchmark drivers. Each kernel is run
+// collectively a number of times (after untimed warmup runs), with barriers
+// around each repetition, and its minimum, median, and maximum wall times
+// are recorded. The results are written as JSON (one record per line so that
+// they are easily diffed and grepped) and, if a baseline file from a previous
+// run is provided, each median time is compared against the baseline median
+// of the same name; the driver exits with a nonzero status if any kernel
+// slowed down by more than the given relative tolerance.
+namespace El {
+namespace bench {
+
+struct Options
+{
+    Int warmups=1;
+    Int repetitions=5;
+    string output;
+    string baseline;
+    double tolerance=0.1;
+
+    // Must be called before ProcessInput
+    void Read()
+    {
+        warmups = Input("--warmups","number of untimed runs per kernel",1);
+        repetitions = Input("--reps","number of timed runs per kernel",5);
+        output = Input("--output","JSON file for the results",string(""));
+        baseline =
+          Input("--baseline","JSON results to compare against",string(""));
+        tolerance =
+          Input("--tolerance","relative slowdown considered a regression",
+                0.1);
+    }
+};
+
+struct Result
+{
+    string name;
+    Int repetitions;
+    double minTime, medianTime, maxTime;
+    double flops, bytes;
+};
+
+class Suite
+{
+public:
+    Suite
+    ( const string& name, const Options& options,
+      mpi::Comm comm=mpi::COMM_WORLD )
+    : name_(name), options_(options), comm_(comm)
+    { }
+
+    const Options& Opts() const { return options_; }
+    mpi::Comm Comm() const { return comm_; }
+
+    // Time the collective 'kernel'; 'flops' and 'bytes' are the (global)
+    // number of floating-point operations and bytes moved per call and are
+    // only used to report rates.
+    void Run
+    ( const string& name, std::function<void()> kernel,
+      double flops=0, double bytes=0 )
+    { RunWithSetup( name, [](){}, kernel, flops, bytes ); }
+
+    // As above, but with an untimed 'setup' (e.g., restoring the input of an
+    // in-place factorization) before each call of 'kernel'
+    void RunWithSetup
+    ( const string& name,
+      std::function<void()> setup, std::function<void()> kernel,
+      double flops=0, double bytes=0 )
+    {
+        DEBUG_CSE
+        for( Int rep=0; rep<options_.warmups; ++rep )
+        {
+            setup();
+            kernel();
+        }
+
+        Timer timer;
+        vector<double> times;
+        for( Int rep=0; rep<options_.repetitions; ++rep )
+        {
+            setup();
+            mpi::Barrier( comm_ );
+            timer.Start();
+            kernel();
+            mpi::Barrier( comm_ );
+            times.push_back( timer.Stop() );
+        }
+        // Guard against clock differences by taking the slowest process
+        mpi::AllReduce( times.data(), times.size(), mpi::MAX, comm_ );
+        std::sort( times.begin(), times.end() );
+
+        Result result;
+        result.name = name;
+        result.repetitions = times.size();
+        result.minTime = ( times.empty() ? 0 : times.front() );
+        result.maxTime = ( times.empty() ? 0 : times.back() );
+        result.medianTime = ( times.empty() ? 0 : times[times.size()/2] );
+        result.flops = flops;
+        result.bytes = bytes;
+        results_.push_back( result );
+
+        if( mpi::Rank(comm_) == 0 )
+        {
+            Output
+            (name,": ",result.medianTime," seconds (min=",result.minTime,
+             ", max=",result.maxTime,")",
+             ( flops > 0 ?
+               BuildString(", ",flops/result.medianTime/1e9," GFlop/s") :
+               string("") ),
+             ( bytes > 0 ?
+               BuildString(", ",bytes/result.medianTime/1e9," GB/s") :
+               string("") ));
+        }
+    }
+
+    // Write the results and compare against the baseline (if one was given),
+    // returning the number of regressions
+    int Finish() const
+    {
+        DEBUG_CSE
+        int numRegressions = 0;
+        if( mpi::Rank(comm_) == 0 )
+        {
+            if( !options_.output.empty() )
+                Write( options_.output );
+            if( !options_.baseline.empty() )
+                numRegressions = Compare( options_.baseline );
+        }
+        mpi::Broadcast( numRegressions, 0, comm_ );
+        return numRegressions;
+    }
+
+private:
+    string name_;
+    Options options_;
+    mpi::Comm comm_;
+    vector<Result> results_;
+
+    void Write( const string& filename ) const
+    {
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file.precision( 9 );
+        file << "{\"suite\": \"" << name_ << "\", "
+             << "\"numProcesses\": " << mpi::Size(comm_) << ", "
+             << "\"results\": [\n";
+        for( size_t i=0; i<results_.size(); ++i )
+        {
+            const Result& r = results_[i];
+            file << "  {\"name\": \"" << r.name << "\", "
+                 << "\"reps\": " << r.repetitions << ", "
+                 << "\"min\": " << r.minTime << ", "
+                 << "\"median\": " << r.medianTime << ", "
+                 << "\"max\": " << r.maxTime << ", "
+                 << "\"flops\": " << r.flops << ", "
+                 << "\"bytes\": " << r.bytes << "}"
+                 << ( i+1 < results_.size() ? ",\n" : "\n" );
+        }
+        file << "]}\n";
+    }
+
+    // Parses the per-line records produced by Write
+    static std::map<string,double> ReadMedians( const string& filename )
+    {
+        std::ifstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        std::map<string,double> medians;
+        const string nameKey = "\"name\": \"", medianKey = "\"median\": ";
+        string line;
+        while( std::getline( file, line ) )
+        {
+            const auto nameBeg = line.find( nameKey );
+            const auto medianBeg = line.find( medianKey );
+            if( nameBeg == string::npos || medianBeg == string::npos )
+                continue;
+            const auto nameEnd = line.find( '"', nameBeg+nameKey.size() );
+            const string name =
+              line.substr
+              ( nameBeg+nameKey.size(), nameEnd-nameBeg-nameKey.size() );
+            std::istringstream is( line.substr(medianBeg+medianKey.size()) );
+            double median;
+            if( is >> median )
+                medians[name] = median;
+        }
+        return medians;
+    }
+
+    int Compare( const string& filename ) const
+    {
+        const auto baseline = ReadMedians( filename );
+        int numRegressions = 0;
+        for( const Result& r : results_ )
+        {
+            auto it = baseline.find( r.name );
+            if( it == baseline.end() || it->second <= 0 )
+                continue;
+            const double ratio = r.medianTime / it->second;
+            if( ratio > 1+options_.tolerance )
+            {
+                Output
+                ("REGRESSION: ",r.name," took ",r.medianTime,
+                 " seconds versus a baseline of ",it->second," (",ratio,
+                 "x)");
+                ++numRegressions;
+            }
+        }
+        Output
+        (numRegressions," regressions relative to ",filename,
+         " (tolerance=",options_.tolerance,")");
+        return numRegressions;
+    }
+};
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARK_HPP
@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Each process independently runs the sequential kernels on its own data, so
+// the reported rates are aggregated over all processes
+
+template<typename T>
+double FlopScale()
+{ return IsComplex<T>::value ? 4. : 1.; }
+
+template<typename T>
+void BenchmarkKernels( bench::Suite& suite, Int n )
+{
+    const string type = TypeName<T>();
+    const double numProcs = mpi::Size( suite.Comm() );
+    const double scale = numProcs*FlopScale<T>();
+    const double dn = n;
+
+    Matrix<T> A, B, C, L, X;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+
+    Uniform( L, n, n );
+    MakeTrapezoidal( LOWER, L );
+    ShiftDiagonal( L, T(n) );
+
+    const char orientChars[] = { 'N', 'T' };
+    for( const char orientCharA : orientChars )
+    {
+        for( const char orientCharB : orientChars )
+        {
+            const Orientation orientA = CharToOrientation( orientCharA );
+            const Orientation orientB = CharToOrientation( orientCharB );
+            suite.Run
+            ( BuildString
+              ("Gemm",orientCharA,orientCharB,"/",type,"/n=",n),
+              [&]() { Gemm( orientA, orientB, T(1), A, B, T(0), C ); },
+              scale*2*dn*dn*dn );
+        }
+    }
+
+    suite.Run
+    ( BuildString("Herk/",type,"/n=",n),
+      [&]() { Herk( LOWER, NORMAL, Base<T>(1), A, Base<T>(0), C ); },
+      scale*dn*dn*dn );
+
+    suite.RunWithSetup
+    ( BuildString("Trsm/",type,"/n=",n),
+      [&]() { X = B; },
+      [&]() { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, T(1), L, X ); },
+      scale*dn*dn*dn );
+
+    Matrix<T> x, y;
+    Uniform( x, n, 1 );
+    Zeros( y, n, 1 );
+    suite.Run
+    ( BuildString("Gemv/",type,"/n=",n),
+      [&]() { Gemv( NORMAL, T(1), A, x, T(0), y ); },
+      scale*2*dn*dn, numProcs*dn*dn*sizeof(T) );
+
+    suite.Run
+    ( BuildString("Axpy/",type,"/n=",n),
+      [&]() { Axpy( T(1), A, C ); },
+      scale*2*dn*dn, numProcs*3*dn*dn*sizeof(T) );
+
+    T dotResult;
+    suite.Run
+    ( BuildString("Dot/",type,"/n=",n),
+      [&]() { dotResult = Dot( A, B ); },
+      scale*2*dn*dn, numProcs*2*dn*dn*sizeof(T) );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",500);
+#if defined(EL_HAVE_QD) || defined(EL_HAVE_QUAD) || defined(EL_HAVE_MPC)
+        const Int nExt = Input("--nExt","size for extended precisions",100);
+#endif
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        bench::Options options;
+        options.Read();
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        bench::Suite suite( "LocalKernels", options, comm );
+
+        BenchmarkKernels<float>( suite, n );
+        BenchmarkKernels<Complex<float>>( suite, n );
+        BenchmarkKernels<double>( suite, n );
+        BenchmarkKernels<Complex<double>>( suite, n );
+
+#ifdef EL_HAVE_QD
+        BenchmarkKernels<DoubleDouble>( suite, nExt );
+        BenchmarkKernels<Complex<DoubleDouble>>( suite, nExt );
+        BenchmarkKernels<QuadDouble>( suite, nExt );
+        BenchmarkKernels<Complex<QuadDouble>>( suite, nExt );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        BenchmarkKernels<Quad>( suite, nExt );
+        BenchmarkKernels<Complex<Quad>>( suite, nExt );
+#endif
+
+#ifdef EL_HAVE_MPC
+        BenchmarkKernels<BigFloat>( suite, nExt );
+        BenchmarkKernels<Complex<BigFloat>>( suite, nExt );
+#endif
+
+        if( suite.Finish() != 0 )
+            return 1;
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
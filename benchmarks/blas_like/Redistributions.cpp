@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Times every pairing of the fourteen element-wise distributions (which
+// exercises each of the redistribution kernels in blas_like/level1/Copy/),
+// as well as the realigning, block-to-element, and between-grid
+// redistributions handled by Translate, GeneralPurpose, and
+// TranslateBetweenGrids.
+
+template<typename T>
+string DistName( const ElementalMatrix<T>& A )
+{
+    return BuildString
+    ("[",DistToString(A.ColDist()),",",DistToString(A.RowDist()),"]");
+}
+
+template<typename T,Dist X,Dist Y>
+void BenchmarkCopy( bench::Suite& suite, const ElementalMatrix<T>& A )
+{
+    DistMatrix<T,X,Y> B( A.Grid() );
+    const double bytes = double(A.Height())*A.Width()*sizeof(T);
+    suite.Run
+    ( BuildString
+      ("Copy/",TypeName<T>(),"/",DistName(A),"->",DistName(B)),
+      [&]() { B = A; }, 0, bytes );
+}
+
+template<typename T,Dist U,Dist V>
+void BenchmarkFrom( bench::Suite& suite, const Grid& grid, Int m, Int n )
+{
+    DistMatrix<T,U,V> A( grid );
+    Uniform( A, m, n );
+    BenchmarkCopy<T,CIRC,CIRC>( suite, A );
+    BenchmarkCopy<T,MC,  MR  >( suite, A );
+    BenchmarkCopy<T,MC,  STAR>( suite, A );
+    BenchmarkCopy<T,MD,  STAR>( suite, A );
+    BenchmarkCopy<T,MR,  MC  >( suite, A );
+    BenchmarkCopy<T,MR,  STAR>( suite, A );
+    BenchmarkCopy<T,STAR,MC  >( suite, A );
+    BenchmarkCopy<T,STAR,MD  >( suite, A );
+    BenchmarkCopy<T,STAR,MR  >( suite, A );
+    BenchmarkCopy<T,STAR,STAR>( suite, A );
+    BenchmarkCopy<T,STAR,VC  >( suite, A );
+    BenchmarkCopy<T,STAR,VR  >( suite, A );
+    BenchmarkCopy<T,VC,  STAR>( suite, A );
+    BenchmarkCopy<T,VR,  STAR>( suite, A );
+}
+
+template<typename T>
+void BenchmarkRedistributions
+( bench::Suite& suite, const Grid& grid, Int m, Int n, Int blocksize )
+{
+    BenchmarkFrom<T,CIRC,CIRC>( suite, grid, m, n );
+    BenchmarkFrom<T,MC,  MR  >( suite, grid, m, n );
+    BenchmarkFrom<T,MC,  STAR>( suite, grid, m, n );
+    BenchmarkFrom<T,MD,  STAR>( suite, grid, m, n );
+    BenchmarkFrom<T,MR,  MC  >( suite, grid, m, n );
+    BenchmarkFrom<T,MR,  STAR>( suite, grid, m, n );
+    BenchmarkFrom<T,STAR,MC  >( suite, grid, m, n );
+    BenchmarkFrom<T,STAR,MD  >( suite, grid, m, n );
+    BenchmarkFrom<T,STAR,MR  >( suite, grid, m, n );
+    BenchmarkFrom<T,STAR,STAR>( suite, grid, m, n );
+    BenchmarkFrom<T,STAR,VC  >( suite, grid, m, n );
+    BenchmarkFrom<T,STAR,VR  >( suite, grid, m, n );
+    BenchmarkFrom<T,VC,  STAR>( suite, grid, m, n );
+    BenchmarkFrom<T,VR,  STAR>( suite, grid, m, n );
+
+    const string type = TypeName<T>();
+    const double bytes = double(m)*n*sizeof(T);
+
+    // Realignment within the same distribution
+    DistMatrix<T> A( grid ), AShift( grid );
+    Uniform( A, m, n );
+    AShift.Align( Mod(1,grid.Height()), Mod(1,grid.Width()) );
+    suite.Run
+    ( BuildString("Copy/",type,"/[MC,MR]->[MC,MR]/realign"),
+      [&]() { AShift = A; }, 0, bytes );
+
+    // Element-wise to block-cyclic and back
+    DistMatrix<T,MC,MR,BLOCK> ABlock( grid, blocksize, blocksize );
+    suite.Run
+    ( BuildString("Copy/",type,"/[MC,MR]->[MC,MR,BLOCK]"),
+      [&]() { ABlock = A; }, 0, bytes );
+    DistMatrix<T> ACopy( grid );
+    suite.Run
+    ( BuildString("Copy/",type,"/[MC,MR,BLOCK]->[MC,MR]"),
+      [&]() { ACopy = ABlock; }, 0, bytes );
+
+    // Between a grid and its transpose
+    const GridOrder otherOrder =
+      ( grid.Order() == COLUMN_MAJOR ? ROW_MAJOR : COLUMN_MAJOR );
+    const Grid otherGrid( grid.Comm(), grid.Width(), otherOrder );
+    DistMatrix<T> AOther( otherGrid );
+    suite.Run
+    ( BuildString("Copy/",type,"/[MC,MR]->[MC,MR]/between-grids"),
+      [&]() { AOther = A; }, 0, bytes );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",2000);
+        const Int n = Input("--n","width of matrix",2000);
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const bool colMajor =
+          Input("--colMajor","column-major ordering?",true);
+        const Int blocksize =
+          Input("--blocksize","block-cyclic distribution blocksize",32);
+        const bool complex =
+          Input("--complex","also benchmark complex matrices?",true);
+        bench::Options options;
+        options.Read();
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid grid( comm, gridHeight, order );
+        bench::Suite suite( "Redistributions", options, comm );
+
+        BenchmarkRedistributions<double>( suite, grid, m, n, blocksize );
+        if( complex )
+            BenchmarkRedistributions<Complex<double>>
+            ( suite, grid, m, n, blocksize );
+
+        if( suite.Finish() != 0 )
+            return 1;
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Times the sequential (on each process independently) and distributed dense
+// factorizations; the inputs are restored outside of the timed region
+
+template<typename F>
+double FlopScale()
+{ return IsComplex<F>::value ? 4. : 1.; }
+
+template<typename F>
+void BenchmarkSequential( bench::Suite& suite, Int n )
+{
+    const string type = TypeName<F>();
+    const double scale = mpi::Size(suite.Comm())*FlopScale<F>();
+    const double dn = n;
+
+    Matrix<F> AGen, AHPD, A;
+    Uniform( AGen, n, n );
+    ShiftDiagonal( AGen, F(n) );
+    HermitianUniformSpectrum( AHPD, n, Base<F>(1), Base<F>(10) );
+
+    suite.RunWithSetup
+    ( BuildString("LU/",type,"/n=",n),
+      [&]() { A = AGen; }, [&]() { LU( A ); },
+      scale*2.*dn*dn*dn/3. );
+
+    Permutation P;
+    suite.RunWithSetup
+    ( BuildString("LUPartialPiv/",type,"/n=",n),
+      [&]() { A = AGen; }, [&]() { LU( A, P ); },
+      scale*2.*dn*dn*dn/3. );
+
+    suite.RunWithSetup
+    ( BuildString("Cholesky/",type,"/n=",n),
+      [&]() { A = AHPD; }, [&]() { Cholesky( LOWER, A ); },
+      scale*dn*dn*dn/3. );
+
+    Matrix<F> dSub;
+    suite.RunWithSetup
+    ( BuildString("LDLPivoted/",type,"/n=",n),
+      [&]() { A = AHPD; }, [&]() { LDL( A, dSub, P, true ); },
+      scale*dn*dn*dn/3. );
+
+    Matrix<F> phase;
+    Matrix<Base<F>> signature;
+    suite.RunWithSetup
+    ( BuildString("QR/",type,"/n=",n),
+      [&]() { A = AGen; }, [&]() { QR( A, phase, signature ); },
+      scale*4.*dn*dn*dn/3. );
+}
+
+template<typename F>
+void BenchmarkDistributed( bench::Suite& suite, const Grid& grid, Int n )
+{
+    const string type = TypeName<F>();
+    const double scale = FlopScale<F>();
+    const double dn = n;
+
+    DistMatrix<F> AGen(grid), AHPD(grid), A(grid);
+    Uniform( AGen, n, n );
+    ShiftDiagonal( AGen, F(n) );
+    HermitianUniformSpectrum( AHPD, n, Base<F>(1), Base<F>(10) );
+
+    suite.RunWithSetup
+    ( BuildString("DistLU/",type,"/n=",n),
+      [&]() { A = AGen; }, [&]() { LU( A ); },
+      scale*2.*dn*dn*dn/3. );
+
+    DistPermutation P(grid);
+    suite.RunWithSetup
+    ( BuildString("DistLUPartialPiv/",type,"/n=",n),
+      [&]() { A = AGen; }, [&]() { LU( A, P ); },
+      scale*2.*dn*dn*dn/3. );
+
+    suite.RunWithSetup
+    ( BuildString("DistCholesky/",type,"/n=",n),
+      [&]() { A = AHPD; }, [&]() { Cholesky( LOWER, A ); },
+      scale*dn*dn*dn/3. );
+
+    DistMatrix<F,MD,STAR> dSub(grid);
+    suite.RunWithSetup
+    ( BuildString("DistLDLPivoted/",type,"/n=",n),
+      [&]() { A = AHPD; }, [&]() { LDL( A, dSub, P, true ); },
+      scale*dn*dn*dn/3. );
+
+    DistMatrix<F,MD,STAR> phase(grid);
+    DistMatrix<Base<F>,MD,STAR> signature(grid);
+    suite.RunWithSetup
+    ( BuildString("DistQR/",type,"/n=",n),
+      [&]() { A = AGen; }, [&]() { QR( A, phase, signature ); },
+      scale*4.*dn*dn*dn/3. );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nSeq = Input("--nSeq","size of sequential matrices",500);
+        const Int nDist = Input("--nDist","size of distributed matrices",2000);
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool complex =
+          Input("--complex","also benchmark complex matrices?",true);
+        bench::Options options;
+        options.Read();
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+        bench::Suite suite( "DenseFactorizations", options, comm );
+
+        BenchmarkSequential<float>( suite, nSeq );
+        BenchmarkSequential<double>( suite, nSeq );
+        BenchmarkDistributed<float>( suite, grid, nDist );
+        BenchmarkDistributed<double>( suite, grid, nDist );
+        if( complex )
+        {
+            BenchmarkSequential<Complex<float>>( suite, nSeq );
+            BenchmarkSequential<Complex<double>>( suite, nSeq );
+            BenchmarkDistributed<Complex<float>>( suite, grid, nDist );
+            BenchmarkDistributed<Complex<double>>( suite, grid, nDist );
+        }
+
+        if( suite.Finish() != 0 )
+            return 1;
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Times the analysis (nested dissection), numeric factorization (including
+// pulling the matrix into the fronts), and solve phases of a sparse-direct
+// LDL^T factorization of a 3D finite-difference Laplacian
+
+template<typename F>
+void BenchmarkSparseLDL
+( bench::Suite& suite, Int n1, Int n2, Int n3, Int numRHS,
+  LDLFrontType frontType, const BisectCtrl& ctrl )
+{
+    mpi::Comm comm = suite.Comm();
+    const string type = TypeName<F>();
+    const string dims = BuildString(n1,"x",n2,"x",n3);
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+
+    ldl::DistFactorizationPlan<F> plan;
+    suite.RunWithSetup
+    ( BuildString("SparseLDL/analysis/",type,"/",dims),
+      [&]() { plan.Reset(); }, [&]() { plan.Analyze( A, ctrl ); } );
+
+    plan.Factor( A, frontType, false, ctrl );
+    const double factorFlops =
+      mpi::AllReduce( plan.front.LocalFactorGFlops(), comm )*1e9;
+    suite.Run
+    ( BuildString("SparseLDL/factor/",type,"/",dims),
+      [&]() { plan.Factor( A, frontType, false, ctrl ); },
+      factorFlops );
+
+    DistMultiVec<F> B(N,numRHS,comm), X(comm);
+    MakeUniform( B );
+    const double solveFlops =
+      mpi::AllReduce( plan.front.LocalSolveGFlops(numRHS), comm )*1e9;
+    suite.RunWithSetup
+    ( BuildString("SparseLDL/solve/",type,"/",dims,"/numRHS=",numRHS),
+      [&]() { X = B; },
+      [&]() { ldl::SolveAfter( plan.invMap, plan.info, plan.front, X ); },
+      solveFlops );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",30);
+        const Int n2 = Input("--n2","second grid dimension",30);
+        const Int n3 = Input("--n3","third grid dimension",30);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",10);
+        const bool solve2d = Input("--solve2d","use 2d solve?",true);
+        const bool sequential =
+          Input("--sequential","sequential partitions?",true);
+        const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const Int nb = Input("--nb","factorization blocksize",96);
+        const bool complex =
+          Input("--complex","also benchmark complex matrices?",false);
+        bench::Options options;
+        options.Read();
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        BisectCtrl ctrl;
+        ctrl.sequential = sequential;
+        ctrl.cutoff = cutoff;
+        const LDLFrontType frontType = ( solve2d ? LDL_2D : LDL_1D );
+
+        bench::Suite suite( "SparseLDL", options, comm );
+        BenchmarkSparseLDL<double>
+        ( suite, n1, n2, n3, numRHS, frontType, ctrl );
+        if( complex )
+            BenchmarkSparseLDL<Complex<double>>
+            ( suite, n1, n2, n3, numRHS, frontType, ctrl );
+
+        if( suite.Finish() != 0 )
+            return 1;
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
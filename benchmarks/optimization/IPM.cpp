@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Times the Mehrotra interior point methods for direct-form Linear and
+// Quadratic Programs,
+//
+//   min c^T x (+ (1/2) x^T Q x) s.t. A x = b, x >= 0,
+//
+// where A = [I, R] for a sparse R with a fixed number of nonzeros per row
+// (so that A has full row rank), b = A ones(n,1) (so that the problem is
+// feasible), and c > 0 (so that the objective is bounded).
+
+template<typename Real>
+void GenerateSparse
+( DistSparseMatrix<Real>& A, Int m, Int n, Int numNonzerosPerRow )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight*(numNonzerosPerRow+1) );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Real(1) );
+        for( Int k=0; k<numNonzerosPerRow; ++k )
+        {
+            const Int j = m + (i*(2*k+1)+k*k) % (n-m);
+            A.QueueLocalUpdate( iLoc, j, SampleUniform(Real(0),Real(1)) );
+        }
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename Real>
+void BenchmarkIPM
+( bench::Suite& suite, Int m, Int n, Int numNonzerosPerRow,
+  Int mDense, Int nDense, const Grid& grid, bool print )
+{
+    mpi::Comm comm = suite.Comm();
+    const string type = TypeName<Real>();
+
+    // Sparse LP and QP
+    DistSparseMatrix<Real> A(comm), Q(comm);
+    GenerateSparse( A, m, n, numNonzerosPerRow );
+    Laplacian( Q, n );
+    DistMultiVec<Real> b(comm), c(comm), xFeas(comm);
+    Ones( xFeas, n, 1 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, xFeas, Real(0), b );
+    Uniform( c, n, 1, Real(1), Real(1)/2 );
+
+    DistMultiVec<Real> x(comm), y(comm), z(comm);
+    lp::direct::Ctrl<Real> lpCtrl(true);
+    lpCtrl.mehrotraCtrl.print = print;
+    suite.Run
+    ( BuildString("LP/sparse/",type,"/m=",m,"/n=",n),
+      [&]() { LP( A, b, c, x, y, z, lpCtrl ); } );
+
+    qp::direct::Ctrl<Real> qpCtrl;
+    qpCtrl.mehrotraCtrl.print = print;
+    suite.Run
+    ( BuildString("QP/sparse/",type,"/m=",m,"/n=",n),
+      [&]() { QP( Q, A, b, c, x, y, z, qpCtrl ); } );
+
+    // Dense LP
+    DistMatrix<Real> ADense(grid), bDense(grid), cDense(grid),
+      xDense(grid), yDense(grid), zDense(grid), xFeasDense(grid);
+    Uniform( ADense, mDense, nDense, Real(0), Real(1) );
+    Ones( xFeasDense, nDense, 1 );
+    Zeros( bDense, mDense, 1 );
+    Gemv( NORMAL, Real(1), ADense, xFeasDense, Real(0), bDense );
+    Uniform( cDense, nDense, 1, Real(1), Real(1)/2 );
+    lp::direct::Ctrl<Real> lpDenseCtrl(false);
+    lpDenseCtrl.mehrotraCtrl.print = print;
+    suite.Run
+    ( BuildString("LP/dense/",type,"/m=",mDense,"/n=",nDense),
+      [&]()
+      { LP( ADense, bDense, cDense, xDense, yDense, zDense, lpDenseCtrl ); } );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of sparse constraints",10000);
+        const Int n = Input("--n","number of sparse variables",20000);
+        const Int numNonzeros =
+          Input("--numNonzeros","random nonzeros per sparse row",4);
+        const Int mDense = Input("--mDense","number of dense constraints",200);
+        const Int nDense = Input("--nDense","number of dense variables",400);
+        const bool print = Input("--print","print IPM progress?",false);
+        bench::Options options;
+        options.Read();
+        ProcessInput();
+        PrintInputReport();
+        ComplainIfDebug();
+        if( n <= m )
+            LogicError("Require more variables than constraints");
+
+        const Grid grid( comm );
+        bench::Suite suite( "IPM", options, comm );
+        BenchmarkIPM<double>
+        ( suite, m, n, numNonzeros, mDense, nDense, grid, print );
+
+        if( suite.Finish() != 0 )
+            return 1;
+    }
+    catch( exception& e ) { ReportException(e); return 1; }
+
+    return 0;
+}
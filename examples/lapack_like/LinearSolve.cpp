@@ -32,6 +32,8 @@ int main( int argc, char* argv[] )
 #endif
         const bool elemental = Input("--elemental","test Elemental?",true);
         const bool error = Input("--error","test Elemental error?",true);
+        const bool mixed =
+          Input("--mixed","factor in a lower precision and refine?",false);
         const Int mb = Input("--mb","block height",32);
         const Int nb = Input("--nb","block width",32);
         Int gridHeight = Input("--gridHeight","grid height",0);
@@ -52,6 +54,9 @@ int main( int argc, char* argv[] )
         if( commRank == 0 )
             Output("Grid is: ",grid.Height()," x ",grid.Width());
 
+        LinearSolveCtrl<Real> ctrl;
+        ctrl.mixedPrecision = mixed;
+
         // Set up random A and B, then make the copies X := B
         Timer timer;
         DistMatrix<F> A(grid), B(grid), X(grid);
@@ -90,7 +95,7 @@ int main( int argc, char* argv[] )
                 mpi::Barrier( comm );
                 if( commRank == 0 )
                     timer.Start();
-                LinearSolve( A, X );
+                LinearSolve( A, X, ctrl );
                 mpi::Barrier( comm );
                 if( commRank == 0 )
                     Output(timer.Stop()," seconds");
@@ -72,6 +72,10 @@ main( int argc, char* argv[] )
         const Int basisSize = Input("--basisSize","num Arnoldi vectors",10);
         const Int maxIts = Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol = Input("--psTol","tolerance for pseudospectra",1e-6);
+        const bool adaptive =
+          Input("--adaptive","adaptively refine the grid?",false);
+        const Int coarseSpacing =
+          Input("--coarseSpacing","initial adaptive spacing",16);
         // Uniform options
         const Real uniformRealCenter = 
             Input("--uniformRealCenter","real center of uniform dist",0.);
@@ -247,6 +251,8 @@ main( int argc, char* argv[] )
         psCtrl.deflate = deflate;
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
+        psCtrl.adaptive = adaptive;
+        psCtrl.coarseSpacing = coarseSpacing;
         psCtrl.progress = progress;
 #ifdef EL_HAVE_SCALAPACK
         psCtrl.schurCtrl.qrCtrl.blockHeight = nbDist;
@@ -25,6 +25,10 @@ main( int argc, char* argv[] )
             static_cast<SignScaling>(Input("--scaling","scaling strategy",0));
         const Int maxIts = Input("--maxIts","max number of iter's",100);
         const double tol = Input("--tol","convergence tolerance",1e-6);
+        const bool newtonSchulz =
+          Input("--newtonSchulz","switch to Newton-Schulz?",true);
+        const double newtonSchulzTol =
+          Input("--newtonSchulzTol","Newton-Schulz switch tolerance",0.1);
         const bool progress = Input("--progress","print sign progress?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
@@ -43,6 +47,8 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.newtonSchulz = newtonSchulz;
+        signCtrl.newtonSchulzTol = newtonSchulzTol;
 
         Timer timer;
         // Compute sgn(A)
@@ -91,6 +91,10 @@ int main( int argc, char* argv[] )
         const bool probEnum =
           Input("--probEnum","probabalistic enumeration *after* BKZ?",true);
         const bool fullEnum = Input("--fullEnum","SVP via full enum?",false);
+        const bool parallelEnum =
+          Input("--parallelEnum","parallel enumeration?",false);
+        const Int parallelDepth =
+          Input("--parallelDepth","parallel enum split depth (0=auto)",0);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           Input("--prec","MPFR precision",mpfr_prec_t(1024));
@@ -177,6 +181,8 @@ int main( int argc, char* argv[] )
         ctrl.enumCtrl.phaseLength = phaseLength;
         ctrl.enumCtrl.enqueueProb = enqueueProb;
         ctrl.enumCtrl.progressLevel = progressLevel;
+        ctrl.enumCtrl.parallel = parallelEnum;
+        ctrl.enumCtrl.parallelDepth = parallelDepth;
         ctrl.earlyAbort = earlyAbort;
         ctrl.numEnumsBeforeAbort = numEnumsBeforeAbort;
         ctrl.subBKZ = subBKZ;
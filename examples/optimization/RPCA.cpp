@@ -69,6 +69,8 @@ main( int argc, char* argv[] )
             Input("--usePivQR","use pivoted QR approx?",false);
         const Int numPivSteps = 
             Input("--numPivSteps","number of steps of QR",75);
+        const bool useRandomizedSVT =
+            Input("--useRandomizedSVT","use randomized SVT?",false);
         const bool useALM = Input("--useALM","use ALM algorithm?",true);
         const bool display = Input("--display","display matrices",true);
         const bool print = Input("--print","print matrices",false);
@@ -135,6 +137,7 @@ main( int argc, char* argv[] )
         RPCACtrl<double> ctrl;
         ctrl.useALM = useALM;
         ctrl.usePivQR = usePivQR;
+        ctrl.useRandomizedSVT = useRandomizedSVT;
         ctrl.progress = print;
         ctrl.numPivSteps = numPivSteps;
         ctrl.maxIts = maxIts;
@@ -18,6 +18,7 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>()>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::AllGather");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -51,7 +52,7 @@ void AllGather
               sendBuf,          1, A.LocalHeight() );
 
             // Communicate
-            mpi::AllGather
+            A.Grid().AllGather
             ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm() );
 
             // Unpack
@@ -95,6 +96,7 @@ void AllGather
         DistMatrix<T,Collect<U>(),Collect<V>(),BLOCK>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::AllGather");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -17,6 +17,7 @@ template<typename T>
 void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather");
     DEBUG_ONLY(
       if( B.ColDist() != Collect(A.ColDist()) ||
           B.RowDist() != A.RowDist() )
@@ -87,7 +88,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, A.LocalHeight() );
 
                 // Communicate
-                mpi::AllGather
+                A.Grid().AllGather
                 ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
 
                 // Unpack
@@ -167,7 +168,7 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
                 // AllGather the aligned data
-                mpi::AllGather
+                A.Grid().AllGather
                 ( firstBuf,  portionSize,
                   secondBuf, portionSize, A.ColComm() );
 
@@ -210,6 +211,7 @@ void ColAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllGather");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -18,6 +18,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   >& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllDemote");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -66,7 +67,7 @@ void ColAllToAllDemote
               firstBuf,         portionSize );
 
             // Simultaneously Scatter in columns and Gather in rows
-            mpi::AllToAll
+            B.Grid().AllToAll
             ( firstBuf,  portionSize,
               secondBuf, portionSize, B.PartialUnionColComm() );
 
@@ -102,7 +103,7 @@ void ColAllToAllDemote
           secondBuf,        portionSize );
 
         // Simultaneously Scatter in columns and Gather in rows
-        mpi::AllToAll
+        B.Grid().AllToAll
         ( secondBuf, portionSize,
           firstBuf,  portionSize, B.PartialUnionColComm() );
 
@@ -127,6 +128,7 @@ void ColAllToAllDemote
         DistMatrix<T,        U,                     V   ,BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllDemote");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
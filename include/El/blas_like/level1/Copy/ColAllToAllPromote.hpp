@@ -18,6 +18,7 @@ void ColAllToAllPromote
         DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>()>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllPromote");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -58,7 +59,7 @@ void ColAllToAllPromote
               firstBuf,         portionSize );
 
             // Simultaneously Gather in columns and Scatter in rows
-            mpi::AllToAll
+            A.Grid().AllToAll
             ( firstBuf,  portionSize,
               secondBuf, portionSize, A.PartialUnionColComm() );
 
@@ -100,7 +101,7 @@ void ColAllToAllPromote
           A.PartialColComm() );
 
         // Simultaneously Scatter in columns and Gather in rows
-        mpi::AllToAll
+        A.Grid().AllToAll
         ( firstBuf,  portionSize,
           secondBuf, portionSize, A.PartialUnionColComm() );
 
@@ -121,6 +122,7 @@ void ColAllToAllPromote
         DistMatrix<T,Partial<U>(),PartialUnionRow<U,V>(),BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColAllToAllPromote");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -17,6 +17,7 @@ template<typename T>
 void ColFilter( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColFilter");
     DEBUG_ONLY(
       if( A.ColDist() != Collect(B.ColDist()) ||
           A.RowDist() != B.RowDist() )
@@ -84,6 +85,7 @@ void ColFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColFilter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -19,6 +19,7 @@ void Exchange
   int sendRank, int recvRank, mpi::Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Exchange");
     DEBUG_ONLY(AssertSameGrids( A, B ))
     const int myRank = mpi::Rank( comm );
     DEBUG_ONLY(
@@ -111,6 +112,7 @@ void ColwiseVectorExchange
         DistMatrix<T,ProductDist<V,U>(),STAR>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::ColwiseVectorExchange");
     AssertSameGrids( A, B );
     if( !B.Participating() )
         return;
@@ -131,6 +133,7 @@ void RowwiseVectorExchange
         DistMatrix<T,STAR,ProductDist<V,U>()>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowwiseVectorExchange");
     AssertSameGrids( A, B );
     if( !B.Participating() )
         return;
@@ -18,6 +18,7 @@ void Filter
         DistMatrix<T,        U,           V   >& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Filter");
     AssertSameGrids( A, B );
 
     B.Resize( A.Height(), A.Width() );
@@ -38,6 +39,7 @@ void Filter
         DistMatrix<T,        U,           V   ,BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Filter");
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
 }
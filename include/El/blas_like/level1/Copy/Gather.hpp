@@ -18,6 +18,7 @@ void Gather
         DistMatrix<T,CIRC,CIRC>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Gather");
     AssertSameGrids( A, B );
     if( A.DistSize() == 1 && A.CrossSize() == 1 )
     {
@@ -93,6 +94,7 @@ void Gather
         DistMatrix<T,CIRC,CIRC,BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Gather");
     AssertSameGrids( A, B );
     if( A.DistSize() == 1 && A.CrossSize() == 1 )
     {
@@ -12,148 +12,423 @@
 namespace El {
 namespace copy {
 
-template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
-void Helper
-( const AbstractDistMatrix<S>& A,
-        AbstractDistMatrix<T>& B ) 
+// A reusable description of the communication required to redistribute a
+// matrix between two arbitrary distributions (over possibly different grids).
+// Since the owner of each entry is determined by its row and column
+// separately, the entries sent from one process to another form a rectangle
+// (the Cartesian product of a set of local rows and a set of local columns),
+// and both the sender and receiver can enumerate it in the same order, so
+// only the values are communicated.
+struct GeneralPurposePlan
 {
-    DEBUG_CSE
+    struct Rectangle
+    {
+        int rank=0; // the peer within 'comm'
+        Int rowRunOff=0, numRowRuns=0, numRows=0;
+        Int colOff=0, numCols=0;
+    };
 
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
-    const Int height = A.Height();
-    const Int width = A.Width();
+    // False if this process does not take part in the redistribution
+    bool active=false;
+    mpi::Comm comm;
+    // Whether the local matrix of the (redundant) receivers must be broadcast
+    // over the redundant communicator of the target distribution
+    bool broadcast=false;
+
+    vector<Rectangle> sends, recvs;
+    // Concatenated (first,length) pairs of runs of consecutive local rows
+    // (of A for sends and B for receives) and the lists of local columns
+    vector<Int> sendRowRuns, recvRowRuns;
+    vector<Int> sendCols, recvCols;
+
+    // The portion of A that this process owns in B (if any)
+    bool haveSelf=false;
+    Rectangle selfSend, selfRecv;
+};
+
+// Plans are cached for the most recently used combinations of matrix sizes,
+// distributions, and alignments between each pair of grids, and are
+// discarded when one of their grids is destroyed. Each exchange between a
+// pair of processes is broken into rounds of at most the given number of
+// entries (at least one column). Since the processes must agree on whether
+// a plan is cached, both sizes must be set identically on every process
+// (and the plans cleared collectively).
+void SetGeneralPurposePlanCacheSize( Int numPlans );
+Int GeneralPurposePlanCacheSize();
+void SetGeneralPurposeChunkSize( Int numEntries );
+Int GeneralPurposeChunkSize();
+Int NumGeneralPurposePlans();
+void ClearGeneralPurposePlans();
+void ClearGeneralPurposePlans( const Grid& grid );
+
+// Returns nullptr if no matching plan has been cached. The query does not
+// affect which plans are evicted, so it need not be made collectively.
+const GeneralPurposePlan* FindGeneralPurposePlan
+( Int height, Int width, const DistData& AData, const DistData& BData );
+
+namespace gp {
+
+// For the (collective) redistributions only: FindPlan marks the matching
+// plan as the most recently used, and CachePlan takes ownership of a new plan
+// and evicts the least recently used plans beyond the cache size
+const GeneralPurposePlan* FindPlan
+( Int height, Int width, const DistData& AData, const DistData& BData );
+const GeneralPurposePlan& CachePlan
+( Int height, Int width, const DistData& AData, const DistData& BData,
+  GeneralPurposePlan& plan );
+
+// Appends the runs of consecutive indices within the sorted list 'inds'
+inline void AppendRuns( const vector<Int>& inds, vector<Int>& runs )
+{
+    const Int numInds = inds.size();
+    for( Int k=0; k<numInds; )
+    {
+        Int length = 1;
+        while( k+length < numInds && inds[k+length] == inds[k]+length )
+            ++length;
+        runs.push_back( inds[k] );
+        runs.push_back( length );
+        k += length;
+    }
+}
+
+inline void AppendRectangle
+( int rank,
+  const vector<Int>& rows, const vector<Int>& cols,
+  vector<Int>& rowRuns, vector<Int>& colList,
+  GeneralPurposePlan::Rectangle& rect )
+{
+    rect.rank = rank;
+    rect.rowRunOff = rowRuns.size();
+    AppendRuns( rows, rowRuns );
+    rect.numRowRuns = (rowRuns.size()-rect.rowRunOff)/2;
+    rect.numRows = rows.size();
+    rect.colOff = colList.size();
+    colList.insert( colList.end(), cols.begin(), cols.end() );
+    rect.numCols = cols.size();
+}
+
+template<typename S,typename T>
+GeneralPurposePlan BuildPlan
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    typedef GeneralPurposePlan::Rectangle Rectangle;
+    GeneralPurposePlan plan;
     const Grid& g = B.Grid();
     const Dist colDist=B.ColDist(), rowDist=B.RowDist();
     const int root = B.Root();
-    B.Resize( height, width );
-    const bool BPartic = B.Participating();
 
     const bool includeViewers = (A.Grid() != B.Grid());
+    if( !includeViewers && !g.InGrid() )
+        return plan;
+    plan.active = true;
+    plan.comm = ( includeViewers ? g.ViewingComm() : g.VCComm() );
+    const int commSize = mpi::Size( plan.comm );
+    const int commRank = mpi::Rank( plan.comm );
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-    auto& ALoc = A.LockedMatrix();
-    auto& BLoc = B.Matrix();
+    // Map the ranks within the distribution of B to ranks within the comm
+    vector<int> distMap(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
+        distMap[q] = ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+
+    // Only one member of each redundant group of A sends, and only one member
+    // of each redundant group of B receives (and then broadcasts)
+    const bool sending = A.Participating() && A.RedundantRank() == 0;
+    const bool receiving = B.Participating() && B.RedundantRank() == 0;
+    plan.broadcast = B.Participating() && B.RedundantSize() > 1;
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if( A.RedundantRank() == 0 )
+    // Inform the receivers of the coordinates of the senders within A
+    int coords[2] = { -1, -1 };
+    if( sending )
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
+        coords[0] = A.ColRank();
+        coords[1] = A.RowRank();
+    }
+    vector<int> senderCoords(2*commSize);
+    mpi::AllGather( coords, 2, senderCoords.data(), 2, plan.comm );
 
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
+    vector<Int> selfSendRows, selfSendCols;
+    if( sending )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const int colStride = B.ColStride();
+        const int rowStride = B.RowStride();
+        vector<vector<Int>> rowSets(colStride), colSets(rowStride);
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
-        }
-
-        remoteEntries.reserve( localHeight*localWidth );
-        distOwners.reserve( localHeight*localWidth );
+            rowSets[B.RowOwner(A.GlobalRow(iLoc))].push_back( iLoc );
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            colSets[B.ColOwner(A.GlobalCol(jLoc))].push_back( jLoc );
+
+        for( int ownerCol=0; ownerCol<rowStride; ++ownerCol )
         {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc ) 
+            if( colSets[ownerCol].empty() )
+                continue;
+            for( int ownerRow=0; ownerRow<colStride; ++ownerRow )
             {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S& alpha = ALoc(iLoc,jLoc);
-                if( noRedundant && isLocalRow && isLocalCol )
+                if( rowSets[ownerRow].empty() )
+                    continue;
+                const int rank = distMap[ownerRow+colStride*ownerCol];
+                if( rank == commRank )
                 {
-                    BLoc(localRow,localCol) = Caster<S,T>::Cast(alpha);
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
-                    distOwners.push_back( ownerRow + colStride*ownerCol );
+                    selfSendRows = rowSets[ownerRow];
+                    selfSendCols = colSets[ownerCol];
+                    continue;
                 }
+                Rectangle rect;
+                AppendRectangle
+                ( rank, rowSets[ownerRow], colSets[ownerCol],
+                  plan.sendRowRuns, plan.sendCols, rect );
+                plan.sends.push_back( rect );
             }
-        }    
+        }
     }
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
+    if( receiving )
     {
-        comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
+        const Int localHeight = B.LocalHeight();
+        const Int localWidth = B.LocalWidth();
+        vector<vector<Int>> rowSets(A.ColStride()), colSets(A.RowStride());
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            rowSets[A.RowOwner(B.GlobalRow(iLoc))].push_back( iLoc );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            colSets[A.ColOwner(B.GlobalCol(jLoc))].push_back( jLoc );
 
-        vector<int> distMap(commSize);
         for( int q=0; q<commSize; ++q )
         {
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
-            distMap[q] = g.VCToViewing(vcOwner);
+            const int ownerRow = senderCoords[2*q];
+            const int ownerCol = senderCoords[2*q+1];
+            if( ownerRow < 0 ||
+                rowSets[ownerRow].empty() || colSets[ownerCol].empty() )
+                continue;
+            if( q == commRank )
+            {
+                plan.haveSelf = true;
+                AppendRectangle
+                ( q, selfSendRows, selfSendCols,
+                  plan.sendRowRuns, plan.sendCols, plan.selfSend );
+                AppendRectangle
+                ( q, rowSets[ownerRow], colSets[ownerCol],
+                  plan.recvRowRuns, plan.recvCols, plan.selfRecv );
+                continue;
+            }
+            Rectangle rect;
+            AppendRectangle
+            ( q, rowSets[ownerRow], colSets[ownerCol],
+              plan.recvRowRuns, plan.recvCols, rect );
+            plan.recvs.push_back( rect );
         }
+    }
+    return plan;
+}
 
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
+template<typename S,typename T>
+const GeneralPurposePlan& GetPlan
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const DistData AData(A), BData(B);
+    // The cache of each pair of grids evolves identically on every process
+    // which takes part, so they agree on whether to (collectively) build a
+    // new plan
+    auto planPtr = FindPlan( height, width, AData, BData );
+    if( planPtr != nullptr )
+        return *planPtr;
+
+    auto plan = BuildPlan( A, B );
+    return CachePlan( height, width, AData, BData, plan );
+}
+
+// The number of columns of the rectangle exchanged in each round
+inline Int ColsPerRound( const GeneralPurposePlan::Rectangle& rect )
+{
+    const Int numRows = Max( rect.numRows, Int(1) );
+    return Max( Int(1), GeneralPurposeChunkSize() / numRows );
+}
+
+inline Int NumRounds( const GeneralPurposePlan::Rectangle& rect )
+{
+    const Int colsPerRound = ColsPerRound( rect );
+    return (rect.numCols+colsPerRound-1) / colsPerRound;
+}
+
+// Pack the columns [colBeg,colEnd) of the rectangle
+template<typename S>
+void Pack
+( const GeneralPurposePlan::Rectangle& rect,
+  const vector<Int>& rowRuns, const vector<Int>& cols,
+  Int colBeg, Int colEnd, const Matrix<S>& ALoc, S* buffer )
+{
+    const Int* runs = &rowRuns[rect.rowRunOff];
+    for( Int c=colBeg; c<colEnd; ++c )
+    {
+        const Int jLoc = cols[rect.colOff+c];
+        for( Int r=0; r<rect.numRowRuns; ++r )
         {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const S* ACol = ALoc.LockedBuffer(runs[2*r],jLoc);
+            buffer = std::copy( ACol, ACol+runs[2*r+1], buffer );
         }
     }
-    else
+}
+
+template<typename S,typename T>
+void Unpack
+( const GeneralPurposePlan::Rectangle& rect,
+  const vector<Int>& rowRuns, const vector<Int>& cols,
+  Int colBeg, Int colEnd, const S* buffer, Matrix<T>& BLoc )
+{
+    const Int* runs = &rowRuns[rect.rowRunOff];
+    for( Int c=colBeg; c<colEnd; ++c )
     {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
+        const Int jLoc = cols[rect.colOff+c];
+        for( Int r=0; r<rect.numRowRuns; ++r )
+        {
+            T* BCol = BLoc.Buffer(runs[2*r],jLoc);
+            const Int length = runs[2*r+1];
+            for( Int k=0; k<length; ++k )
+                BCol[k] = Caster<S,T>::Cast(buffer[k]);
+            buffer += length;
+        }
+    }
+}
 
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-            distMap[q] = g.CoordsToVC(colDist,rowDist,q,root);
+} // namespace gp
 
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void Helper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B ) 
+{
+    DEBUG_CSE
+    // TODO: Decide whether S or T should be used as the transmission type
+    //       based upon which is smaller. Transmit S by default.
+    typedef GeneralPurposePlan::Rectangle Rectangle;
+    B.Resize( A.Height(), A.Width() );
+    const GeneralPurposePlan& plan = gp::GetPlan( A, B );
+    if( !plan.active )
+        return;
+
+    auto& ALoc = A.LockedMatrix();
+    auto& BLoc = B.Matrix();
+    const Int numSends = plan.sends.size();
+    const Int numRecvs = plan.recvs.size();
+
+    Int numRounds = ( plan.haveSelf ? gp::NumRounds(plan.selfSend) : 0 );
+    for( const Rectangle& rect : plan.sends )
+        numRounds = Max( numRounds, gp::NumRounds(rect) );
+    for( const Rectangle& rect : plan.recvs )
+        numRounds = Max( numRounds, gp::NumRounds(rect) );
+
+    // Exchange one chunk of columns of each rectangle per round
+    vector<S> sendBuf, recvBuf;
+    vector<Int> sendOffs(numSends+1), recvOffs(numRecvs+1);
+    vector<mpi::Request<S>> sendRequests, recvRequests;
+    auto chunk = [&]( const Rectangle& rect, Int round, Int& beg, Int& end )
+    {
+        const Int colsPerRound = gp::ColsPerRound( rect );
+        beg = Min( round*colsPerRound, rect.numCols );
+        end = Min( beg+colsPerRound, rect.numCols );
+    };
+    for( Int round=0; round<numRounds; ++round )
+    {
+        Int beg, end;
+
+        // Post the receives
+        recvOffs[0] = 0;
+        for( Int r=0; r<numRecvs; ++r )
+        {
+            chunk( plan.recvs[r], round, beg, end );
+            recvOffs[r+1] = recvOffs[r] + (end-beg)*plan.recvs[r].numRows;
+        }
+        FastResize( recvBuf, recvOffs[numRecvs] );
+        recvRequests.resize( numRecvs );
+        for( Int r=0; r<numRecvs; ++r )
+            if( recvOffs[r+1] > recvOffs[r] )
+                mpi::IRecv
+                ( &recvBuf[recvOffs[r]], recvOffs[r+1]-recvOffs[r],
+                  plan.recvs[r].rank, plan.comm, recvRequests[r] );
+
+        // Pack and send
+        sendOffs[0] = 0;
+        for( Int s=0; s<numSends; ++s )
         {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
+            chunk( plan.sends[s], round, beg, end );
+            sendOffs[s+1] = sendOffs[s] + (end-beg)*plan.sends[s].numRows;
         }
+        FastResize( sendBuf, sendOffs[numSends] );
+        sendRequests.resize( numSends );
+        for( Int s=0; s<numSends; ++s )
+        {
+            if( sendOffs[s+1] == sendOffs[s] )
+                continue;
+            chunk( plan.sends[s], round, beg, end );
+            gp::Pack
+            ( plan.sends[s], plan.sendRowRuns, plan.sendCols, beg, end,
+              ALoc, &sendBuf[sendOffs[s]] );
+            mpi::ISend
+            ( &sendBuf[sendOffs[s]], sendOffs[s+1]-sendOffs[s],
+              plan.sends[s].rank, plan.comm, sendRequests[s] );
+        }
+
+        // Copy the local portion while the messages are in flight
+        if( plan.haveSelf )
+        {
+            chunk( plan.selfSend, round, beg, end );
+            if( end > beg )
+            {
+                vector<S> selfBuf( (end-beg)*plan.selfSend.numRows );
+                gp::Pack
+                ( plan.selfSend, plan.sendRowRuns, plan.sendCols, beg, end,
+                  ALoc, selfBuf.data() );
+                gp::Unpack
+                ( plan.selfRecv, plan.recvRowRuns, plan.recvCols, beg, end,
+                  selfBuf.data(), BLoc );
+            }
+        }
+
+        // Unpack
+        for( Int r=0; r<numRecvs; ++r )
+        {
+            if( recvOffs[r+1] == recvOffs[r] )
+                continue;
+            mpi::Wait( recvRequests[r] );
+            chunk( plan.recvs[r], round, beg, end );
+            gp::Unpack
+            ( plan.recvs[r], plan.recvRowRuns, plan.recvCols, beg, end,
+              &recvBuf[recvOffs[r]], BLoc );
+        }
+        for( Int s=0; s<numSends; ++s )
+            if( sendOffs[s+1] > sendOffs[s] )
+                mpi::Wait( sendRequests[s] );
     }
-    SwapClear( distOwners );
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<S>> sendBuf;
-    FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    if( B.Participating() )
+
+    // Replicate the result over the redundant copies of B
+    if( plan.broadcast )
     {
-        Int recvBufSize = recvBuf.size();
-        mpi::Broadcast( recvBufSize, 0, B.RedundantComm() );
-        FastResize( recvBuf, recvBufSize );
-        mpi::Broadcast( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
-        for( Int k=0; k<recvBufSize; ++k )
+        const Int localHeight = BLoc.Height();
+        const Int localWidth = BLoc.Width();
+        if( BLoc.LDim() == localHeight )
+        {
+            mpi::Broadcast
+            ( BLoc.Buffer(), localHeight*localWidth, 0, B.RedundantComm() );
+        }
+        else
         {
-            const auto& entry = recvBuf[k];
-            BLoc(entry.i,entry.j) = Caster<S,T>::Cast(entry.value);
+            Matrix<T> BPacked;
+            if( B.RedundantRank() == 0 )
+                BPacked = BLoc;
+            else
+                BPacked.Resize( localHeight, localWidth );
+            mpi::Broadcast
+            ( BPacked.Buffer(), localHeight*localWidth, 0,
+              B.RedundantComm() );
+            BLoc = BPacked;
         }
     }
 }
@@ -164,6 +439,7 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose");
 
     if( A.Grid().Size() == 1 && B.Grid().Size() == 1 )
     {
@@ -181,6 +457,7 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::GeneralPurpose");
 
     const Int height = A.Height();
     const Int width = A.Width();
@@ -18,6 +18,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColAllGather");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -77,7 +78,7 @@ void PartialColAllGather
               firstBuf,         1, A.LocalHeight() );
 
             // Communicate
-            mpi::AllGather
+            A.Grid().AllGather
             ( firstBuf, portionSize, secondBuf, portionSize,
               A.PartialUnionColComm() );
 
@@ -114,7 +115,7 @@ void PartialColAllGather
           firstBuf,  portionSize, recvColRank, A.ColComm() );
 
         // Use the SendRecv as an input to the partial union AllGather
-        mpi::AllGather
+        A.Grid().AllGather
         ( firstBuf,  portionSize,
           secondBuf, portionSize, A.PartialUnionColComm() );
 
@@ -135,6 +136,7 @@ void PartialColAllGather
         DistMatrix<T,Partial<U>(),V,BLOCK>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColAllGather");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
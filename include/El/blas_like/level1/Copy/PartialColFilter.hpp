@@ -17,6 +17,7 @@ void PartialColFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColFilter");
     DEBUG_ONLY(
       if( A.ColDist() != Partial(B.ColDist()) ||
           A.RowDist() != B.RowDist() )
@@ -95,6 +96,7 @@ void PartialColFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialColFilter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -18,6 +18,7 @@ void PartialRowAllGather
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowAllGather");
     DEBUG_ONLY(
       if( B.ColDist() != A.ColDist() ||
           B.RowDist() != Partial(A.RowDist()) ) 
@@ -65,7 +66,7 @@ void PartialRowAllGather
               firstBuf,         1, height );
 
             // Communicate
-            mpi::AllGather
+            A.Grid().AllGather
             ( firstBuf, portionSize, secondBuf, portionSize,
               A.PartialUnionRowComm() );
 
@@ -102,7 +103,7 @@ void PartialRowAllGather
           firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
         // Use the SendRecv as an input to the partial union AllGather
-        mpi::AllGather
+        A.Grid().AllGather
         ( firstBuf,  portionSize,
           secondBuf, portionSize, A.PartialUnionRowComm() );
 
@@ -123,6 +124,7 @@ void PartialRowAllGather
         BlockMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowAllGather");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
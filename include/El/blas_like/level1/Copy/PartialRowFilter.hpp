@@ -17,6 +17,7 @@ void PartialRowFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowFilter");
     DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() ||
           A.RowDist() != Partial(B.RowDist()) )
@@ -95,6 +96,7 @@ void PartialRowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::PartialRowFilter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -17,6 +17,7 @@ template<typename T>
 void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather");
     DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() || 
           Collect(A.RowDist()) != B.RowDist() )
@@ -62,7 +63,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, localHeight );
 
                 // Communicate
-                mpi::AllGather
+                A.Grid().AllGather
                 ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm() );
 
                 // Unpack
@@ -120,7 +121,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvColRank, A.ColComm() );
 
                 // Perform the row AllGather
-                mpi::AllGather
+                A.Grid().AllGather
                 ( firstBuf,  portionSize,
                   secondBuf, portionSize, A.RowComm() );
 
@@ -163,6 +164,7 @@ void RowAllGather
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllGather");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -18,6 +18,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   >& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllDemote");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -61,7 +62,7 @@ void RowAllToAllDemote
               firstBuf,         portionSize );
 
             // Simultaneously Scatter in rows and Gather in columns
-            mpi::AllToAll
+            B.Grid().AllToAll
             ( firstBuf,  portionSize,
               secondBuf, portionSize, B.PartialUnionRowComm() );
 
@@ -97,7 +98,7 @@ void RowAllToAllDemote
           secondBuf,        portionSize );
 
         // Simultaneously Scatter in rows and Gather in columns
-        mpi::AllToAll
+        B.Grid().AllToAll
         ( secondBuf, portionSize,
           firstBuf,  portionSize, B.PartialUnionRowComm() );
 
@@ -122,6 +123,7 @@ void RowAllToAllDemote
           DistMatrix<T,                U,             V   ,BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllDemote");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -18,6 +18,7 @@ void RowAllToAllPromote
         DistMatrix<T,PartialUnionCol<U,V>(),Partial<V>()>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllPromote");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -60,7 +61,7 @@ void RowAllToAllPromote
               firstBuf,         portionSize );
 
             // Simultaneously Gather in rows and Scatter in columns
-            mpi::AllToAll
+            A.Grid().AllToAll
             ( firstBuf,  portionSize,
               secondBuf, portionSize, A.PartialUnionRowComm() );
 
@@ -102,7 +103,7 @@ void RowAllToAllPromote
           A.PartialRowComm() );
 
         // Simultaneously Scatter in rows and Gather in columns
-        mpi::AllToAll
+        A.Grid().AllToAll
         ( firstBuf,  portionSize,
           secondBuf, portionSize, A.PartialUnionRowComm() );
 
@@ -123,6 +124,7 @@ void RowAllToAllPromote
         DistMatrix<T,PartialUnionCol<U,V>(),Partial<V>(),BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowAllToAllPromote");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -18,6 +18,7 @@ void RowFilter
 ( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowFilter");
     DEBUG_ONLY(
       if( A.ColDist() != B.ColDist() ||
           A.RowDist() != Collect(B.RowDist()) )
@@ -86,6 +87,7 @@ void RowFilter
 ( const BlockMatrix<T>& A, BlockMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::RowFilter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
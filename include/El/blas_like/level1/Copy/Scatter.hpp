@@ -18,6 +18,7 @@ void Scatter
         ElementalMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids( A, B );
 
     const Int m = A.Height();
@@ -94,6 +95,7 @@ void Scatter
         BlockMatrix<T>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -106,6 +108,7 @@ void Scatter
         DistMatrix<T,STAR,STAR>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids( A, B );
 
     const Int height = A.Height();
@@ -142,6 +145,7 @@ void Scatter
         DistMatrix<T,STAR,STAR,BLOCK>& B )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Scatter");
     AssertSameGrids( A, B );
     // TODO: More efficient implementation
     GeneralPurpose( A, B );
@@ -18,6 +18,7 @@ void Translate
         DistMatrix<T,U,V>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Translate");
     if( A.Grid() != B.Grid() )
     {
         copy::TranslateBetweenGrids( A, B );
@@ -120,6 +121,7 @@ void Translate
         DistMatrix<T,U,V,BLOCK>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::Translate");
     const Int height = A.Height();
     const Int width = A.Width();
     const Int blockHeight = A.BlockHeight();
@@ -18,6 +18,7 @@ void TranslateBetweenGrids
         DistMatrix<T,U,V>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids");
     GeneralPurpose( A, B );
 }
 
@@ -28,6 +29,7 @@ void TranslateBetweenGrids
         DistMatrix<T,MC,MR>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int mLocA = A.LocalHeight();
@@ -224,6 +226,7 @@ void TranslateBetweenGrids
         DistMatrix<T,STAR,STAR>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::TranslateBetweenGrids");
     const Int height = A.Height();
     const Int width = A.Width();
     B.Resize( height, width );
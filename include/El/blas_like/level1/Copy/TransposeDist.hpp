@@ -17,6 +17,7 @@ template<typename T,Dist U,Dist V>
 void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("copy::TransposeDist");
     AssertSameGrids( A, B );
 
     const Grid& g = B.Grid();
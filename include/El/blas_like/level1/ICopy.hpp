@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_ICOPY_HPP
+#define EL_BLAS_ICOPY_HPP
+
+namespace El {
+
+template<typename T>
+CopyRequest<T>::~CopyRequest()
+{
+    // The communication buffers cannot be released while still in use
+    if( active_ )
+        Wait();
+}
+
+template<typename T>
+bool CopyRequest<T>::Test()
+{
+    DEBUG_CSE
+    if( !active_ )
+        return true;
+    if( !mpi::Test( request_ ) )
+        return false;
+    Wait();
+    return true;
+}
+
+template<typename T>
+void CopyRequest<T>::Wait()
+{
+    DEBUG_CSE
+    if( !active_ )
+        return;
+    mpi::Wait( request_ );
+    unpack_( &buffer_[recvOffset_] );
+    unpack_ = nullptr;
+    active_ = false;
+}
+
+template<typename T>
+void ICopy
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  CopyRequest<T>& request )
+{
+    DEBUG_CSE
+    EL_PROFILE_REGION("ICopy");
+    if( request.Active() )
+        LogicError("Cannot reuse an active CopyRequest");
+
+    const Dist UA = A.ColDist(), VA = A.RowDist();
+    const Dist UB = B.ColDist(), VB = B.RowDist();
+    const bool colSame = ( UB == UA );
+    const bool rowSame = ( VB == VA );
+    const bool colCollect = ( !colSame && UB == Collect(UA) );
+    const bool rowCollect = ( !rowSame && VB == Collect(VA) );
+    const bool colPartial = ( !colSame && UB == Partial(UA) );
+    const bool rowPartial = ( !rowSame && VB == Partial(VA) );
+    const bool gather =
+      ( colSame    && (rowCollect || rowPartial) ) ||
+      ( rowSame    && (colCollect || colPartial) ) ||
+      ( colCollect && rowCollect );
+    if( !gather || A.Grid() != B.Grid() || !A.Participating() ||
+        A.CrossComm() != mpi::COMM_SELF )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    // Align B with A whenever it is free to be
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const int colAlign =
+      ( colPartial ? Mod(A.ColAlign(),A.PartialColStride()) : A.ColAlign() );
+    const int rowAlign =
+      ( rowPartial ? Mod(A.RowAlign(),A.PartialRowStride()) : A.RowAlign() );
+    B.AlignAndResize( colAlign, rowAlign, height, width, false, false );
+    if( (!colCollect && B.ColAlign() != colAlign) ||
+        (!rowCollect && B.RowAlign() != rowAlign) )
+    {
+        Copy( A, B );
+        return;
+    }
+
+    mpi::Comm comm;
+    if( colCollect && rowCollect )
+        comm = A.DistComm();
+    else if( colCollect )
+        comm = A.ColComm();
+    else if( rowCollect )
+        comm = A.RowComm();
+    else if( colPartial )
+        comm = A.PartialUnionColComm();
+    else
+        comm = A.PartialUnionRowComm();
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight = MaxLength(height,colStride);
+    const Int maxLocalWidth = MaxLength(width,rowStride);
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    FastResize( request.buffer_, (commSize+1)*portionSize );
+    T* sendBuf = &request.buffer_[0];
+    T* recvBuf = &request.buffer_[portionSize];
+
+    copy::util::InterleaveMatrix
+    ( localHeight, localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf,          1, localHeight );
+    mpi::IAllGather
+    ( sendBuf, portionSize, recvBuf, portionSize, comm, request.request_ );
+
+    // Record how to unpack the gathered portions into B
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    const Int colAlignA = A.ColAlign();
+    const Int rowAlignA = A.RowAlign();
+    if( colCollect && rowCollect )
+    {
+        request.unpack_ = [=]( const T* portions )
+          {
+            copy::util::StridedUnpack
+            ( height, width,
+              colAlignA, colStride, rowAlignA, rowStride,
+              portions, portionSize, BBuf, BLDim );
+          };
+    }
+    else if( colCollect )
+    {
+        request.unpack_ = [=]( const T* portions )
+          {
+            copy::util::ColStridedUnpack
+            ( height, localWidth, colAlignA, colStride,
+              portions, portionSize, BBuf, BLDim );
+          };
+    }
+    else if( rowCollect )
+    {
+        request.unpack_ = [=]( const T* portions )
+          {
+            copy::util::RowStridedUnpack
+            ( localHeight, width, rowAlignA, rowStride,
+              portions, portionSize, BBuf, BLDim );
+          };
+    }
+    else if( colPartial )
+    {
+        const Int colStrideUnion = A.PartialUnionColStride();
+        const Int colStridePart = A.PartialColStride();
+        const Int colRankPart = A.PartialColRank();
+        const Int colShiftB = B.ColShift();
+        request.unpack_ = [=]( const T* portions )
+          {
+            copy::util::PartialColStridedUnpack
+            ( height, localWidth,
+              colAlignA, colStride,
+              colStrideUnion, colStridePart, colRankPart, colShiftB,
+              portions, portionSize, BBuf, BLDim );
+          };
+    }
+    else
+    {
+        const Int rowStrideUnion = A.PartialUnionRowStride();
+        const Int rowStridePart = A.PartialRowStride();
+        const Int rowRankPart = A.PartialRowRank();
+        const Int rowShiftB = B.RowShift();
+        request.unpack_ = [=]( const T* portions )
+          {
+            copy::util::PartialRowStridedUnpack
+            ( localHeight, width,
+              rowAlignA, rowStride,
+              rowStrideUnion, rowStridePart, rowRankPart, rowShiftB,
+              portions, portionSize, BBuf, BLDim );
+          };
+    }
+    request.recvOffset_ = portionSize;
+    request.active_ = true;
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_ICOPY_HPP
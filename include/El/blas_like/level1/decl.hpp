@@ -629,6 +629,49 @@ void StridedUnpack
 } // namespace util
 } // namespace copy
 
+// Non-blocking redistribution
+// ===========================
+// A handle for a redistribution started by ICopy. Until Wait (or a successful
+// Test) returns, the source matrix must not be modified and the target matrix
+// must be neither read nor written.
+template<typename T>
+class CopyRequest
+{
+public:
+    CopyRequest() { }
+    ~CopyRequest();
+    CopyRequest( const CopyRequest<T>& request ) = delete;
+    const CopyRequest<T>& operator=( const CopyRequest<T>& request ) = delete;
+
+    // Return true, after completing the redistribution, if the communication
+    // has finished
+    bool Test();
+    // Block until the communication finishes and complete the redistribution
+    void Wait();
+    bool Active() const EL_NO_EXCEPT { return active_; }
+
+private:
+    bool active_=false;
+    mpi::Request<T> request_;
+    vector<T> buffer_;
+    Int recvOffset_=0;
+    function<void(const T*)> unpack_;
+
+    template<typename S>
+    friend void ICopy
+    ( const ElementalMatrix<S>& A, ElementalMatrix<S>& B,
+      CopyRequest<S>& request );
+};
+
+// Start redistributing A into B. Redistributions which only gather A over a
+// (partial) row and/or column communicator, e.g., [MC,MR] -> [MC,* ],
+// [MC,MR] -> [* ,* ], or [* ,VR] -> [* ,MR], are posted as non-blocking
+// AllGathers when B's alignments allow; all others complete immediately.
+template<typename T>
+void ICopy
+( const ElementalMatrix<T>& A, ElementalMatrix<T>& B,
+  CopyRequest<T>& request );
+
 // DiagonalScale
 // =============
 template<typename TDiag,typename T>
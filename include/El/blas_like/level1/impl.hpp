@@ -34,6 +34,7 @@
 #include <El/blas_like/level1/GetSubmatrix.hpp>
 #include <El/blas_like/level1/Givens.hpp>
 #include <El/blas_like/level1/Hadamard.hpp>
+#include <El/blas_like/level1/ICopy.hpp>
 #include <El/blas_like/level1/ImagPart.hpp>
 #include <El/blas_like/level1/IndexDependentFill.hpp>
 #include <El/blas_like/level1/IndexDependentMap.hpp>
@@ -53,6 +53,13 @@ void Gemm
   T alpha, const ElementalMatrix<T>& A, const ElementalMatrix<T>& B,
                  ElementalMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Independently update each matrix of a batch
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -461,6 +468,13 @@ void Trsm
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
 
+// Independently solve against each matrix of a batch
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B );
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side, UpperOrLower uplo,
@@ -17,6 +17,7 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -205,6 +206,7 @@ template<typename T> struct IsStdScalar<Complex<T>>
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Profile.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -243,6 +245,7 @@ class DistMatrix;
 #include <El/blas_like/level1/decl.hpp>
 
 #include <El/core/Matrix/impl.hpp>
+#include <El/core/HierComm.hpp>
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
@@ -256,6 +259,7 @@ class DistMatrix;
 // (perhaps these should be moved into their own directory?)
 #include <El/core/View/impl.hpp>
 #include <El/core/FlamePart.hpp>
+#include <El/core/MatrixBatch.hpp>
 #include <El/core/random/decl.hpp>
 #include <El/core/random/impl.hpp>
 
@@ -22,6 +22,17 @@ struct DistSparseMultMeta
                 recvSizes, recvOffs;
     vector<Int> sendInds, colOffs;
 
+    // The other processes which we exchange nonempty messages with
+    vector<int> sendRanks, recvRanks;
+
+    // The local entries split into those whose columns are owned by this
+    // process and those which require ghost entries, each stored in CSR form
+    // as lists of the original entry indices. The 'local' column indices are
+    // relative to the first locally-owned column, whereas the 'ghost' column
+    // indices are offsets into the received entries (as in colOffs).
+    vector<Int> localRowOffs, localEntries, localCols,
+                ghostRowOffs, ghostEntries, ghostCols;
+
     DistSparseMultMeta() : ready(false), numRecvInds(0) { }
 
     void Clear()
@@ -34,6 +45,14 @@ struct DistSparseMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( sendRanks );
+        SwapClear( recvRanks );
+        SwapClear( localRowOffs );
+        SwapClear( localEntries );
+        SwapClear( localCols );
+        SwapClear( ghostRowOffs );
+        SwapClear( ghostEntries );
+        SwapClear( ghostCols );
     }
 
     const DistSparseMultMeta& operator=( const DistSparseMultMeta& meta )
@@ -46,6 +65,14 @@ struct DistSparseMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        sendRanks = meta.sendRanks;
+        recvRanks = meta.recvRanks;
+        localRowOffs = meta.localRowOffs;
+        localEntries = meta.localEntries;
+        localCols = meta.localCols;
+        ghostRowOffs = meta.ghostRowOffs;
+        ghostEntries = meta.ghostEntries;
+        ghostCols = meta.ghostCols;
         return *this;
     }
 };
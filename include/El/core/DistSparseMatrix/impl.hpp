@@ -801,6 +801,55 @@ DistSparseMultMeta DistSparseMatrix<T>::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Only exchange messages with the processes we share columns with
+    const int commRank = distGraph_.commRank_;
+    SwapClear( meta.sendRanks );
+    SwapClear( meta.recvRanks );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( meta.sendSizes[q] > 0 )
+            meta.sendRanks.push_back( q );
+        if( meta.recvSizes[q] > 0 )
+            meta.recvRanks.push_back( q );
+    }
+
+    // Split the local entries into those which only touch locally-owned
+    // columns (and can be processed while the ghost entries are in flight)
+    // and those which touch ghost columns
+    const Int localHeight = LocalHeight();
+    const Int* offsetBuf = LockedOffsetBuffer();
+    const Int firstLocalCol = commRank*vecBlocksize;
+    const Int localColEnd = firstLocalCol + vecBlocksize;
+    meta.localRowOffs.resize( localHeight+1 );
+    meta.ghostRowOffs.resize( localHeight+1 );
+    meta.localEntries.clear();
+    meta.localCols.clear();
+    meta.ghostEntries.clear();
+    meta.ghostCols.clear();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        meta.localRowOffs[iLoc] = meta.localEntries.size();
+        meta.ghostRowOffs[iLoc] = meta.ghostEntries.size();
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            const Int j = colBuffer[e];
+            if( j >= firstLocalCol && j < localColEnd )
+            {
+                meta.localEntries.push_back( e );
+                meta.localCols.push_back( j-firstLocalCol );
+            }
+            else
+            {
+                meta.ghostEntries.push_back( e );
+                meta.ghostCols.push_back( meta.colOffs[e] );
+            }
+        }
+    }
+    meta.localRowOffs[localHeight] = meta.localEntries.size();
+    meta.ghostRowOffs[localHeight] = meta.ghostEntries.size();
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
@@ -100,6 +100,19 @@ template<typename T> struct IsPacked<ValueInt<T>>
 template<typename T> struct IsPacked<Entry<T>>
 { static const bool value=IsPacked<T>::value; };
 
+// MPFR's default precision is thread-local, so temporaries constructed within
+// OpenMP worker threads would silently use the default of 53 bits
+template<typename T> struct IsThreadSafe
+{ static const bool value=true; };
+#ifdef EL_HAVE_MPC
+template<> struct IsThreadSafe<BigInt>
+{ static const bool value=false; };
+template<> struct IsThreadSafe<BigFloat>
+{ static const bool value=false; };
+#endif
+template<typename T> struct IsThreadSafe<Complex<T>>
+{ static const bool value=IsThreadSafe<T>::value; };
+
 template<typename T> struct IsField
 { static const bool value=false; };
 template<> struct IsField<float>
@@ -159,6 +172,32 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename F> using Promote = typename PromoteHelper<F>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename F> struct DemoteHelper { typedef F type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+#ifdef EL_HAVE_MPC
+ #ifdef EL_HAVE_QD
+template<> struct DemoteHelper<BigFloat> { typedef QuadDouble type; };
+ #elif defined(EL_HAVE_QUAD)
+template<> struct DemoteHelper<BigFloat> { typedef Quad type; };
+ #else
+template<> struct DemoteHelper<BigFloat> { typedef double type; };
+ #endif
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename F> using Demote = typename DemoteHelper<F>::type;
+
 template<typename S,typename T>
 struct CanCast
 {   
@@ -86,6 +86,39 @@ public:
 
     static int FindFactor( int p ) EL_NO_EXCEPT;
 
+    // Node-aware interface
+    // --------------------
+    // Renumber the processes so that those sharing a node are contiguous and
+    // choose a grid shape so that each process column (row) of a column-major
+    // (row-major) grid either lies within a node or consists of whole nodes
+    explicit Grid( mpi::Comm comm, GridOrder order, bool nodeAware );
+    // The (approximately square) factor of p which either divides, or is a
+    // multiple of, the number of processes per node
+    static int FindNodeAwareFactor( int p, int nodeSize ) EL_NO_EXCEPT;
+
+    bool NodeAware() const EL_NO_EXCEPT;
+    int NodeRank() const EL_NO_RELEASE_EXCEPT;
+    int NodeSize() const EL_NO_EXCEPT;
+    int NumNodes() const EL_NO_EXCEPT;
+    mpi::Comm NodeComm() const EL_NO_EXCEPT;
+
+    // Collectives over one of the grid's communicators which, for node-aware
+    // grids, stage the intra-node traffic through shared memory whenever the
+    // communicator's processes are grouped by node (and otherwise fall back
+    // to the flat collectives)
+    template<typename T,typename=EnableIf<IsPacked<T>>>
+    void AllGather
+    ( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const;
+    template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+    void AllGather
+    ( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const;
+    template<typename T,typename=EnableIf<IsPacked<T>>>
+    void AllToAll
+    ( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const;
+    template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+    void AllToAll
+    ( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const;
+
     // To be used internally by Elemental
     static void InitializeDefault();
     static void FinalizeDefault(); 
@@ -118,7 +151,16 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    bool nodeAware_=false;
+    int nodeSize_=1;
+    mpi::Comm nodeComm_=mpi::COMM_NULL;
+    mpi::HierComm mcHier_, mrHier_, vcHier_, vrHier_;
+
     void SetUpGrid();
+    void SetUpNodes();
+    // Return the two-level decomposition of the given communicator, if it
+    // is both one of the grid's communicators and grouped by node
+    const mpi::HierComm* Hier( mpi::Comm comm ) const EL_NO_EXCEPT;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -127,6 +169,46 @@ private:
     Grid( const Grid& );
 };
 
+template<typename T,typename>
+void Grid::AllGather
+( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const
+{
+    DEBUG_CSE
+    const mpi::HierComm* hier = Hier( comm );
+    if( hier != nullptr && sc == rc )
+        hier->AllGather( sbuf, rbuf, sc );
+    else
+        mpi::AllGather( sbuf, sc, rbuf, rc, comm );
+}
+
+template<typename T,typename,typename>
+void Grid::AllGather
+( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const
+{
+    DEBUG_CSE
+    mpi::AllGather( sbuf, sc, rbuf, rc, comm );
+}
+
+template<typename T,typename>
+void Grid::AllToAll
+( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const
+{
+    DEBUG_CSE
+    const mpi::HierComm* hier = Hier( comm );
+    if( hier != nullptr && sc == rc )
+        hier->AllToAll( sbuf, rbuf, sc );
+    else
+        mpi::AllToAll( sbuf, sc, rbuf, rc, comm );
+}
+
+template<typename T,typename,typename>
+void Grid::AllToAll
+( const T* sbuf, int sc, T* rbuf, int rc, mpi::Comm comm ) const
+{
+    DEBUG_CSE
+    mpi::AllToAll( sbuf, sc, rbuf, rc, comm );
+}
+
 bool operator==( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 bool operator!=( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 
@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HIERCOMM_HPP
+#define EL_HIERCOMM_HPP
+
+namespace El {
+namespace mpi {
+
+// A two-level decomposition of a communicator into the sets of processes
+// which share a node. The collectives are only staged through a
+// shared-memory window when every node holds a contiguous, equally-sized
+// range of at least two ranks (and MPI-3 is available); the first process
+// of each node then performs the inter-node stage on behalf of the node.
+class HierComm
+{
+public:
+    HierComm() { }
+    ~HierComm();
+
+    // Collective over 'comm' (which must outlive this object)
+    void Setup( Comm comm );
+    void Clear();
+
+    bool Active() const EL_NO_EXCEPT { return active_; }
+    Comm NodeComm() const EL_NO_EXCEPT { return nodeComm_; }
+    Comm LeaderComm() const EL_NO_EXCEPT { return leaderComm_; }
+    int NodeRank() const EL_NO_EXCEPT { return nodeRank_; }
+    int NodeSize() const EL_NO_EXCEPT { return nodeSize_; }
+    int NumNodes() const EL_NO_EXCEPT { return numNodes_; }
+
+    // Each process contributes 'count' entries
+    template<typename T>
+    void AllGather( const T* sbuf, T* rbuf, int count ) const;
+    // Each process sends 'count' entries to every process
+    template<typename T>
+    void AllToAll( const T* sbuf, T* rbuf, int count ) const;
+
+private:
+    bool active_=false;
+    Comm comm_=COMM_NULL, nodeComm_=COMM_NULL, leaderComm_=COMM_NULL;
+    int rank_=0, size_=1, nodeRank_=0, nodeSize_=1, numNodes_=1;
+
+    // The shared window is only ever grown, which requires all of the
+    // processes of the node to agree upon the requested size
+    mutable Window window_=WIN_NULL;
+    mutable size_t windowBytes_=0;
+    mutable byte* windowBuf_=nullptr;
+
+    byte* SharedBuffer( size_t numBytes ) const;
+    void Fence() const;
+
+    // The communicators and window cannot be shared between copies
+    const HierComm& operator=( const HierComm& );
+    HierComm( const HierComm& );
+};
+
+template<typename T>
+void HierComm::AllGather( const T* sbuf, T* rbuf, int count ) const
+{
+    DEBUG_CSE
+    T* shared =
+      reinterpret_cast<T*>(SharedBuffer( size_t(size_)*count*sizeof(T) ));
+
+    // Stage our contribution in the node's window
+    MemCopy( &shared[size_t(rank_)*count], sbuf, count );
+    Fence();
+
+    // Exchange the node blocks between the node leaders
+    if( nodeRank_ == 0 && numNodes_ > 1 )
+    {
+        const int blockSize = nodeSize_*count;
+        const int node = rank_ / nodeSize_;
+        vector<T> nodeBlock( blockSize );
+        MemCopy
+        ( nodeBlock.data(), &shared[size_t(node)*blockSize], blockSize );
+        mpi::AllGather
+        ( nodeBlock.data(), blockSize, shared, blockSize, leaderComm_ );
+    }
+    Fence();
+
+    MemCopy( rbuf, shared, size_t(size_)*count );
+    Fence();
+}
+
+template<typename T>
+void HierComm::AllToAll( const T* sbuf, T* rbuf, int count ) const
+{
+    DEBUG_CSE
+    // Each half of the window is organized as
+    //   [destination node][source node rank][destination node rank],
+    // so that the inter-node stage exchanges contiguous blocks
+    const size_t halfSize = size_t(nodeSize_)*size_*count;
+    const int numHalves = ( numNodes_ > 1 ? 2 : 1 );
+    T* sendShared =
+      reinterpret_cast<T*>(SharedBuffer( numHalves*halfSize*sizeof(T) ));
+    T* recvShared = ( numNodes_ > 1 ? &sendShared[halfSize] : sendShared );
+    const size_t nodeBlock = size_t(nodeSize_)*nodeSize_*count;
+
+    // Every process scatters its own portions into the window
+    for( int dest=0; dest<size_; ++dest )
+    {
+        const int destNode = dest / nodeSize_;
+        const int destNodeRank = dest % nodeSize_;
+        MemCopy
+        ( &sendShared[destNode*nodeBlock+
+                      (size_t(nodeRank_)*nodeSize_+destNodeRank)*count],
+          &sbuf[size_t(dest)*count], count );
+    }
+    Fence();
+
+    if( nodeRank_ == 0 && numNodes_ > 1 )
+        mpi::AllToAll
+        ( sendShared, int(nodeBlock), recvShared, int(nodeBlock),
+          leaderComm_ );
+    Fence();
+
+    // Every process gathers the portions destined for it
+    for( int source=0; source<size_; ++source )
+    {
+        const int sourceNode = source / nodeSize_;
+        const int sourceNodeRank = source % nodeSize_;
+        MemCopy
+        ( &rbuf[size_t(source)*count],
+          &recvShared[sourceNode*nodeBlock+
+                      (size_t(sourceNodeRank)*nodeSize_+nodeRank_)*count],
+          count );
+    }
+    Fence();
+}
+
+} // namespace mpi
+} // namespace El
+
+#endif // ifndef EL_HIERCOMM_HPP
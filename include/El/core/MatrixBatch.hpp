@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_MATRIXBATCH_HPP
+#define EL_CORE_MATRIXBATCH_HPP
+
+namespace El {
+
+namespace BatchLayoutNS {
+enum BatchLayout {
+  // Matrix b is stored column-major starting at buffer + b*stride
+  BATCH_STRIDED,
+  // Matrix b is stored column-major starting at buffers[b]
+  BATCH_POINTERS,
+  // Entry (i,j) of matrix b is stored at buffer[(i+j*ldim)*batchSize+b], so
+  // that the batched kernels can vectorize across the matrices
+  BATCH_INTERLEAVED
+};
+}
+using namespace BatchLayoutNS;
+
+// The number of consecutive interleaved matrices which the batched kernels
+// process in lock-step (and the granularity of their threading)
+const Int batchLaneBlock = 16;
+
+// A collection of independent matrices of the same dimensions, as operated
+// on by the batched variants of Gemm, Trsm, LU, Cholesky, and LDL, which
+// avoid the per-call overhead of processing many small matrices one at a time
+template<typename T>
+class MatrixBatch
+{
+public:
+    MatrixBatch() { }
+    MatrixBatch
+    ( Int height, Int width, Int batchSize,
+      BatchLayout layout=BATCH_STRIDED )
+    { Resize( height, width, batchSize, layout ); }
+
+    // Allocate (contiguous) storage for the batch
+    void Resize
+    ( Int height, Int width, Int batchSize,
+      BatchLayout layout=BATCH_STRIDED )
+    {
+        DEBUG_CSE
+        if( layout == BATCH_POINTERS )
+            LogicError("Pointer-array batches must be attached");
+        if( height < 0 || width < 0 || batchSize < 0 )
+            LogicError("Batch dimensions must be non-negative");
+        height_ = height;
+        width_ = width;
+        batchSize_ = batchSize;
+        ldim_ = Max(height,Int(1));
+        stride_ = ( layout == BATCH_STRIDED ? ldim_*width : 1 );
+        layout_ = layout;
+        buffers_ = nullptr;
+        viewing_ = false;
+        buffer_ = memory_.Require( ldim_*width*batchSize );
+    }
+
+    // Reconfigure around externally-owned storage
+    // -------------------------------------------
+    void Attach
+    ( Int height, Int width, Int batchSize, T* buffer, Int ldim, Int stride )
+    {
+        DEBUG_CSE
+        if( ldim < Max(height,Int(1)) )
+            LogicError("Leading dimension was too small");
+        Reset( height, width, batchSize, ldim, BATCH_STRIDED );
+        buffer_ = buffer;
+        stride_ = stride;
+    }
+    void Attach
+    ( Int height, Int width, Int batchSize, T* const* buffers, Int ldim )
+    {
+        DEBUG_CSE
+        if( ldim < Max(height,Int(1)) )
+            LogicError("Leading dimension was too small");
+        Reset( height, width, batchSize, ldim, BATCH_POINTERS );
+        buffers_ = buffers;
+    }
+    void AttachInterleaved
+    ( Int height, Int width, Int batchSize, T* buffer, Int ldim )
+    {
+        DEBUG_CSE
+        if( ldim < Max(height,Int(1)) )
+            LogicError("Leading dimension was too small");
+        Reset( height, width, batchSize, ldim, BATCH_INTERLEAVED );
+        buffer_ = buffer;
+    }
+
+    // Basic queries
+    // -------------
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int BatchSize() const EL_NO_EXCEPT { return batchSize_; }
+    Int LDim() const EL_NO_EXCEPT { return ldim_; }
+    BatchLayout Layout() const EL_NO_EXCEPT { return layout_; }
+    bool Viewing() const EL_NO_EXCEPT { return viewing_; }
+
+    // The distances between entry (i,j) of a matrix and entries (i+1,j) and
+    // (i,j+1), respectively
+    Int RowInc() const EL_NO_EXCEPT
+    { return layout_ == BATCH_INTERLEAVED ? batchSize_ : 1; }
+    Int ColInc() const EL_NO_EXCEPT
+    { return layout_ == BATCH_INTERLEAVED ? ldim_*batchSize_ : ldim_; }
+
+    // The number of consecutive matrices which share a single set of
+    // increments (and which are therefore processed in lock-step)
+    Int LaneBlock() const EL_NO_EXCEPT
+    { return layout_ == BATCH_INTERLEAVED ? batchLaneBlock : 1; }
+
+    // Return a pointer to entry (i,j) of matrix b
+    T* Buffer( Int b, Int i=0, Int j=0 ) EL_NO_RELEASE_EXCEPT
+    {
+        DEBUG_ONLY(AssertIndex( b, i, j ))
+        return Base(b) + i*RowInc() + j*ColInc();
+    }
+    const T*
+    LockedBuffer( Int b, Int i=0, Int j=0 ) const EL_NO_RELEASE_EXCEPT
+    {
+        DEBUG_ONLY(AssertIndex( b, i, j ))
+        return Base(b) + i*RowInc() + j*ColInc();
+    }
+
+    T Get( Int i, Int j, Int b ) const EL_NO_RELEASE_EXCEPT
+    { return *LockedBuffer( b, i, j ); }
+    void Set( Int i, Int j, Int b, T alpha ) EL_NO_RELEASE_EXCEPT
+    { *Buffer( b, i, j ) = alpha; }
+
+    // View a single matrix of a non-interleaved batch
+    void View( Int b, Matrix<T>& A )
+    {
+        DEBUG_CSE
+        if( layout_ == BATCH_INTERLEAVED )
+            LogicError("Cannot view a matrix of an interleaved batch");
+        A.Attach( height_, width_, Buffer(b), ldim_ );
+    }
+    void LockedView( Int b, Matrix<T>& A ) const
+    {
+        DEBUG_CSE
+        if( layout_ == BATCH_INTERLEAVED )
+            LogicError("Cannot view a matrix of an interleaved batch");
+        A.LockedAttach( height_, width_, LockedBuffer(b), ldim_ );
+    }
+
+private:
+    Int height_=0, width_=0, batchSize_=0, ldim_=1, stride_=0;
+    BatchLayout layout_=BATCH_STRIDED;
+    bool viewing_=false;
+    T* buffer_=nullptr;
+    T* const* buffers_=nullptr;
+    Memory<T> memory_;
+
+    void Reset
+    ( Int height, Int width, Int batchSize, Int ldim, BatchLayout layout )
+    {
+        if( height < 0 || width < 0 || batchSize < 0 )
+            LogicError("Batch dimensions must be non-negative");
+        memory_.Empty();
+        height_ = height;
+        width_ = width;
+        batchSize_ = batchSize;
+        ldim_ = ldim;
+        stride_ = 1;
+        layout_ = layout;
+        viewing_ = true;
+        buffer_ = nullptr;
+        buffers_ = nullptr;
+    }
+
+    T* Base( Int b ) const EL_NO_EXCEPT
+    {
+        if( layout_ == BATCH_STRIDED )
+            return buffer_ + b*stride_;
+        else if( layout_ == BATCH_POINTERS )
+            return buffers_[b];
+        else
+            return buffer_ + b;
+    }
+
+    void AssertIndex( Int b, Int i, Int j ) const
+    {
+        if( b < 0 || b >= batchSize_ || i < 0 || i > height_ ||
+            j < 0 || j > width_ )
+            LogicError
+            ("Index (",i,",",j,") of matrix ",b," is out of bounds of a ",
+             batchSize_," batch of ",height_," x ",width_," matrices");
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_MATRIXBATCH_HPP
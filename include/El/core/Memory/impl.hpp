@@ -11,19 +11,44 @@ namespace El {
 
 namespace {
 
+// The buffers are obtained from the (aligned and pooled) allocation layer
+// and their entries are then constructed in place
 template<typename G>
 static G* New( size_t size )
 {
-    return new G[size];
+    G* ptr = static_cast<G*>( AllocateBytes( size*sizeof(G) ) );
+    for( size_t i=0; i<size; ++i )
+        new (&ptr[i]) G;
+    return ptr;
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size )
 {
-    delete[] ptr;
+    if( ptr == nullptr )
+        return;
+    for( size_t i=0; i<size; ++i )
+        ptr[i].~G();
+    FreeBytes( ptr, size*sizeof(G) );
     ptr = nullptr;
 }
 
+#ifdef EL_HAVE_MPC
+// Arrays of BigFloat can optionally store all of their limbs contiguously
+template<>
+BigFloat* New<BigFloat>( size_t size )
+{
+    return mpfr::NewBigFloatArray( size );
+}
+
+template<>
+void Delete<BigFloat>( BigFloat*& ptr, size_t size )
+{
+    mpfr::DeleteBigFloatArray( ptr );
+    ptr = nullptr;
+}
+#endif
+
 } // anonymous namespace
 
 template<typename G>
@@ -56,7 +81,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +95,12 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -110,7 +134,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
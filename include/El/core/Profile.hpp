@@ -0,0 +1,98 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+namespace ProfileFormatNS {
+enum ProfileFormat
+{
+    PROFILE_JSON,        // Per-routine statistics aggregated over processes
+    PROFILE_CHROME_TRACE // A timeline viewable with chrome://tracing
+};
+}
+using namespace ProfileFormatNS;
+
+// Hot-path instrumentation of the public routines (e.g., Gemm, Trsm, LU, LDL,
+// the redistributions within Copy, and the MPI wrappers), which records the
+// wall time, number of calls, and flops and bytes communicated of each.
+//
+// The instrumentation is only compiled in if Elemental was configured with
+// EL_PROFILE (otherwise the EL_PROFILE_* macros expand to nothing and the
+// following routines have no effect). The collected profile is written at
+// Finalize if an output file was specified, either through SetOutput or the
+// EL_PROFILE_OUTPUT environment variable (with EL_PROFILE_FORMAT set to
+// either "json" or "chrome").
+//
+// Flops and bytes are attributed to the innermost active routine, whereas
+// times are reported both inclusive and exclusive of nested routines. Only
+// the master thread of each process records events.
+namespace profile {
+
+// Temporarily enable or disable the collection of events
+void Enable( bool enable=true );
+void Disable();
+bool Enabled();
+
+// The file (and its format) to write the profile to during Finalize
+void SetOutput( const string& filename, ProfileFormat format=PROFILE_JSON );
+
+// The maximum number of timeline events stored per process for Chrome traces
+void SetTraceLimit( Int limit );
+Int TraceLimit();
+
+// Collectively write the profile gathered over mpi::COMM_WORLD
+void Write( const string& filename, ProfileFormat format=PROFILE_JSON );
+
+// Discard all of the collected statistics
+void Reset();
+
+// The statistics recorded by this process for a single routine
+struct Counters
+{
+    Int calls=0;
+    double time=0, exclusiveTime=0, flops=0, bytesSent=0, bytesReceived=0;
+};
+Counters LocalCounters( const string& name );
+
+void AddFlops( double flops );
+void AddBytes( double bytesSent, double bytesReceived );
+
+// Records an event for the routine with the given (static) name over the
+// lifetime of the object
+class Region
+{
+public:
+    Region( const char* name );
+    ~Region();
+private:
+    bool active_;
+};
+
+void Initialize();
+void Finalize();
+
+} // namespace profile
+
+} // namespace El
+
+#ifdef EL_PROFILE
+# define EL_PROFILE_REGION(name) El::profile::Region elProfileRegion(name)
+# define EL_PROFILE_FLOPS(flops) El::profile::AddFlops(flops)
+# define EL_PROFILE_COMM(name,bytesSent,bytesReceived) \
+    El::profile::Region elProfileRegion(name); \
+    El::profile::AddBytes(bytesSent,bytesReceived)
+#else
+# define EL_PROFILE_REGION(name)
+# define EL_PROFILE_FLOPS(flops)
+# define EL_PROFILE_COMM(name,bytesSent,bytesReceived)
+#endif
+
+#endif // ifndef EL_PROFILE_HPP
@@ -93,6 +93,61 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For configuring the allocation of the buffers of Memory<G> (and therefore
+// of every matrix). Freed buffers are cached in per-thread pools of
+// power-of-two size classes so that the temporaries of blocked algorithms
+// do not repeatedly hit the system allocator.
+
+// A replacement for the underlying allocator. The allocation routine must
+// return at least the requested number of bytes with at least the requested
+// alignment (or throw), and the free routine receives the same byte count.
+// Each buffer is returned to the allocator which produced it, even if the
+// allocator has since been changed.
+typedef function<void*(size_t numBytes,size_t alignment)> AllocateFunction;
+typedef function<void(void* buffer,size_t numBytes)> FreeFunction;
+void SetAllocator( AllocateFunction allocate, FreeFunction free );
+void ResetAllocator();
+
+// The alignment (a power of two) of each buffer. Default: 64 bytes
+void SetMemoryAlignment( size_t alignment );
+size_t MemoryAlignment();
+
+// Whether freed buffers are cached for reuse. Default: true
+void SetMemoryPooling( bool pooling );
+bool MemoryPooling();
+
+// The maximum number of bytes cached by each thread's pool (larger requests
+// bypass the pools). The cached buffers are only returned to the allocator
+// by ReleaseMemoryPool(s), so, since every thread which frees buffers keeps
+// its own pool, the default is kept small. Default: 4 MB
+void SetMemoryPoolLimit( size_t numBytes );
+size_t MemoryPoolLimit();
+
+// Return the buffers cached by the calling thread to the allocator
+void ReleaseMemoryPool();
+// Also release the pools of the threads of an OpenMP team (which is called
+// by Finalize)
+void ReleaseMemoryPools();
+
+// Whether newly-allocated buffers spanning several pages are first touched
+// (zeroed) by the OpenMP threads in a static schedule so that the pages are
+// placed in the NUMA domains of the threads which use them. Default: false
+void SetFirstTouch( bool firstTouch );
+bool FirstTouch();
+
+// Counters for the number of bytes held by live buffers, its high-water mark,
+// the number of bytes cached in the pools, and the number of requests which
+// had to be passed to the underlying allocator
+size_t MemoryInUse();
+size_t PeakMemoryInUse();
+size_t MemoryPooled();
+size_t NumSystemAllocations();
+void ResetPeakMemoryInUse();
+
+// For internal usage by Memory<G>
+void* AllocateBytes( size_t numBytes );
+void FreeBytes( void* buffer, size_t numBytes );
+
 template<typename T,typename=EnableIf<IsScalar<T>>>
 inline const T& Max( const T& m, const T& n ) EL_NO_EXCEPT
 { return std::max(m,n); }
@@ -31,6 +31,18 @@ int NumIntBits();
 int NumIntLimbs();
 void SetMinIntBits( int minIntBits );
 
+// Whether or not newly-allocated arrays of BigFloat (e.g., the buffer of a
+// Matrix<BigFloat>) place the limbs of all of their entries in a single,
+// contiguous, aligned arena rather than in separate heap allocations.
+// The arena is sized for the precision at the time of allocation.
+// NOTE: Serialization (and hence MPI packing) still writes the precision,
+//       sign, and exponent of each entry next to its limbs, as they live
+//       within the BigFloat objects rather than the arena, so packing an
+//       arena-backed buffer is not a single memcpy.
+// Default: false
+void SetContiguousLimbs( bool contiguous );
+bool ContiguousLimbs();
+
 // NOTE: These should only be called internally
 void RegisterMPI();
 void FreeMPI();
@@ -321,6 +333,8 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    // False if the limbs are stored in an external arena
+    bool ownsLimbs_;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
@@ -333,6 +347,7 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        OwnsLimbs() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
@@ -360,6 +375,10 @@ public:
     BigFloat
     ( const std::string& str, int base, mpfr_prec_t prec=mpfr::Precision() );
     BigFloat( BigFloat&& a );
+    // Construct (as NaN) over external storage for the limbs of the given
+    // precision, which must outlive this object. Moves into or out of such
+    // a BigFloat copy the value rather than exchanging the limbs.
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec );
     ~BigFloat();
 
     void Zero();
@@ -649,6 +668,15 @@ bool operator!=( const BigFloat& a, const BigFloat& b );
 std::ostream& operator<<( std::ostream& os, const BigFloat& alpha );
 std::istream& operator>>( std::istream& is,       BigFloat& alpha );
 
+namespace mpfr {
+
+// Allocate and free arrays of BigFloat with the current precision (with
+// contiguous limbs if ContiguousLimbs() is true)
+BigFloat* NewBigFloatArray( size_t size );
+void DeleteBigFloatArray( BigFloat* array );
+
+} // namespace mpfr
+
 } // namespace El
 #endif // ifdef EL_HAVE_MPC
 
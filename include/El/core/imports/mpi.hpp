@@ -20,6 +20,9 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#ifndef EL_HAVE_NONBLOCKING_COLLECTIVES
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
+#endif
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -81,6 +84,7 @@ typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
+typedef MPI_Win Window;
 
 template<typename T>
 struct Request
@@ -89,7 +93,7 @@ struct Request
 
     MPI_Request backend;
 
-    vector<byte> buffer;
+    vector<byte> buffer, sendBuffer;
     bool receivingPacked=false;
     int recvCount;
     T* unpackedRecvBuf;
@@ -114,6 +118,7 @@ const Group GROUP_NULL = MPI_GROUP_NULL;
 const Comm COMM_NULL = MPI_COMM_NULL;
 const Comm COMM_SELF = MPI_COMM_SELF;
 const Comm COMM_WORLD = MPI_COMM_WORLD;
+const Window WIN_NULL = MPI_WIN_NULL;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
@@ -203,6 +208,21 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// Split into sets of processes which can share memory (i.e., nodes); each
+// process is its own set if MPI-3 is not available
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+
+// Shared-memory windows over processes which share a node (requires MPI-3)
+// ------------------------------------------------------------------------
+bool HaveSharedWindows() EL_NO_EXCEPT;
+// Collectively allocate a window where this process owns numBytes bytes
+void WindowAllocateShared
+( size_t numBytes, Comm comm, Window& window ) EL_NO_RELEASE_EXCEPT;
+// Return the base of the segment of the window owned by the given rank
+byte* WindowSharedQuery( Window window, int rank ) EL_NO_RELEASE_EXCEPT;
+// Synchronize the window and make all updates of its memory visible
+void WindowFence( Window window ) EL_NO_RELEASE_EXCEPT;
+void WindowFree( Window& window ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
@@ -635,6 +655,24 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+// NOTE: If Elemental was not configured with non-blocking collectives, these
+//       fall back to the blocking AllGather and return a null request
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -887,6 +925,25 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking single-buffer AllReduce
+// ------------------------------------
+// NOTE: If Elemental was not configured with non-blocking collectives, the
+//       reduction is performed eagerly and the request is null
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
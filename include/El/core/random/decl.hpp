@@ -99,6 +99,61 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// The Philox4x32-10 generator of
+//
+//   John K. Salmon, Mark A. Moraes, Ron O. Dror, and David E. Shaw,
+//   "Parallel random numbers: as easy as 1, 2, 3", SC11, 2011,
+//
+// maps a 128-bit counter and a 64-bit key to 128 random bits without any
+// internal state. Using the global indices (i,j) of a matrix entry as the
+// counter allows each entry to be sampled independently of all others, so
+// that random matrices can be filled in parallel and are identical for any
+// distribution over any process grid.
+inline std::array<std::uint32_t,4> Philox4x32
+( std::array<std::uint32_t,4> counter, std::array<std::uint32_t,2> key );
+
+// The 128 random bits associated with entry (i,j) for the given key
+inline void CounterBits
+( std::uint64_t key, Int i, Int j, std::uint64_t& bits0, std::uint64_t& bits1 );
+
+// Samples from the same distributions as SampleBall and SampleNormal
+// determined by (key,i,j). Only the types natively supported by the STL's
+// math are supported, as the samples are derived from (53-bit) doubles.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>,
+         typename=DisableIf<IsIntegral<Real>>>
+Real CounterSampleBall
+( std::uint64_t key, Int i, Int j, const Real& center, const Real& radius );
+template<typename T,
+         typename=EnableIf<IsIntegral<T>>,
+         typename=void,
+         typename=void>
+T CounterSampleBall
+( std::uint64_t key, Int i, Int j, const T& center, const T& radius );
+template<typename F,
+         typename=EnableIf<IsComplex<F>>,
+         typename=void,
+         typename=void,
+         typename=void>
+F CounterSampleBall
+( std::uint64_t key, Int i, Int j, const F& center, const Base<F>& radius );
+
+template<typename F>
+F CounterSampleNormal
+( std::uint64_t key, Int i, Int j, const F& mean, const Base<F>& stddev );
+
+// The random matrix generators draw a new key for each call; distributed
+// generators combine the global counter seed with a stream index which all
+// of the processes in 'comm' agree upon (so that the same sequence of calls
+// produces the same matrices regardless of the process grid), whereas
+// sequential generators draw their key from the per-process Generator().
+void SetCounterSeed( std::uint64_t seed );
+std::uint64_t CounterSeed();
+std::uint64_t NextCounterKey( mpi::Comm comm );
+std::uint64_t LocalCounterKey();
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
@@ -223,6 +223,117 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline std::array<std::uint32_t,4> Philox4x32
+( std::array<std::uint32_t,4> counter, std::array<std::uint32_t,2> key )
+{
+    const std::uint32_t multiplier0 = 0xD2511F53, multiplier1 = 0xCD9E8D57;
+    const std::uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+    for( Int round=0; round<10; ++round )
+    {
+        const std::uint64_t product0 = std::uint64_t(multiplier0)*counter[0];
+        const std::uint64_t product1 = std::uint64_t(multiplier1)*counter[2];
+        const std::uint32_t hi0 = std::uint32_t(product0 >> 32);
+        const std::uint32_t lo0 = std::uint32_t(product0);
+        const std::uint32_t hi1 = std::uint32_t(product1 >> 32);
+        const std::uint32_t lo1 = std::uint32_t(product1);
+        counter[0] = hi1 ^ counter[1] ^ key[0];
+        counter[1] = lo1;
+        counter[2] = hi0 ^ counter[3] ^ key[1];
+        counter[3] = lo0;
+        key[0] += weyl0;
+        key[1] += weyl1;
+    }
+    return counter;
+}
+
+inline void CounterBits
+( std::uint64_t key, Int i, Int j, std::uint64_t& bits0, std::uint64_t& bits1 )
+{
+    const std::uint64_t i64 = std::uint64_t(i), j64 = std::uint64_t(j);
+    const std::array<std::uint32_t,4> counter =
+      { { std::uint32_t(i64), std::uint32_t(i64 >> 32),
+          std::uint32_t(j64), std::uint32_t(j64 >> 32) } };
+    const std::array<std::uint32_t,2> keyWords =
+      { { std::uint32_t(key), std::uint32_t(key >> 32) } };
+    const auto result = Philox4x32( counter, keyWords );
+    bits0 = (std::uint64_t(result[1]) << 32) | result[0];
+    bits1 = (std::uint64_t(result[3]) << 32) | result[2];
+}
+
+namespace counter_random {
+
+// Map 64 random bits to [0,1) using as many bits as the mantissa allows
+template<typename Real>
+inline Real Unit( std::uint64_t bits )
+{ return Real( double(bits >> 11)*(1./9007199254740992.) ); }
+
+template<>
+inline float Unit<float>( std::uint64_t bits )
+{ return float(bits >> 40)*(1.f/16777216.f); }
+
+} // namespace counter_random
+
+template<typename Real,typename,typename>
+Real CounterSampleBall
+( std::uint64_t key, Int i, Int j, const Real& center, const Real& radius )
+{
+    std::uint64_t bits0, bits1;
+    CounterBits( key, i, j, bits0, bits1 );
+    const Real u = counter_random::Unit<Real>( bits0 );
+    return center + radius*(2*u-1);
+}
+
+template<typename T,typename,typename,typename>
+T CounterSampleBall
+( std::uint64_t key, Int i, Int j, const T& center, const T& radius )
+{
+    std::uint64_t bits0, bits1;
+    CounterBits( key, i, j, bits0, bits1 );
+    // Sample from [center-radius,center+radius) as in SampleUniform
+    const std::uint64_t width = std::uint64_t(2*radius);
+    if( width == 0 )
+        return center;
+    return (center-radius) + T(bits0 % width);
+}
+
+template<typename F,typename,typename,typename,typename>
+F CounterSampleBall
+( std::uint64_t key, Int i, Int j, const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    std::uint64_t bits0, bits1;
+    CounterBits( key, i, j, bits0, bits1 );
+    const Real r = radius*counter_random::Unit<Real>( bits0 );
+    const Real angle = 2*Pi<Real>()*counter_random::Unit<Real>( bits1 );
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename F>
+F CounterSampleNormal
+( std::uint64_t key, Int i, Int j, const F& mean, const Base<F>& stddev )
+{
+    typedef Base<F> Real;
+    std::uint64_t bits0, bits1;
+    CounterBits( key, i, j, bits0, bits1 );
+
+    // Run the Box-Muller transform on (0,1] x [0,1)
+    const Real u0 = 1 - counter_random::Unit<Real>( bits0 );
+    const Real u1 = counter_random::Unit<Real>( bits1 );
+    const Real rho = Sqrt(-2*Log(u0));
+    const Real angle = 2*Pi<Real>()*u1;
+
+    F sample;
+    if( IsComplex<F>::value )
+    {
+        const Real stddevAdj = stddev / Sqrt(Real(2));
+        SetRealPart( sample, RealPart(mean) + stddevAdj*rho*Cos(angle) );
+        SetImagPart( sample, ImagPart(mean) + stddevAdj*rho*Sin(angle) );
+    }
+    else
+        SetRealPart( sample, RealPart(mean) + stddev*rho*Cos(angle) );
+    return sample;
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
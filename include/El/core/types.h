@@ -239,6 +239,7 @@ typedef enum {
   EL_ASCII_MATLAB,
   EL_BINARY,
   EL_BINARY_FLAT,
+  EL_BINARY_SPARSE,
   EL_BMP,
   EL_JPG,
   EL_JPEG,
@@ -488,6 +488,7 @@ enum FileFormat
     ASCII_MATLAB,
     BINARY,
     BINARY_FLAT,
+    BINARY_SPARSE,
     BMP,
     JPG,
     JPEG,
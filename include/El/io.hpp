@@ -120,6 +120,15 @@ void Read
 ( AbstractDistMatrix<T>& A, 
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Sparse matrices can be read from BINARY_SPARSE files and from coordinate
+// Matrix Market files (in which case each process of a DistSparseMatrix
+// parses a contiguous portion of the file)
+template<typename T>
+void Read( SparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
+template<typename T>
+void Read
+( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
+
 // Spy
 // ===
 template<typename T>
@@ -139,6 +148,68 @@ void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
 
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  FileFormat format=BINARY_SPARSE );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  FileFormat format=BINARY_SPARSE );
+
+// Memory-mapped files
+// ===================
+namespace MappingModeNS {
+enum MappingMode
+{
+    MAPPED_READ_ONLY,
+    MAPPED_READ_WRITE,
+    MAPPED_CREATE // create (or overwrite) a file of the given dimensions
+};
+}
+using namespace MappingModeNS;
+
+// Map a BINARY or BINARY_FLAT file into memory so that its entries can be
+// viewed by a Matrix without being copied. The dimensions of a BINARY_FLAT
+// file, and of any created file, must be specified. Modifications made
+// through a writable view are written back to the file by Flush and upon
+// destruction, and the views must not outlive the mapping. If the entries of
+// the file are not aligned for T (as in original-revision BINARY files with a
+// 32-bit Int), they are copied into memory instead of being mapped.
+template<typename T>
+class MappedFile
+{
+public:
+    MappedFile
+    ( const string filename, MappingMode mode=MAPPED_READ_ONLY,
+      FileFormat format=AUTO, Int height=-1, Int width=-1 );
+    ~MappedFile();
+
+    MappedFile( const MappedFile<T>& ) = delete;
+    const MappedFile<T>& operator=( const MappedFile<T>& ) = delete;
+
+    Int Height() const { return height_; }
+    Int Width() const { return width_; }
+    bool Writable() const { return mode_ != MAPPED_READ_ONLY; }
+
+    void View( Matrix<T>& A );
+    void LockedView( Matrix<T>& A ) const;
+
+    // Synchronously write any modifications back to the file
+    void Flush();
+
+private:
+    string filename_;
+    MappingMode mode_;
+    Int height_=0, width_=0;
+    int fd_=-1;
+    void* base_=nullptr;
+    Int mappedBytes_=0, dataOffset_=0;
+    // A copy of misaligned entries
+    vector<T> buffer_;
+    T* data_=nullptr;
+};
+
 } // namespace El
 
 #ifdef EL_HAVE_QT5
@@ -26,6 +26,10 @@ void Cholesky
 template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
 
+// Independently factor each (small) matrix of a batch
+template<typename F>
+void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A );
+
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
@@ -143,6 +147,9 @@ template<typename F>
 void LDL( ElementalMatrix<F>& A, bool conjugate );
 template<typename F>
 void LDL( DistMatrix<F,STAR,STAR>& A, bool conjugate );
+// Independently factor each (small) matrix of a batch
+template<typename F>
+void LDL( MatrixBatch<F>& A, bool conjugate );
 
 // Return an implicit representation of a pivoted LDL factorization of A
 // ---------------------------------------------------------------------
@@ -286,6 +293,18 @@ void SolveAfter
 
 // Solve a linear system with a regularized factorization
 // ======================================================
+// The orthogonalization scheme used within the Arnoldi process of the
+// GMRES variants (see El/lapack_like/solve/GramSchmidt.hpp)
+namespace GramSchmidtAlgNS {
+enum GramSchmidtAlg
+{
+  GRAM_SCHMIDT_MODIFIED,
+  GRAM_SCHMIDT_CLASSICAL_REORTH,
+  GRAM_SCHMIDT_ONE_REDUCE
+};
+}
+using namespace GramSchmidtAlgNS;
+
 enum RegSolveAlg
 {
   REG_SOLVE_FGMRES,
@@ -304,6 +323,13 @@ struct RegSolveCtrl
     bool progress=false;
     bool time=false;
 
+    GramSchmidtAlg orthog=GRAM_SCHMIDT_CLASSICAL_REORTH;
+    // Overlap the (single) reduction of each Arnoldi step of the
+    // distributed solvers with the next preconditioner application and
+    // matrix-vector product. LGMRES then assumes that the preconditioner is
+    // linear, which only holds approximately when relTolRefine is loose.
+    bool pipeline=false;
+
     RegSolveCtrl()
     {
         const Real eps = limits::Epsilon<Real>(); 
@@ -481,6 +507,9 @@ template<typename F>
 void LU( ElementalMatrix<F>& A );
 template<typename F>
 void LU( DistMatrix<F,STAR,STAR>& A );
+// Independently factor each (small) matrix of a batch
+template<typename F>
+void LU( MatrixBatch<F>& A );
 
 // LU with partial pivoting
 // ------------------------
@@ -488,6 +517,10 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
 void LU( ElementalMatrix<F>& A, DistPermutation& P );
+// Column b of 'pivots' holds the LAPACK-style sequence of row swaps (with
+// zero-based indices) applied to matrix b of the batch
+template<typename F>
+void LU( MatrixBatch<F>& A, Matrix<Int>& pivots );
 
 // LU with full pivoting
 // ---------------------
@@ -710,6 +743,21 @@ void QR
   DistPermutation& Omega,
   const QRCtrl<Base<F>>& ctrl=QRCtrl<Base<F>>() );
 
+// The shape of the reduction tree used by tall-skinny QR
+// ------------------------------------------------------
+// TSQR_BINARY_TREE: pairs of triangular factors are combined at each level,
+//   TSQR_FLAT_TREE: the root directly combines every triangular factor,
+// TSQR_HYBRID_TREE: a flat tree within each node followed by a binary tree
+//   over the node leaders (see qr::ts::SetNodeSize)
+namespace TSQRTreeNS {
+enum TSQRTree {
+  TSQR_BINARY_TREE,
+  TSQR_FLAT_TREE,
+  TSQR_HYBRID_TREE
+};
+}
+using namespace TSQRTreeNS;
+
 namespace qr {
 
 // Apply Q using its implicit representation
@@ -840,8 +888,15 @@ struct TreeData
     vector<Matrix<F>> phaseList;
     vector<Matrix<Base<F>>> signatureList;
 
+    // The ranks whose triangular factors were stacked beneath ours in each
+    // of our stages of the reduction, and the rank that our final
+    // triangular factor was sent to (-1 for the root)
+    vector<vector<Int>> childrenList;
+    Int parent=-1;
+
     TreeData( Int numStages=0 )
-    : QRList(numStages), phaseList(numStages), signatureList(numStages)
+    : QRList(numStages), phaseList(numStages), signatureList(numStages),
+      childrenList(numStages)
     { }
 
     TreeData( TreeData<F>&& treeData )
@@ -850,7 +905,9 @@ struct TreeData
       signature0(move(treeData.signature0)),
       QRList(move(treeData.QRList)),
       phaseList(move(treeData.phaseList)),
-      signatureList(move(treeData.signatureList))
+      signatureList(move(treeData.signatureList)),
+      childrenList(move(treeData.childrenList)),
+      parent(treeData.parent)
     { }
 
     TreeData<F>& operator=( TreeData<F>&& treeData )
@@ -861,6 +918,8 @@ struct TreeData
         QRList = move(treeData.QRList);
         phaseList = move(treeData.phaseList);
         signatureList = move(treeData.signatureList);
+        childrenList = move(treeData.childrenList);
+        parent = treeData.parent;
         return *this;
     }
 };
@@ -889,6 +948,31 @@ void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData );
 template<typename F>
 void Scatter( ElementalMatrix<F>& A, const TreeData<F>& treeData );
 
+// Apply the implicit m x n orthogonal factor, Q, from qr::TS(A):
+// X := Q Y, where Y is n x k and X is m x k and distributed like A
+template<typename F>
+void ApplyQ
+( const ElementalMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const ElementalMatrix<F>& Y,
+        ElementalMatrix<F>& X );
+
+// Y := Q^H X, where X is m x k and Y is n x k
+template<typename F>
+void ApplyQAdjoint
+( const ElementalMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const ElementalMatrix<F>& X,
+        ElementalMatrix<F>& Y );
+
+// Tree-shape tunables (the defaults are a binary tree and, for the hybrid
+// tree, detecting the sets of processes which share a node; a positive node
+// size instead groups each block of that many consecutive ranks)
+void SetTree( TSQRTree tree );
+TSQRTree Tree();
+void SetNodeSize( Int nodeSize );
+Int NodeSize();
+
 } // namespace ts
 
 } // namespace qr
@@ -395,6 +395,107 @@ struct DistFront
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
 };
 
+// A persistent plan for the repeated factorization of sparse matrices which
+// share a sparsity pattern (e.g., the KKT systems of an Interior Point Method
+// or of a sequence of warm-started solves). The nested dissection analysis
+// is only recomputed when the sparsity pattern changes, and the fronts (and
+// their buffers) are reused for each numerical refactorization.
+template<typename F>
+struct FactorizationPlan
+{
+    vector<Int> map, invMap;
+    Separator rootSep;
+    NodeInfo info;
+    Front<F> front;
+
+    FactorizationPlan();
+
+    // Returns true if the sparsity pattern of A matches that of the last
+    // analysis
+    bool Matches( const SparseMatrix<F>& A ) const;
+
+    // (Re)analyze the sparsity pattern of A if either it or the bisection
+    // control does not match the last analysis. Returns true if an analysis
+    // was performed.
+    bool Analyze
+    ( const SparseMatrix<F>& A, const BisectCtrl& ctrl=BisectCtrl() );
+
+    // Analyze if necessary, then pull A into the fronts and factor them
+    void Factor
+    ( const SparseMatrix<F>& A,
+      LDLFrontType factorType=LDL_2D,
+      bool conjugate=false,
+      const BisectCtrl& ctrl=BisectCtrl() );
+
+    // Force the next call to Analyze to recompute the analysis
+    void Reset();
+
+    Int NumAnalyses() const;
+
+private:
+    Int height_;
+    vector<Int> offsets_, targets_;
+    BisectCtrl ctrl_;
+    Int numAnalyses_;
+};
+
+template<typename F>
+struct DistFactorizationPlan
+{
+    DistMap map, invMap;
+    DistSeparator rootSep;
+    DistNodeInfo info;
+    DistFront<F> front;
+    // The (expensive) metadata for pulling entries into the fronts
+    vector<Int> mappedSources, mappedTargets, colOffs;
+
+    DistFactorizationPlan();
+
+    // Collectively returns true if the sparsity pattern of A (and its
+    // distribution) matches that of the last analysis
+    bool Matches( const DistSparseMatrix<F>& A ) const;
+
+    // (Re)analyze the sparsity pattern of A if either it or the bisection
+    // control does not match the last analysis. Returns true if an analysis
+    // was performed.
+    bool Analyze
+    ( const DistSparseMatrix<F>& A, const BisectCtrl& ctrl=BisectCtrl() );
+
+    // Analyze if necessary, then pull A into the fronts and factor them
+    void Factor
+    ( const DistSparseMatrix<F>& A,
+      LDLFrontType factorType=LDL_2D,
+      bool conjugate=false,
+      const BisectCtrl& ctrl=BisectCtrl() );
+
+    // Force the next call to Analyze to recompute the analysis
+    void Reset();
+
+    Int NumAnalyses() const;
+
+private:
+    mpi::Comm comm_;
+    Int height_;
+    vector<Int> offsets_, targets_;
+    BisectCtrl ctrl_;
+    Int numAnalyses_;
+};
+
+// When EL_HYBRID is enabled, the sibling subtrees of the sequential portion
+// of the elimination tree are factored as concurrent OpenMP tasks if at least
+// two of them are expected to require more than the given number of GFlops
+// and if holding all of their update matrices at once would not increase the
+// total memory reserved for concurrent updates beyond the given limit (in
+// bytes). The defaults are 0.01 GFlops and 1 GB.
+void SetSubtreeTaskGFlopCutoff( double gflops );
+double SubtreeTaskGFlopCutoff();
+void SetSubtreeTaskMemoryLimit( double bytes );
+double SubtreeTaskMemoryLimit();
+
+// An estimate of the number of GFlops required to factor the subtree rooted
+// at the given node (which is accumulated during the symbolic analysis)
+double SubtreeFactorGFlops( const NodeInfo& info );
+
 template<typename F>
 void ChangeFrontType( Front<F>& front, LDLFrontType type, bool recurse=true );
 template<typename F>
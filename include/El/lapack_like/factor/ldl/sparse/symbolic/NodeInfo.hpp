@@ -34,6 +34,8 @@ struct NodeInfo
     vector<Int> origLowerRelInds;
     // (maps from the child update indices to our frontal indices).
     vector<vector<Int>> childRelInds;
+    // An estimate of the GFlops required to factor the subtree
+    double subtreeGFlops;
 
     // Symbolic analysis for modification of SuiteSparse LDL
     // -----------------------------------------------------
@@ -42,7 +44,7 @@ struct NodeInfo
     vector<Int> LParents;
 
     NodeInfo( NodeInfo* parentNode=nullptr )
-    : parent(parentNode), duplicate(nullptr)
+    : parent(parentNode), duplicate(nullptr), subtreeGFlops(0)
     { }
 
     NodeInfo( DistNodeInfo* duplicateNode );
@@ -113,7 +115,7 @@ struct DistNodeInfo
 };
 
 inline NodeInfo::NodeInfo( DistNodeInfo* duplicateNode )
-: parent(nullptr), duplicate(duplicateNode)
+: parent(nullptr), duplicate(duplicateNode), subtreeGFlops(0)
 {
     size = duplicate->size;
     off = duplicate->off;
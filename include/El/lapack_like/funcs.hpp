@@ -31,6 +31,16 @@ struct SignCtrl
     Real power=1;
     SignScaling scaling=SIGN_SCALE_FROB;
     bool progress=false;
+
+    // Switch from Newton to the inverse-free Newton-Schulz iteration once the
+    // relative change in the iterates drops below newtonSchulzTol (and
+    // || I - X^2 ||_1 < 1, which guarantees its convergence)
+    bool newtonSchulz=false;
+    Real newtonSchulzTol=Real(1)/Real(10);
+
+    // Whether the control solvers should exploit the block-triangular
+    // (Sylvester and Lyapunov) or Hamiltonian (Riccati) structure
+    bool structured=true;
 };
 
 template<typename Real>
@@ -154,6 +164,27 @@ void Sign
 ( ElementalMatrix<F>& A, ElementalMatrix<F>& N, 
   const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
 
+// Sign of A = | ATL ATR |, where ATL is m x m, which only requires inverting
+//             | 0   ABR |
+// the diagonal blocks within each Newton step
+template<typename F>
+void BlockTriangularSign
+( Int m, Matrix<F>& A, const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+template<typename F>
+void BlockTriangularSign
+( Int m, ElementalMatrix<F>& A,
+  const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+
+// Sign of a Hamiltonian matrix, i.e., J A is Hermitian for J = | 0  I |,
+//                                                              | -I 0 |
+// where each Newton step only requires a Hermitian-indefinite inverse
+template<typename F>
+void HamiltonianSign
+( Matrix<F>& A, const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+template<typename F>
+void HamiltonianSign
+( ElementalMatrix<F>& A, const SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+
 template<typename F>
 void HermitianSign
 ( UpperOrLower uplo, Matrix<F>& A, 
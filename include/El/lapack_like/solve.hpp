@@ -16,10 +16,36 @@ namespace El {
 
 // Linear
 // ======
+template<typename Real>
+struct LinearSolveCtrl
+{
+    // Factor in the next lower precision (see Demote) and iteratively refine
+    // the solution with residuals formed in the working precision. If the
+    // demoted factorization breaks down or refinement stagnates before
+    //
+    //   || b - A x ||_max <= relTol sqrt(n) || A ||_oo || x ||_max,
+    //
+    // then the system is instead solved in the working precision.
+    bool mixedPrecision=false;
+    Real relTol=limits::Epsilon<Real>();
+    Int maxRefineIts=30;
+    bool progress=false;
+
+    // Set by each solve with 'mixedPrecision' enabled: whether the system
+    // was instead solved in the working precision and the largest number
+    // of refinement iterations taken by any right-hand side
+    mutable bool fellBack=false;
+    mutable Int numRefineIts=0;
+};
+
 template<typename F>
-void LinearSolve( const Matrix<F>& A, Matrix<F>& B );
+void LinearSolve
+( const Matrix<F>& A, Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
-void LinearSolve( const ElementalMatrix<F>& A, ElementalMatrix<F>& B );
+void LinearSolve
+( const ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
 void LinearSolve
 ( const DistMatrix<F,MC,MR,BLOCK>& A, DistMatrix<F,MC,MR,BLOCK>& B );
@@ -172,6 +198,7 @@ void MultiShiftHessSolve
 
 } // namespace El
 
+#include <El/lapack_like/solve/GramSchmidt.hpp>
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
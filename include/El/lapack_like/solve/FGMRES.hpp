@@ -29,7 +29,8 @@ Int Single
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -139,18 +140,10 @@ Int Single
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
-            {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                auto vi = V( ALL, IR(i) );
-                H(i,j) = Dot(vi,w);
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), vi, w );
-            }
-            const Real delta = Nrm2( w );
+            auto Vj = V( ALL, IR(0,j+1) );
+            auto hj = H( IR(0,j+1), IR(j) );
+            const Real delta =
+              gram_schmidt::Orthogonalize( orthog, Vj, w, hj, mpi::COMM_SELF );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -285,7 +278,8 @@ Int FGMRES
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED )
 {
     DEBUG_CSE
     Int mostIts = 0;
@@ -295,7 +289,7 @@ Int FGMRES
         auto b = B( ALL, IR(j) );
         const Int its =
           fgmres::Single
-          ( applyA, precond, b, relTol, restart, maxIts, progress );
+          ( applyA, precond, b, relTol, restart, maxIts, progress, orthog );
         mostIts = Max(mostIts,its);
     }
     return mostIts;
@@ -312,7 +306,8 @@ Int Single
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -434,18 +429,11 @@ Int Single
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
-            {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                q.Matrix() = VLoc( ALL, IR(i) );
-                H(i,j) = Dot(q,w);
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), q, w );
-            }
-            const Real delta = Nrm2( w );
+            auto VjLoc = VLoc( ALL, IR(0,j+1) );
+            auto hj = H( IR(0,j+1), IR(j) );
+            const Real delta =
+              gram_schmidt::Orthogonalize
+              ( orthog, VjLoc, w.Matrix(), hj, comm );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -570,6 +558,293 @@ Int Single
     return iter;
 }
 
+// A pipelined variant of the above in which the single (fused) reduction of
+// each Arnoldi step is overlapped with the preconditioner application and
+// matrix-vector product for the next step: if u = A z_j, then
+//
+//   v_{j+1} = (u - V_j h_j) / delta_j,
+//   z_{j+1} = (inv(M) u - Z_j h_j) / delta_j,
+//   A z_{j+1} = (A inv(M) u - (A Z_j) h_j) / delta_j,
+//
+// where the last relation holds for any choice of z_{j+1} (as in flexible
+// GMRES) and z_{j+1} = inv(M) v_{j+1} when the preconditioner is linear.
+// Convergence is monitored via the residual norm implied by the Givens
+// rotations, and the true residual, b - A x, is only formed (with one
+// application of A and one reduction) when the estimate falls below the
+// tolerance or a restart is required. If
+// cancellation is detected in an orthogonalization, the step is repeated
+// without pipelining.
+template<typename F,class ApplyAType,class PrecondType>
+Int PipelinedSingle
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& b,
+        Base<F> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<F> Real;
+    const Int n = b.Height();
+    mpi::Comm comm = b.Comm();
+    const int commRank = mpi::Rank(comm);
+
+    // x := 0
+    // ======
+    DistMultiVec<F> x(comm);
+    Zeros( x, n, 1 );
+
+    // w := b (= b - A x_0)
+    // ====================
+    DistMultiVec<F> w(comm);
+    w = b;
+    const Real origResidNorm = Nrm2( w );
+    if( progress && commRank == 0 )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // The ratio of the true relative residual norm to the estimate from the
+    // Givens rotations at the last check
+    Real residScale = 1;
+
+    Int iter=0;
+    bool converged = false;
+    Matrix<Real> cs;
+    Matrix<F> sn, H, t, r;
+    mpi::Request<F> request;
+    DistMultiVec<F> x0(comm), q(comm), u(comm), p(comm), Ap(comm),
+      V(comm), Z(comm), AZ(comm);
+    Zeros( q, n, 1 );
+    Zeros( u, n, 1 );
+    Zeros( p, n, 1 );
+    Zeros( Ap, n, 1 );
+    while( !converged )
+    {
+        if( progress && commRank == 0 )
+            Output("Starting pipelined FGMRES iteration ",iter);
+        const Int indent = PushIndent();
+
+        // x0 := x
+        // =======
+        x0 = x;
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H,  restart, restart );
+        Zeros( V, n, restart );
+        Zeros( Z, n, restart );
+        Zeros( AZ, n, restart );
+        auto& VLoc = V.Matrix();
+        auto& ZLoc = Z.Matrix();
+        auto& AZLoc = AZ.Matrix();
+
+        // NOTE: w = b - A x already
+
+        // beta := || w ||_2
+        // =================
+        const Real beta = Nrm2( w );
+
+        // v0 := w / beta
+        // ==============
+        auto v0Loc = VLoc( ALL, IR(0) );
+        v0Loc = w.Matrix();
+        v0Loc *= 1/beta;
+
+        // z0 := inv(M) v0, and form A z0
+        // ==============================
+        q.Matrix() = v0Loc;
+        precond( q );
+        ZLoc( ALL, IR(0) ) = q.Matrix();
+        applyA( F(1), q, F(0), u );
+        AZLoc( ALL, IR(0) ) = u.Matrix();
+
+        // t := beta e_0
+        // =============
+        Zeros( t, restart+1, 1 );
+        t(0) = beta;
+
+        // Run one round of GMRES(restart)
+        // ===============================
+        for( Int j=0; j<restart; ++j )
+        {
+            if( progress && commRank == 0 )
+                Output("Starting inner FGMRES iteration ",j);
+            const Int innerIndent = PushIndent();
+
+            // Begin the j'th step of Arnoldi on u := A z_j
+            // --------------------------------------------
+            u.Matrix() = AZLoc( ALL, IR(j) );
+            auto VjLoc = VLoc( ALL, IR(0,j+1) );
+            gram_schmidt::StartFusedReduction
+            ( VjLoc, u.LockedMatrix(), r, comm, request );
+
+            // Overlap: p := inv(M) u and Ap := A p
+            // ------------------------------------
+            const bool lookahead = ( j+1 < restart );
+            if( lookahead )
+            {
+                p = u;
+                precond( p );
+                applyA( F(1), p, F(0), Ap );
+            }
+
+            // Finish the j'th step of Arnoldi
+            // -------------------------------
+            auto hj = H( IR(0,j+1), IR(j) );
+            Real delta;
+            const bool consistent =
+              gram_schmidt::FinishFusedReduction
+              ( VjLoc, u.Matrix(), hj, r, comm, request, delta );
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+            if( delta == Real(0) )
+                restart = j+1;
+            if( j+1 != restart )
+            {
+                // v_{j+1} := u / delta
+                // ^^^^^^^^^^^^^^^^^^^^
+                auto v_jp1Loc = VLoc( ALL, IR(j+1) );
+                v_jp1Loc = u.Matrix();
+                v_jp1Loc *= 1/delta;
+
+                auto z_jp1Loc = ZLoc( ALL, IR(j+1) );
+                auto Az_jp1Loc = AZLoc( ALL, IR(j+1) );
+                if( consistent )
+                {
+                    // z_{j+1} := (p - Z_j h_j) / delta
+                    // A z_{j+1} := (Ap - (A Z_j) h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto ZjLoc = ZLoc( ALL, IR(0,j+1) );
+                    auto AZjLoc = AZLoc( ALL, IR(0,j+1) );
+                    Gemv( NORMAL, F(-1), ZjLoc, hj, F(1), p.Matrix() );
+                    Gemv( NORMAL, F(-1), AZjLoc, hj, F(1), Ap.Matrix() );
+                    z_jp1Loc = p.Matrix();
+                    z_jp1Loc *= 1/delta;
+                    Az_jp1Loc = Ap.Matrix();
+                    Az_jp1Loc *= 1/delta;
+                }
+                else
+                {
+                    // z_{j+1} := inv(M) v_{j+1}, and form A z_{j+1}
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    q.Matrix() = v_jp1Loc;
+                    precond( q );
+                    z_jp1Loc = q.Matrix();
+                    applyA( F(1), q, F(0), Ap );
+                    Az_jp1Loc = Ap.Matrix();
+                }
+            }
+
+            // Apply existing rotations to the new column of H
+            // -----------------------------------------------
+            for( Int i=0; i<j; ++i )
+            {
+                const Real& c = cs(i);
+                const F& s = sn(i);
+                const F sConj = Conj(s);
+                const F eta_i_j = H(i,j);
+                const F eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c    *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -sConj*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and the rotated
+            // beta*e_0 vector, t
+            // -----------------------------------------------------------
+            const F eta_j_j = H(j,j);
+            const F eta_jp1_j = delta;
+            if( !limits::IsFinite(RealPart(eta_j_j))   ||
+                !limits::IsFinite(ImagPart(eta_j_j))   ||
+                !limits::IsFinite(RealPart(eta_jp1_j)) ||
+                !limits::IsFinite(ImagPart(eta_jp1_j)) )
+                RuntimeError("Either H(j,j) or H(j+1,j) was not finite");
+            Real c;
+            F s;
+            F rho = Givens( eta_j_j, eta_jp1_j, c, s );
+            if( !limits::IsFinite(c) ||
+                !limits::IsFinite(RealPart(s)) ||
+                !limits::IsFinite(ImagPart(s)) ||
+                !limits::IsFinite(RealPart(rho)) ||
+                !limits::IsFinite(ImagPart(rho)) )
+                RuntimeError("Givens rotation produced a non-finite number");
+            H(j,j) = rho;
+            cs(j) = c;
+            sn(j) = s;
+            const F sConj = Conj(s);
+            const F tau_j = t(j);
+            const F tau_jp1 = t(j+1);
+            t(j)   =  c    *tau_j + s*tau_jp1;
+            t(j+1) = -sConj*tau_j + c*tau_jp1;
+
+            // Only form the true residual when the (scaled) estimate has
+            // converged or the solution is required for a restart
+            // ----------------------------------------------------------
+            const Real estRelResidNorm = Abs(t(j+1))/origResidNorm;
+            ++iter;
+            const bool check = residScale*estRelResidNorm < relTol ||
+                               j+1 == restart || iter == maxIts;
+            if( check )
+            {
+                // Minimize the residual
+                // ^^^^^^^^^^^^^^^^^^^^^
+                auto tT = t( IR(0,j+1), ALL );
+                auto y = tT;
+                auto HTL = H( IR(0,j+1), IR(0,j+1) );
+                Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+
+                // x := x0 + Z_j y
+                // ^^^^^^^^^^^^^^^
+                x = x0;
+                auto ZjLoc = ZLoc( ALL, IR(0,j+1) );
+                Gemv( NORMAL, F(1), ZjLoc, y, F(1), x.Matrix() );
+
+                // w := b - A x
+                // ^^^^^^^^^^^^
+                // NOTE: This is explicitly formed rather than updated from
+                //       the recurrence for A Z_j, which drifts from A x as
+                //       rounding errors accumulate
+                w = b;
+                applyA( F(-1), x, F(1), w );
+
+                const Real residNorm = Nrm2( w );
+                if( !limits::IsFinite(residNorm) )
+                    RuntimeError("Residual norm was not finite");
+                const Real relResidNorm = residNorm/origResidNorm;
+                if( estRelResidNorm > Real(0) )
+                    residScale = relResidNorm/estRelResidNorm;
+                if( relResidNorm < relTol )
+                {
+                    if( progress && commRank == 0 )
+                        Output
+                        ("converged with relative tolerance: ",relResidNorm);
+                    converged = true;
+                    break;
+                }
+                if( progress && commRank == 0 )
+                    Output
+                    ("finished iteration ",iter-1," with relResidNorm=",
+                     relResidNorm);
+                if( iter == maxIts )
+                    RuntimeError("FGMRES did not converge");
+            }
+            else if( progress && commRank == 0 )
+                Output
+                ("finished iteration ",iter-1," with estimated relResidNorm=",
+                 estRelResidNorm);
+            SetIndent( innerIndent );
+        }
+        SetIndent( indent );
+    }
+    b = x;
+    return iter;
+}
+
 } // namespace fgmres
 
 // TODO: Add support for an initial guess
@@ -581,7 +856,9 @@ Int FGMRES
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED,
+        bool pipeline=false )
 {
     DEBUG_CSE
     const Int height = B.Height();
@@ -597,8 +874,11 @@ Int FGMRES
         auto bLoc = BLoc( ALL, IR(j) );
         uLoc = bLoc;
         const Int its =
+          pipeline ?
+          fgmres::PipelinedSingle
+          ( applyA, precond, u, relTol, restart, maxIts, progress ) :
           fgmres::Single
-          ( applyA, precond, u, relTol, restart, maxIts, progress );
+          ( applyA, precond, u, relTol, restart, maxIts, progress, orthog );
         bLoc = uLoc;
         mostIts = Max(mostIts,its);
     }
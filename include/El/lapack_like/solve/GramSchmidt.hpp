@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_GRAMSCHMIDT_HPP
+#define EL_SOLVE_GRAMSCHMIDT_HPP
+
+// Orthogonalization kernels for the Arnoldi processes within the GMRES
+// variants. Each routine acts upon the local rows of a set of orthonormal
+// vectors, V, and a vector, w, whose rows are distributed over 'comm' in the
+// same manner (mpi::COMM_SELF should be passed for sequential vectors), and
+// the number of global reductions is what distinguishes the schemes:
+//
+//   GRAM_SCHMIDT_MODIFIED: k+1 reductions for k basis vectors,
+//
+//   GRAM_SCHMIDT_CLASSICAL_REORTH: two passes of classical Gram-Schmidt,
+//     with the norm of the result folded into the second reduction,
+//
+//   GRAM_SCHMIDT_ONE_REDUCE: a single fused reduction of [V^H w; w^H w]
+//     with the norm of the result computed via the Pythagorean theorem,
+//     followed by a reorthogonalization pass only when cancellation is
+//     detected.
+//
+// The one-reduce scheme is that of, for example,
+//
+//   Katarzyna Swirydowicz, Julien Langou, Shreyas Ananthan, Ulrike Yang,
+//   and Stephen Thomas,
+//   "Low synchronization Gram-Schmidt and GMRES algorithms",
+//   Numer. Linear Algebra Appl., Vol. 28, No. 2, 2021.
+
+namespace El {
+
+namespace gram_schmidt {
+
+// If || w - V h ||_2^2 (as computed via the Pythagorean theorem) is below
+// this fraction of || w ||_2^2, then roughly half of the significant digits
+// have been lost and the projection is repeated
+template<typename Real>
+Real CancellationThreshold()
+{ return Sqrt(limits::Epsilon<Real>()); }
+
+// Form the local contributions to [V^H w; w^H w] in r and begin their
+// (non-blocking) summation over 'comm'
+template<typename F>
+void StartFusedReduction
+( const Matrix<F>& V,
+  const Matrix<F>& w,
+        Matrix<F>& r,
+        mpi::Comm comm,
+        mpi::Request<F>& request )
+{
+    DEBUG_CSE
+    const Int k = V.Width();
+    Zeros( r, k+1, 1 );
+    auto rT = r( IR(0,k), ALL );
+    if( k > 0 )
+        Gemv( ADJOINT, F(1), V, w, F(0), rT );
+    const Base<F> wLocNorm = Nrm2( w );
+    r(k) = wLocNorm*wLocNorm;
+    mpi::IAllReduce( r.Buffer(), k+1, comm, request );
+}
+
+// A classical Gram-Schmidt pass whose single reduction also yields the norm
+// of the result; the new coefficients are accumulated into h and the norm of
+// the orthogonalized w is returned
+template<typename F>
+Base<F> Reorthogonalize
+( const Matrix<F>& V,
+        Matrix<F>& w,
+        Matrix<F>& h,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int k = V.Width();
+    Matrix<F> r;
+    mpi::Request<F> request;
+    StartFusedReduction( V, w, r, comm, request );
+    mpi::Wait( request );
+
+    auto s = r( IR(0,k), ALL );
+    const Real wNormSquared = RealPart(r(k));
+    if( k > 0 )
+    {
+        Gemv( NORMAL, F(-1), V, s, F(1), w );
+        h += s;
+    }
+    const Real sNorm = Nrm2( s );
+    const Real deltaSquared = wNormSquared - sNorm*sNorm;
+    if( deltaSquared > CancellationThreshold<Real>()*wNormSquared )
+        return Sqrt(deltaSquared);
+
+    // Fall back to an explicit norm computation
+    const Real wLocNorm = Nrm2( w );
+    return Sqrt(mpi::AllReduce(wLocNorm*wLocNorm,comm));
+}
+
+// Complete the projection begun by StartFusedReduction: h := V^H w,
+// w := w - V h, and delta := || w ||_2 (via the Pythagorean theorem). The
+// return value is false if cancellation forced a (blocking)
+// reorthogonalization pass, in which case any quantities computed from the
+// original w while the reduction was in flight are no longer consistent.
+template<typename F>
+bool FinishFusedReduction
+( const Matrix<F>& V,
+        Matrix<F>& w,
+        Matrix<F>& h,
+        Matrix<F>& r,
+        mpi::Comm comm,
+        mpi::Request<F>& request,
+        Base<F>& delta )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int k = V.Width();
+    mpi::Wait( request );
+
+    h = r( IR(0,k), ALL );
+    const Real wNormSquared = RealPart(r(k));
+    if( k > 0 )
+        Gemv( NORMAL, F(-1), V, h, F(1), w );
+    const Real hNorm = Nrm2( h );
+    const Real deltaSquared = wNormSquared - hNorm*hNorm;
+    if( deltaSquared > CancellationThreshold<Real>()*wNormSquared )
+    {
+        delta = Sqrt(deltaSquared);
+        return true;
+    }
+    delta = Reorthogonalize( V, w, h, comm );
+    return false;
+}
+
+// Overwrite w with its component orthogonal to the columns of V, store the
+// coefficients of the projection in the k x 1 vector h, and return the
+// two-norm of the result
+template<typename F>
+Base<F> Orthogonalize
+( GramSchmidtAlg alg,
+  const Matrix<F>& V,
+        Matrix<F>& w,
+        Matrix<F>& h,
+        mpi::Comm comm )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int k = V.Width();
+    DEBUG_ONLY(
+      if( w.Width() != 1 || w.Height() != V.Height() )
+          LogicError("w must be a column vector conforming with V");
+      if( h.Height() != k || h.Width() != 1 )
+          LogicError("h must be a ",k," x 1 vector");
+    )
+    if( alg == GRAM_SCHMIDT_MODIFIED )
+    {
+        for( Int i=0; i<k; ++i )
+        {
+            auto vi = V( ALL, IR(i) );
+            h(i) = mpi::AllReduce( Dot(vi,w), comm );
+            Axpy( -h(i), vi, w );
+        }
+        const Real wLocNorm = Nrm2( w );
+        return Sqrt(mpi::AllReduce(wLocNorm*wLocNorm,comm));
+    }
+    else if( alg == GRAM_SCHMIDT_CLASSICAL_REORTH )
+    {
+        Zero( h );
+        if( k > 0 )
+        {
+            Gemv( ADJOINT, F(1), V, w, F(0), h );
+            mpi::AllReduce( h.Buffer(), k, comm );
+            Gemv( NORMAL, F(-1), V, h, F(1), w );
+        }
+        return Reorthogonalize( V, w, h, comm );
+    }
+    else
+    {
+        Matrix<F> r;
+        mpi::Request<F> request;
+        StartFusedReduction( V, w, r, comm, request );
+        Real delta;
+        FinishFusedReduction( V, w, h, r, comm, request, delta );
+        return delta;
+    }
+}
+
+} // namespace gram_schmidt
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_GRAMSCHMIDT_HPP
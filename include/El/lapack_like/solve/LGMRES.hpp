@@ -24,7 +24,8 @@ Int Single
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -104,18 +105,10 @@ Int Single
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
-            {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                auto vi = V( ALL, IR(i) );
-                H.Set( i, j, Dot(vi,w) );
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), vi, w );
-            }
-            const Real delta = Nrm2( w );
+            auto Vj = V( ALL, IR(0,j+1) );
+            auto hj = H( IR(0,j+1), IR(j) );
+            const Real delta =
+              gram_schmidt::Orthogonalize( orthog, Vj, w, hj, mpi::COMM_SELF );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -233,7 +226,8 @@ Int LGMRES
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED )
 {
     DEBUG_CSE
     Int mostIts = 0;
@@ -243,7 +237,7 @@ Int LGMRES
         auto b = B( ALL, IR(j) );
         const Int its =
           lgmres::Single
-          ( applyA, precond, b, relTol, restart, maxIts, progress );
+          ( applyA, precond, b, relTol, restart, maxIts, progress, orthog );
         mostIts = Max(mostIts,its);
     }
     return mostIts;
@@ -260,7 +254,8 @@ Int Single
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -348,18 +343,11 @@ Int Single
 
             // Run the j'th step of Arnoldi
             // ----------------------------
-            for( Int i=0; i<=j; ++i )
-            {
-                // H(i,j) := v_i' w
-                // ^^^^^^^^^^^^^^^^
-                q.Matrix() = VLoc( ALL, IR(i) );
-                H(i,j) = Dot(q,w);
-
-                // w := w - H(i,j) v_i
-                // ^^^^^^^^^^^^^^^^^^^
-                Axpy( -H(i,j), q, w );
-            }
-            const Real delta = Nrm2( w );
+            auto VjLoc = VLoc( ALL, IR(0,j+1) );
+            auto hj = H( IR(0,j+1), IR(j) );
+            const Real delta =
+              gram_schmidt::Orthogonalize
+              ( orthog, VjLoc, w.Matrix(), hj, comm );
             if( !limits::IsFinite(delta) )
                 RuntimeError("Arnoldi step produced a non-finite number");
             if( delta == Real(0) )
@@ -466,6 +454,276 @@ Int Single
     return iter;
 }
 
+// A pipelined variant of the above which overlaps the single (fused)
+// reduction of each Arnoldi step with the application of inv(M) A for the
+// next step. The images W_j = inv(M) A V_j are stored so that, if
+// u = inv(M) A v_j, then
+//
+//   v_{j+1} = (u - V_j h_j) / delta_j,
+//   inv(M) A v_{j+1} = (inv(M) A u - W_j h_j) / delta_j,
+//
+// which requires the preconditioner to be linear. The (unpreconditioned)
+// true residual is only formed when the preconditioned residual estimate
+// implied by the Givens rotations, scaled by the ratio observed at the last
+// check, falls below the tolerance or a restart is required.
+template<typename F,class ApplyAType,class PrecondType>
+Int PipelinedSingle
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<F>& b,
+        Base<F> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<F> Real;
+    const Int n = b.Height();
+    mpi::Comm comm = b.Comm();
+    const int commRank = mpi::Rank(comm);
+
+    // x := 0
+    // ======
+    DistMultiVec<F> x(comm);
+    Zeros( x, n, 1 );
+
+    // w := b (= b - A x_0)
+    // ====================
+    DistMultiVec<F> w(comm);
+    w = b;
+    const Real origResidNorm = Nrm2( w );
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // The preconditioned residual norm of the initial guess and the ratio
+    // of the true relative residual norm to the preconditioned estimate at
+    // the last check
+    Real origPrecResidNorm = 0;
+    Real residScale = 1;
+
+    Int iter=0;
+    bool converged = false;
+    Matrix<Real> cs;
+    Matrix<F> sn, H, t, r;
+    mpi::Request<F> request;
+    DistMultiVec<F> x0(comm), q(comm), u(comm), p(comm), V(comm), W(comm);
+    Zeros( q, n, 1 );
+    Zeros( u, n, 1 );
+    Zeros( p, n, 1 );
+    while( !converged )
+    {
+        if( progress && commRank == 0 )
+            Output("Starting pipelined GMRES iteration ",iter);
+        const Int indent = PushIndent();
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H,  restart, restart );
+        Zeros( V, n, restart );
+        Zeros( W, n, restart );
+        auto& VLoc = V.Matrix();
+        auto& WLoc = W.Matrix();
+
+        // x0 := x
+        // =======
+        x0 = x;
+
+        // w := inv(M) w
+        // =============
+        precond( w );
+
+        // beta := || w ||_2
+        // =================
+        const Real beta = Nrm2( w );
+        if( iter == 0 )
+            origPrecResidNorm = beta;
+
+        // v0 := w / beta
+        // ==============
+        auto v0Loc = VLoc( ALL, IR(0) );
+        v0Loc = w.Matrix();
+        v0Loc *= 1/beta;
+
+        // w0 := inv(M) A v0
+        // =================
+        q.Matrix() = v0Loc;
+        applyA( F(1), q, F(0), u );
+        precond( u );
+        WLoc( ALL, IR(0) ) = u.Matrix();
+
+        // t := beta e_0
+        // =============
+        Zeros( t, restart+1, 1 );
+        t(0) = beta;
+
+        // Run one round of GMRES(restart)
+        // ===============================
+        for( Int j=0; j<restart; ++j )
+        {
+            if( progress && commRank == 0 )
+                Output("Starting inner GMRES iteration ",j);
+            const Int innerIndent = PushIndent();
+
+            // Begin the j'th step of Arnoldi on u := inv(M) A v_j
+            // ---------------------------------------------------
+            u.Matrix() = WLoc( ALL, IR(j) );
+            auto VjLoc = VLoc( ALL, IR(0,j+1) );
+            gram_schmidt::StartFusedReduction
+            ( VjLoc, u.LockedMatrix(), r, comm, request );
+
+            // Overlap: p := inv(M) A u
+            // ------------------------
+            const bool lookahead = ( j+1 < restart );
+            if( lookahead )
+            {
+                applyA( F(1), u, F(0), p );
+                precond( p );
+            }
+
+            // Finish the j'th step of Arnoldi
+            // -------------------------------
+            auto hj = H( IR(0,j+1), IR(j) );
+            Real delta;
+            const bool consistent =
+              gram_schmidt::FinishFusedReduction
+              ( VjLoc, u.Matrix(), hj, r, comm, request, delta );
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+            if( delta == Real(0) )
+                restart = j+1;
+            if( j+1 != restart )
+            {
+                // v_{j+1} := u / delta
+                // ^^^^^^^^^^^^^^^^^^^^
+                auto v_jp1Loc = VLoc( ALL, IR(j+1) );
+                v_jp1Loc = u.Matrix();
+                v_jp1Loc *= 1/delta;
+
+                auto w_jp1Loc = WLoc( ALL, IR(j+1) );
+                if( consistent )
+                {
+                    // w_{j+1} := (p - W_j h_j) / delta
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    auto WjLoc = WLoc( ALL, IR(0,j+1) );
+                    Gemv( NORMAL, F(-1), WjLoc, hj, F(1), p.Matrix() );
+                    w_jp1Loc = p.Matrix();
+                    w_jp1Loc *= 1/delta;
+                }
+                else
+                {
+                    // w_{j+1} := inv(M) A v_{j+1}
+                    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                    q.Matrix() = v_jp1Loc;
+                    applyA( F(1), q, F(0), p );
+                    precond( p );
+                    w_jp1Loc = p.Matrix();
+                }
+            }
+
+            // Apply existing rotations to the new column of H
+            // -----------------------------------------------
+            for( Int i=0; i<j; ++i )
+            {
+                const Real& c = cs(i);
+                const F& s = sn(i);
+                const F sConj = Conj(s);
+                const F eta_i_j = H(i,j);
+                const F eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c    *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -sConj*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and the rotated
+            // beta*e_0 vector, t
+            // -----------------------------------------------------------
+            const F eta_j_j = H(j,j);
+            const F eta_jp1_j = delta;
+            if( !limits::IsFinite(RealPart(eta_j_j))   ||
+                !limits::IsFinite(ImagPart(eta_j_j))   ||
+                !limits::IsFinite(RealPart(eta_jp1_j)) ||
+                !limits::IsFinite(ImagPart(eta_jp1_j)) )
+                RuntimeError("Either H(j,j) or H(j+1,j) was not finite");
+            Real c;
+            F s;
+            F rho = Givens( eta_j_j, eta_jp1_j, c, s );
+            if( !limits::IsFinite(c) ||
+                !limits::IsFinite(RealPart(s)) ||
+                !limits::IsFinite(ImagPart(s)) ||
+                !limits::IsFinite(RealPart(rho)) ||
+                !limits::IsFinite(ImagPart(rho)) )
+                RuntimeError("Givens rotation produced a non-finite number");
+            H(j,j) = rho;
+            cs(j) = c;
+            sn(j) = s;
+            const F sConj = Conj(s);
+            const F tau_j = t(j);
+            const F tau_jp1 = t(j+1);
+            t(j)   =  c    *tau_j + s*tau_jp1;
+            t(j+1) = -sConj*tau_j + c*tau_jp1;
+
+            // Only form the true residual when the (scaled) estimate has
+            // converged or the solution is required for a restart
+            // ----------------------------------------------------------
+            const Real estRelResidNorm = Abs(t(j+1))/origPrecResidNorm;
+            ++iter;
+            const bool check = residScale*estRelResidNorm < relTol ||
+                               j+1 == restart || iter == maxIts;
+            if( check )
+            {
+                // Minimize the residual
+                // ^^^^^^^^^^^^^^^^^^^^^
+                auto tT = t( IR(0,j+1), ALL );
+                auto y = tT;
+                auto HTL = H( IR(0,j+1), IR(0,j+1) );
+                Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+
+                // x := x0 + V_j y
+                // ^^^^^^^^^^^^^^^
+                x = x0;
+                Gemv( NORMAL, F(1), VjLoc, y, F(1), x.Matrix() );
+
+                // w := b - A x
+                // ^^^^^^^^^^^^
+                w = b;
+                applyA( F(-1), x, F(1), w );
+
+                const Real residNorm = Nrm2( w );
+                if( !limits::IsFinite(residNorm) )
+                    RuntimeError("Residual norm was not finite");
+                const Real relResidNorm = residNorm/origResidNorm;
+                if( estRelResidNorm > Real(0) )
+                    residScale = relResidNorm/estRelResidNorm;
+                if( relResidNorm < relTol )
+                {
+                    if( progress && commRank == 0 )
+                        Output
+                        ("converged with relative tolerance: ",relResidNorm);
+                    converged = true;
+                    break;
+                }
+                if( progress && commRank == 0 )
+                    Output
+                    ("finished iteration ",iter-1," with relResidNorm=",
+                     relResidNorm);
+                if( iter == maxIts )
+                    RuntimeError("LGMRES did not converge");
+            }
+            else if( progress && commRank == 0 )
+                Output
+                ("finished iteration ",iter-1,
+                 " with estimated relResidNorm=",estRelResidNorm);
+            SetIndent( innerIndent );
+        }
+        SetIndent( indent );
+    }
+    b = x;
+    return iter;
+}
+
 } // namespace lgmres
 
 // TODO: Add support for an initial guess
@@ -477,7 +735,9 @@ Int LGMRES
         Base<F> relTol,
         Int restart,
         Int maxIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog=GRAM_SCHMIDT_MODIFIED,
+        bool pipeline=false )
 {
     DEBUG_CSE
     const Int height = B.Height();
@@ -493,8 +753,11 @@ Int LGMRES
         auto bLoc = BLoc( ALL, IR(j) );
         uLoc = bLoc;
         const Int its =
+          pipeline ?
+          lgmres::PipelinedSingle
+          ( applyA, precond, u, relTol, restart, maxIts, progress ) :
           lgmres::Single
-          ( applyA, precond, u, relTol, restart, maxIts, progress );
+          ( applyA, precond, u, relTol, restart, maxIts, progress, orthog );
         bLoc = uLoc;
         mostIts = Max(mostIts,its);
     }
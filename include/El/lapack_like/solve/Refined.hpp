@@ -22,7 +22,7 @@
 // specifically enforced), and more iterations than necessary may be performed, 
 // it is a compromise between performance and accuracy.
 
-// TODO: DistMatrix implementations
+// TODO: Promoted DistMatrix implementations
 // TODO: Simplify once DistMultiVec is eliminated
 // TODO: Allow for a choice between max and two norms?
 
@@ -1067,6 +1067,163 @@ PromotedRefinedSolve
     return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
 }
 
+namespace refined_solve {
+
+template<typename F,class ApplyAType,class ApplyAInvType>
+Int Single
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMatrix<F>& b,
+        Base<F> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( b );
+        return 0;
+    }
+    const Grid& g = b.Grid();
+    const int commRank = g.Rank();
+
+    DistMatrix<F> bOrig( b );
+    const Base<F> bNorm = MaxNorm( b );
+
+    // Compute the initial guess
+    // =========================
+    DistMatrix<F> x( b );
+    applyAInv( x );
+
+    DistMatrix<F> dx(g), xCand(g), y(g);
+    Zeros( y, x.Height(), 1 );
+    applyA( x, y );
+    b -= y;
+    Base<F> errorNorm = MaxNorm( b );
+    if( progress && commRank == 0 )
+        Output("original rel error: ",errorNorm/bNorm);
+
+    Int refineIt = 0;
+    const Int indent = PushIndent();
+    while( true )
+    {
+        if( errorNorm/bNorm <= relTol )
+        {
+            if( progress && commRank == 0 )
+                Output(errorNorm/bNorm," <= ",relTol);
+            break;
+        }
+
+        // Compute the proposed update to the solution
+        // -------------------------------------------
+        dx = b;
+        applyAInv( dx );
+        xCand = x;
+        xCand += dx;
+
+        // Compute the new residual
+        // ------------------------
+        applyA( xCand, y );
+        b = bOrig;
+        b -= y;
+        Base<F> newErrorNorm = MaxNorm( b );
+        if( progress && commRank == 0 )
+            Output("refined rel error: ",newErrorNorm/bNorm);
+
+        if( newErrorNorm < errorNorm )
+            x = xCand;
+        else
+            break;
+
+        errorNorm = newErrorNorm;
+        ++refineIt;
+        if( refineIt >= maxRefineIts )
+            break;
+    }
+    SetIndent( indent );
+    b = x;
+    return refineIt;
+}
+
+template<typename F,class ApplyAType,class ApplyAInvType>
+Int Batch
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMatrix<F>& B,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_CSE
+    if( maxRefineIts <= 0 )
+    {
+        applyAInv( B );
+        return 0;
+    }
+    const Grid& g = B.Grid();
+
+    DistMatrix<F> BOrig( B );
+
+    // Compute the initial guess
+    // =========================
+    DistMatrix<F> X( B );
+    applyAInv( X );
+
+    DistMatrix<F> dX(g), Y(g);
+    Zeros( Y, X.Height(), X.Width() );
+    applyA( X, Y );
+    B -= Y;
+
+    Int refineIt = 0;
+    const Int indent = PushIndent();
+    while( true )
+    {
+        // Compute the proposed updates to the solutions
+        // ---------------------------------------------
+        dX = B;
+        applyAInv( dX );
+        X += dX;
+
+        ++refineIt;
+        if( refineIt < maxRefineIts )
+        {
+            // Compute the new residual
+            // ------------------------
+            applyA( X, Y );
+            B = BOrig;
+            B -= Y;
+        }
+        else
+            break;
+    }
+    SetIndent( indent );
+    B = X;
+    return refineIt;
+}
+
+} // namespace refined_solve
+
+template<typename F,class ApplyAType,class ApplyAInvType>
+Int RefinedSolve
+( const ApplyAType& applyA,
+  const ApplyAInvType& applyAInv,
+        DistMatrix<F>& B,
+        Base<F> relTol,
+        Int maxRefineIts,
+        bool progress )
+{
+    DEBUG_CSE
+    if( B.Width() == 1 )
+        return refined_solve::Single
+               ( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+    else
+        return refined_solve::Batch
+               ( applyA, applyAInv, B, maxRefineIts, progress );
+}
+
 } // namespace El
 
 #endif // ifndef EL_SOLVE_REFINED_HPP
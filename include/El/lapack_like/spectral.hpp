@@ -841,6 +841,68 @@ void TSQR
 
 } // namespace svd
 
+// Randomized SVD
+// ==============
+// Approximate the dominant singular triplets of an m x n matrix A from the
+// SVD of Q^H A, where the columns of Q form an orthonormal basis for the
+// range of a random sketch, A Omega, refined by a few subspace iterations.
+// The cost is O(m n k) rather than O(m n min(m,n)). See
+//
+//   N. Halko, P.G. Martinsson, and J.A. Tropp,
+//   "Finding structure with randomness: Probabilistic algorithms for
+//   constructing approximate matrix decompositions", SIAM Review, 2011.
+
+namespace SketchTypeNS {
+enum SketchType {
+  // Omega has independent standard normal entries
+  GAUSSIAN_SKETCH,
+  // Omega = sqrt(N/l) D H(0:n,J) for a random diagonal sign matrix D, the
+  // N x N normalized Walsh-Hadamard matrix H (with N the smallest power of
+  // two of at least n), and a random subset J of l columns
+  SRHT_SKETCH
+};
+}
+using namespace SketchTypeNS;
+
+template<typename Real>
+struct RandomizedSVDCtrl
+{
+    // The number of singular triplets to return
+    Int rank=10;
+    // The number of additional sketch vectors
+    Int oversample=10;
+    // The number of subspace iterations, which sharpen the decay of the
+    // singular values seen by the sketch
+    Int numPowerIts=1;
+    SketchType sketch=GAUSSIAN_SKETCH;
+
+    // If 'adaptive' is true, the rank is doubled until the smallest
+    // returned singular value is at most 'tol' (relative to the largest
+    // singular value if 'relative' is true) or the rank reaches min(m,n)
+    bool adaptive=false;
+    Real tol=Real(0);
+    bool relative=false;
+
+    // If 'warmStart' is true and U is a nonempty matrix of height m on
+    // input, the leading columns of the sketch are replaced with A^H U
+    bool warmStart=false;
+};
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+template<typename F>
+void RandomizedSVD
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& U,
+        ElementalMatrix<Base<F>>& s,
+        ElementalMatrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+
 // Hermitian SVD
 // =============
 
@@ -1091,6 +1153,17 @@ struct PseudospecCtrl
 
     SnapshotCtrl snapCtrl;
 
+    // Adaptive (quadtree) refinement of spectral windows and portraits:
+    // only a coarse lattice of pixels, spaced by the largest power of two
+    // not exceeding 'coarseSpacing', is initially evaluated, and cells whose
+    // corner estimates straddle one of the requested epsilon-levels (or, if
+    // none were requested, a power of ten), or which contain an eigenvalue,
+    // are recursively bisected down to the pixel level. The remaining pixels
+    // are interpolated (logarithmically) and given an iteration count of zero.
+    bool adaptive=false;
+    Int coarseSpacing=16;
+    vector<Real> epsilons;
+
     mutable Complex<Real> center = Complex<Real>(0);
     mutable Real realWidth=Real(0), imagWidth=Real(0);
 };
@@ -62,6 +62,24 @@ struct EnumCtrl
 
     Int progressLevel=0;
 
+    // Parallel enumeration (FULL_ENUM and GNR_ENUM)
+    // ---------------------------------------------
+    // The top 'parallelDepth' levels of the search tree are enumerated to
+    // form subtrees (0 selects the smallest depth yielding at least
+    // 'subtreesPerWorker' subtrees per thread and process), and the subtrees
+    // are searched by a dynamically-scheduled pool of OpenMP threads which
+    // shrink a shared search radius as shorter vectors are found. The result
+    // is therefore the shortest vector within the bounds rather than the
+    // first one found. For FULL_ENUM, the subtrees are also dealt out over
+    // the processes of 'parallelComm' (all of which must make the same
+    // call), which agree upon the radius after every 'syncBatchSize'
+    // subtrees per process.
+    bool parallel=false;
+    Int parallelDepth=0;
+    Int subtreesPerWorker=16;
+    Int syncBatchSize=64;
+    mpi::Comm parallelComm=mpi::COMM_SELF;
+
     template<typename OtherReal>
     EnumCtrl<Real>& operator=( const EnumCtrl<OtherReal>& ctrl )
     {
@@ -97,6 +115,12 @@ struct EnumCtrl
 
         progressLevel = ctrl.progressLevel;
 
+        parallel = ctrl.parallel;
+        parallelDepth = ctrl.parallelDepth;
+        subtreesPerWorker = ctrl.subtreesPerWorker;
+        syncBatchSize = ctrl.syncBatchSize;
+        parallelComm = ctrl.parallelComm;
+
         return *this;
     }
 
@@ -386,6 +410,20 @@ Base<F> GNREnumeration
         Matrix<F>& v,
   const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
 
+// Search for the shortest lattice member whose norm profile lies beneath the
+// strict upper bounds 'u', where the bounds are uniformly scaled down
+// whenever a shorter member is found, by splitting the search tree into
+// subtrees which are searched in parallel (see the parallel enumeration
+// members of EnumCtrl). As with GNREnumeration, a value greater than u(n-1)
+// is returned if no such member exists.
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& u,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl=EnumCtrl<Base<F>>() );
+
 // Convert to/from the so-called "y-sparse" representation of
 //
 //   Dan Ding, Guizhen Zhu, Yang Yu, and Zhongxiang Zheng,
@@ -523,6 +523,9 @@ struct RPCACtrl
 {
     bool useALM=true;
     bool usePivQR=false;
+    // Soft-threshold with a randomized SVD warm-started from the previous
+    // iteration's singular subspace (takes precedence over usePivQR)
+    bool useRandomizedSVT=false;
     bool progress=true;
 
     Int numPivSteps=75;
@@ -532,6 +535,8 @@ struct RPCACtrl
     Real beta=Real(1);
     Real rho=Real(6);
     Real tol=Real(1e-5);
+
+    RandomizedSVDCtrl<Real> randomizedCtrl;
 };
 
 template<typename F>
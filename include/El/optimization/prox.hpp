@@ -110,6 +110,21 @@ Int PivotedQR
 template<typename F>
 Int TSQR( ElementalMatrix<F>& A, Base<F> rho, bool relative=false );
 
+// Soft-threshold using a randomized approximation of the leading singular
+// triplets whose rank grows until the threshold is crossed. If U has the
+// same height as A, its columns warm-start the range finder, and, upon exit,
+// U holds a basis suitable for warm-starting the next (nearby) problem.
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> rho, Matrix<F>& U,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>(),
+  bool relative=false );
+template<typename F>
+Int Randomized
+( ElementalMatrix<F>& A, Base<F> rho, ElementalMatrix<F>& U,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>(),
+  bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
@@ -32,6 +32,26 @@ inline Real MehrotraCentrality
 ( Real mu, Real muAff, Real alphaAffPri, Real alphaAffDual )
 { return Min(Pow(muAff/mu,Real(3)),Real(1)); }
 
+// Periodically saving the iterate of an Interior Point Method allows long
+// solves to be resumed after an interruption (or to be warm-started from an
+// intermediate iterate of a previous solve).
+struct IPMCheckpointCtrl
+{
+    // If positive, write the iterate every 'frequency' iterations
+    Int frequency=0;
+
+    // The iterates are stored in "<basename>-x.bin", "<basename>-y.bin", etc.,
+    // while the iteration number is stored in "<basename>-state.bin"
+    string basename="IPMCheckpoint";
+
+    // Initialize from (and continue the iteration count of) the checkpoint
+    // stored under 'basename' rather than the usual initialization
+    bool resume=false;
+
+    // The number of iterations performed before the current (resumed) solve
+    Int numPriorIts=0;
+};
+
 template<typename Real>
 struct MehrotraCtrl 
 {
@@ -134,10 +154,91 @@ struct MehrotraCtrl
     bool checkResiduals=true;
 #endif
 
+    // An optional persistent plan for factoring the sparse KKT systems of the
+    // 'direct' solvers. The nested dissection analysis and the fronts are then
+    // reused across iterations and across subsequent solves whose KKT systems
+    // share the same sparsity pattern (e.g., warm-started solves). The plan
+    // must outlive each solve.
+    ldl::FactorizationPlan<Real>* plan=nullptr;
+    ldl::DistFactorizationPlan<Real>* distPlan=nullptr;
+
+    // Controls for periodically checkpointing (and resuming from) the iterate
+    IPMCheckpointCtrl checkpoint;
+
     // TODO: Add a user-definable (muAff,mu) -> sigma function to replace
     //       the default, (muAff/mu)^3 
 };
 
+namespace ipm {
+
+// Save/restore the iterate of an Interior Point Method. The iterates are
+// stored in the BINARY format (in the original scaling of the problem) so that
+// they may also be inspected with Read. ReadCheckpoint returns the number of
+// iterations performed before the checkpoint was written. Since the BINARY
+// format stores the raw bytes of each entry, checkpoints are not supported
+// for the MPFR-based types.
+//
+// The 'direct' solvers have no slack variable, 's'.
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const Matrix<Real>& x, const Matrix<Real>& y, const Matrix<Real>& z );
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const Matrix<Real>& x, const Matrix<Real>& y,
+  const Matrix<Real>& z, const Matrix<Real>& s );
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const AbstractDistMatrix<Real>& x, const AbstractDistMatrix<Real>& y,
+  const AbstractDistMatrix<Real>& z );
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const AbstractDistMatrix<Real>& x, const AbstractDistMatrix<Real>& y,
+  const AbstractDistMatrix<Real>& z, const AbstractDistMatrix<Real>& s );
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z );
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z, const DistMultiVec<Real>& s );
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z );
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z, Matrix<Real>& s );
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  AbstractDistMatrix<Real>& x, AbstractDistMatrix<Real>& y,
+  AbstractDistMatrix<Real>& z );
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  AbstractDistMatrix<Real>& x, AbstractDistMatrix<Real>& y,
+  AbstractDistMatrix<Real>& z, AbstractDistMatrix<Real>& s );
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z );
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+  DistMultiVec<Real>& z, DistMultiVec<Real>& s );
+
+} // namespace ipm
+
 // Alternating Direction Method of Multipliers
 // ===========================================
 template<typename Real>
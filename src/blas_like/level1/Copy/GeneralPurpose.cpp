@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1/Copy.hpp>
+
+#include <list>
+#include <map>
+
+namespace {
+
+using El::Int;
+
+struct CachedPlan
+{
+    Int height, width;
+    El::DistData AData, BData;
+    El::copy::GeneralPurposePlan plan;
+};
+
+// Set once the plan cache has been destroyed (this flag is trivially
+// destructible, so it may still be read by the destructors of static grids)
+bool planCacheDestroyed = false;
+
+// The cached plans of each (source,target) pair of grids, ordered from most
+// to least recently used. Every redistribution between a pair of grids is
+// collective over the same processes, so each of them makes the same
+// sequence of lookups and evictions within the corresponding list and they
+// therefore agree on whether a plan was found without communicating.
+struct PlanCache
+{
+    std::map<std::pair<const El::Grid*,const El::Grid*>,
+             std::list<CachedPlan>> lists;
+
+    ~PlanCache() { planCacheDestroyed = true; }
+};
+
+PlanCache* Cache()
+{
+    if( planCacheDestroyed )
+        return nullptr;
+    static PlanCache cache;
+    return &cache;
+}
+
+std::list<CachedPlan>&
+PlanList( const El::DistData& AData, const El::DistData& BData )
+{ return Cache()->lists[std::make_pair(AData.grid,BData.grid)]; }
+
+Int planCacheSize = 16;
+Int chunkSize = Int(1) << 22;
+
+inline bool SameDist( const El::DistData& A, const El::DistData& B )
+{ return A == B && A.colCut == B.colCut && A.rowCut == B.rowCut; }
+
+template<class PlanList>
+auto FindInList
+( PlanList& planList,
+  Int height, Int width, const El::DistData& AData, const El::DistData& BData )
+-> decltype(planList.begin())
+{
+    auto it = planList.begin();
+    for( ; it!=planList.end(); ++it )
+        if( it->height == height && it->width == width &&
+            SameDist(it->AData,AData) && SameDist(it->BData,BData) )
+            break;
+    return it;
+}
+
+} // anonymous namespace
+
+namespace El {
+namespace copy {
+
+void SetGeneralPurposePlanCacheSize( Int numPlans )
+{
+    DEBUG_CSE
+    if( numPlans < 0 )
+        LogicError("The plan cache size must be non-negative");
+    ::planCacheSize = numPlans;
+    PlanCache* cache = Cache();
+    if( cache == nullptr )
+        return;
+    for( auto& entry : cache->lists )
+        while( Int(entry.second.size()) > numPlans )
+            entry.second.pop_back();
+}
+
+Int GeneralPurposePlanCacheSize()
+{ return ::planCacheSize; }
+
+void SetGeneralPurposeChunkSize( Int numEntries )
+{
+    DEBUG_CSE
+    if( numEntries < 1 )
+        LogicError("The chunk size must be positive");
+    ::chunkSize = numEntries;
+}
+
+Int GeneralPurposeChunkSize()
+{ return ::chunkSize; }
+
+Int NumGeneralPurposePlans()
+{
+    PlanCache* cache = Cache();
+    if( cache == nullptr )
+        return 0;
+    Int numPlans = 0;
+    for( const auto& entry : cache->lists )
+        numPlans += entry.second.size();
+    return numPlans;
+}
+
+void ClearGeneralPurposePlans()
+{
+    PlanCache* cache = Cache();
+    if( cache != nullptr )
+        cache->lists.clear();
+}
+
+void ClearGeneralPurposePlans( const Grid& grid )
+{
+    PlanCache* cache = Cache();
+    if( cache == nullptr )
+        return;
+    for( auto it=cache->lists.begin(); it!=cache->lists.end(); )
+    {
+        if( it->first.first == &grid || it->first.second == &grid )
+            it = cache->lists.erase( it );
+        else
+            ++it;
+    }
+}
+
+const GeneralPurposePlan* FindGeneralPurposePlan
+( Int height, Int width, const DistData& AData, const DistData& BData )
+{
+    DEBUG_CSE
+    PlanCache* cache = Cache();
+    if( cache == nullptr )
+        return nullptr;
+    auto listIt = cache->lists.find( std::make_pair(AData.grid,BData.grid) );
+    if( listIt == cache->lists.end() )
+        return nullptr;
+    const auto& planList = listIt->second;
+    auto it = FindInList( planList, height, width, AData, BData );
+    return ( it == planList.end() ? nullptr : &it->plan );
+}
+
+namespace gp {
+
+const GeneralPurposePlan* FindPlan
+( Int height, Int width, const DistData& AData, const DistData& BData )
+{
+    DEBUG_CSE
+    auto& planList = PlanList( AData, BData );
+    auto it = FindInList( planList, height, width, AData, BData );
+    if( it == planList.end() )
+        return nullptr;
+    planList.splice( planList.begin(), planList, it );
+    return &planList.front().plan;
+}
+
+const GeneralPurposePlan& CachePlan
+( Int height, Int width, const DistData& AData, const DistData& BData,
+  GeneralPurposePlan& plan )
+{
+    DEBUG_CSE
+    auto& planList = PlanList( AData, BData );
+    CachedPlan cached;
+    cached.height = height;
+    cached.width = width;
+    cached.AData = AData;
+    cached.BData = BData;
+    planList.push_front( std::move(cached) );
+    std::swap( planList.front().plan, plan );
+    // Always keep the newest plan, even if caching has been disabled, so
+    // that the returned reference remains valid until the next call
+    while( Int(planList.size()) > Max(::planCacheSize,Int(1)) )
+        planList.pop_back();
+    return planList.front().plan;
+}
+
+} // namespace gp
+
+} // namespace copy
+} // namespace El
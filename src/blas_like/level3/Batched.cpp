@@ -0,0 +1,239 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Each of the following kernels operates on a block of 'numLanes' matrices
+// whose entry (i,j) is stored at buffer[i*rowInc+j*colInc+lane], so that the
+// innermost loops run across the (interleaved) matrices and can be vectorized.
+// Non-interleaved batches are processed one matrix at a time.
+
+namespace El {
+
+namespace batched {
+
+template<typename T>
+void CheckConformal( const MatrixBatch<T>& A, const MatrixBatch<T>& B )
+{
+    if( A.BatchSize() != B.BatchSize() )
+        LogicError
+        ("Batch sizes of ",A.BatchSize()," and ",B.BatchSize(),
+         " do not match");
+    if( A.LaneBlock() != B.LaneBlock() )
+        LogicError("Either all or none of the batches must be interleaved");
+}
+
+template<typename T>
+void GemmKernel
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ARowInc, Int AColInc,
+           const T* B, Int BRowInc, Int BColInc,
+  T beta,        T* C, Int CRowInc, Int CColInc,
+  Int numLanes )
+{
+    // Entry (i,p) of op(A) is at A[i*AI+p*AP] and entry (p,j) of op(B) is at
+    // B[p*BP+j*BJ]
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int AI = ( normalA ? ARowInc : AColInc );
+    const Int AP = ( normalA ? AColInc : ARowInc );
+    const Int BP = ( normalB ? BRowInc : BColInc );
+    const Int BJ = ( normalB ? BColInc : BRowInc );
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T* c = &C[i*CRowInc+j*CColInc];
+            if( beta == T(0) )
+                for( Int l=0; l<numLanes; ++l )
+                    c[l] = 0;
+            else if( beta != T(1) )
+                for( Int l=0; l<numLanes; ++l )
+                    c[l] *= beta;
+        }
+        for( Int p=0; p<k; ++p )
+        {
+            const T* b = &B[p*BP+j*BJ];
+            for( Int i=0; i<m; ++i )
+            {
+                const T* a = &A[i*AI+p*AP];
+                T* c = &C[i*CRowInc+j*CColInc];
+                if( !conjA && !conjB )
+                {
+                    for( Int l=0; l<numLanes; ++l )
+                        c[l] += alpha*a[l]*b[l];
+                }
+                else
+                {
+                    for( Int l=0; l<numLanes; ++l )
+                        c[l] += alpha*(conjA ? Conj(a[l]) : a[l])*
+                                      (conjB ? Conj(b[l]) : b[l]);
+                }
+            }
+        }
+    }
+}
+
+// Overwrite X with inv(T) X, where entry (i,j) of the triangular matrix T is
+// stored at U[i*TI+j*TJ] (and is conjugated if 'conjT' is true)
+template<typename F>
+void TrsmKernel
+( bool lower, bool conjT, bool unit,
+  Int m, Int n,
+  const F* U, Int TI, Int TJ,
+        F* X, Int XI, Int XJ,
+  Int numLanes )
+{
+    auto op = [&]( const F& alpha ) { return conjT ? Conj(alpha) : alpha; };
+    for( Int j=0; j<n; ++j )
+    {
+        F* x = &X[j*XJ];
+        for( Int step=0; step<m; ++step )
+        {
+            const Int p = ( lower ? step : m-1-step );
+            F* xp = &x[p*XI];
+            if( !unit )
+            {
+                const F* tau = &U[p*(TI+TJ)];
+                for( Int l=0; l<numLanes; ++l )
+                    xp[l] /= op(tau[l]);
+            }
+            const Int iBeg = ( lower ? p+1 : 0 );
+            const Int iEnd = ( lower ? m : p );
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                const F* t = &U[i*TI+p*TJ];
+                F* xi = &x[i*XI];
+                for( Int l=0; l<numLanes; ++l )
+                    xi[l] -= op(t[l])*xp[l];
+            }
+        }
+    }
+}
+
+} // namespace batched
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B,
+  T beta,        MatrixBatch<T>& C )
+{
+    DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Int mA = ( orientA == NORMAL ? A.Height() : A.Width() );
+    const Int kB = ( orientB == NORMAL ? B.Height() : B.Width() );
+    const Int nB = ( orientB == NORMAL ? B.Width() : B.Height() );
+    if( mA != m || kB != k || nB != n )
+        LogicError
+        ("Nonconformal batched Gemm: op(A) is ",mA," x ",k,", op(B) is ",
+         kB," x ",nB,", and C is ",m," x ",n);
+    batched::CheckConformal( A, C );
+    batched::CheckConformal( B, C );
+
+    const Int batchSize = C.BatchSize();
+    const Int laneBlock = C.LaneBlock();
+    const Int numBlocks = (batchSize+laneBlock-1) / laneBlock;
+    // MPFR and GMP temporaries must be formed by the calling thread, whose
+    // default precision may differ from that of the workers
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(IsThreadSafe<T>::value)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int b = block*laneBlock;
+        batched::GemmKernel
+        ( orientA, orientB, m, n, k,
+          alpha, A.LockedBuffer(b), A.RowInc(), A.ColInc(),
+                 B.LockedBuffer(b), B.RowInc(), B.ColInc(),
+          beta,  C.Buffer(b),       C.RowInc(), C.ColInc(),
+          Min(laneBlock,batchSize-b) );
+    }
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Triangular matrices must be square");
+    if( (side == LEFT  && A.Height() != B.Height()) ||
+        (side == RIGHT && A.Height() != B.Width()) )
+        LogicError("Nonconformal batched Trsm");
+    batched::CheckConformal( A, B );
+
+    // Express both cases as a left solve with T = op(A) or T = op(A)^T, in the
+    // latter case against B^T
+    const bool normal = ( orientation == NORMAL );
+    const bool left = ( side == LEFT );
+    const bool lowerOp = ( (uplo == LOWER) == normal );
+    const bool lower = ( left ? lowerOp : !lowerOp );
+    const bool conjT = ( orientation == ADJOINT );
+    const bool unit = ( diag == UNIT );
+    const bool swapT = ( left ? !normal : normal );
+    const Int TI = ( swapT ? A.ColInc() : A.RowInc() );
+    const Int TJ = ( swapT ? A.RowInc() : A.ColInc() );
+    const Int m = ( left ? B.Height() : B.Width() );
+    const Int n = ( left ? B.Width() : B.Height() );
+    const Int XI = ( left ? B.RowInc() : B.ColInc() );
+    const Int XJ = ( left ? B.ColInc() : B.RowInc() );
+
+    const Int batchSize = B.BatchSize();
+    const Int laneBlock = B.LaneBlock();
+    const Int numBlocks = (batchSize+laneBlock-1) / laneBlock;
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(IsThreadSafe<F>::value)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int b = block*laneBlock;
+        const Int numLanes = Min(laneBlock,batchSize-b);
+        F* X = B.Buffer(b);
+        if( alpha != F(1) )
+        {
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                    for( Int l=0; l<numLanes; ++l )
+                        X[i*XI+j*XJ+l] *= alpha;
+        }
+        batched::TrsmKernel
+        ( lower, conjT, unit, m, n,
+          A.LockedBuffer(b), TI, TJ, X, XI, XJ, numLanes );
+    }
+}
+
+#define PROTO_INT(T) \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const MatrixBatch<T>& A, const MatrixBatch<T>& B, \
+    T beta,        MatrixBatch<T>& C );
+
+#define PROTO(F) \
+  PROTO_INT(F) \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const MatrixBatch<F>& A, MatrixBatch<F>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
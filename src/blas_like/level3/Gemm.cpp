@@ -24,6 +24,7 @@ void Gemm
   T beta,        Matrix<T>& C )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Gemm");
     if( orientA == NORMAL && orientB == NORMAL )
     {
         if( A.Height() != C.Height() ||
@@ -59,6 +60,7 @@ void Gemm
     const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
     if( k != 0 )
     {
+        EL_PROFILE_FLOPS( (IsComplex<T>::value ? 8. : 2.)*m*n*k );
         blas::Gemm
         ( transA, transB, m, n, k,
           alpha, A.LockedBuffer(), A.LDim(),
@@ -95,6 +97,7 @@ void Gemm
   GemmAlgorithm alg )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistGemm");
     C *= beta;
     if( orientA == NORMAL && orientB == NORMAL )
     {
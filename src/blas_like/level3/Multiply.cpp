@@ -15,377 +15,380 @@ namespace El {
 
 namespace {
 
-template<typename T>
-void MultiplyCSR
-( Orientation orientation,
-  Int m, Int n,
+// The number of right-hand sides whose partial sums are accumulated together
+// (in registers) while traversing a row of a CSR matrix
+const Int rhsBlocksize = 8;
+
+// The minimal number of (nonzero,right-hand side) products which justifies
+// an additional thread
+const Int minProductsPerThread = 4096;
+
+// The following kernels support both column-major and interleaved storage of
+// the right-hand sides: entry (i,k) of X is stored at
+// X[i*xRowStride+k*xColStride], so that column-major storage corresponds to
+// (xRowStride,xColStride) = (1,ldX) and interleaved storage corresponds to
+// (xRowStride,xColStride) = (numRHS,1).
+
+// Y(i,kOff:kOff+width) := alpha A(i,:) X(:,kOff:kOff+width) + beta Y(...)
+// for i in [iBeg,iEnd), where the fixed width allows the partial sums to be
+// kept in registers and the inner loops to be vectorized
+template<Int width,typename T>
+void NormalRowsBlock
+( Int iBeg, Int iEnd, Int kOff,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   x,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   y )
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_CSE
-#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
-    char matDescrA[6];
-    matDescrA[0] = 'G';
-    matDescrA[3] = 'C';
-    mkl::csrmv
-    ( orientation, m, n, alpha, matDescrA, 
-      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
-#else
-    if( orientation == NORMAL )
+    T sums[width];
+    for( Int i=iBeg; i<iEnd; ++i )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int k=0; k<width; ++k )
+            sums[k] = 0;
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
+            const T value = values[e];
+            const T* xRow = &X[colIndices[e]*xRowStride+kOff*xColStride];
+            if( xColStride == 1 )
             {
-                const Int eStart = rowOffsets[i];
-                const int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
+                for( Int k=0; k<width; ++k )
+                    sums[k] += value*xRow[k];
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            else
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                for( Int k=0; k<width; ++k )
+                    sums[k] += value*xRow[k*xColStride];
             }
         }
+        T* yRow = &Y[i*yRowStride+kOff*yColStride];
+        for( Int k=0; k<width; ++k )
+            yRow[k*yColStride] = alpha*sums[k] + beta*yRow[k*yColStride];
     }
-#endif
 }
 
-template<>
-void MultiplyCSR<Int>
-( Orientation orientation,
-  Int m, Int n,
-  Int alpha,
+// The same as above, but for a (leftover) block of arbitrary width
+template<typename T>
+void NormalRowsBlock
+( Int iBeg, Int iEnd, Int kOff, Int width,
+  T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const Int*   values,
-  const Int*   x,
-  Int beta,
-        Int*   y )
+  const T*   values,
+  const T*   X, Int xRowStride, Int xColStride,
+  T beta,
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_CSE
-    if( orientation == NORMAL )
+    T sums[rhsBlocksize];
+    for( Int i=iBeg; i<iEnd; ++i )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            Int sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
-        }
-        else
+        for( Int k=0; k<width; ++k )
+            sums[k] = 0;
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
-            }
+            const T value = values[e];
+            const T* xRow = &X[colIndices[e]*xRowStride+kOff*xColStride];
+            for( Int k=0; k<width; ++k )
+                sums[k] += value*xRow[k*xColStride];
         }
+        T* yRow = &Y[i*yRowStride+kOff*yColStride];
+        for( Int k=0; k<width; ++k )
+            yRow[k*yColStride] = alpha*sums[k] + beta*yRow[k*yColStride];
     }
 }
 
-#ifdef EL_HAVE_QUAD
-template<>
-void MultiplyCSR<Quad>
-( Orientation orientation,
-  Int m, Int n,
-  Quad alpha,
+// Y(iBeg:iEnd,:) := alpha A(iBeg:iEnd,:) X + beta Y(iBeg:iEnd,:)
+template<typename T>
+void NormalRows
+( Int iBeg, Int iEnd, Int numRHS,
+  T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const Quad*   values,
-  const Quad*   x,
-  Quad beta,
-        Quad*   y )
+  const T*   values,
+  const T*   X, Int xRowStride, Int xColStride,
+  T beta,
+        T*   Y, Int yRowStride, Int yColStride )
 {
-    DEBUG_CSE
-    if( orientation == NORMAL )
+    if( numRHS == 1 )
     {
-        for( Int i=0; i<m; ++i )
+        for( Int i=iBeg; i<iEnd; ++i )
         {
-            Quad sum = 0;
+            T sum = 0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
             for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
-            }
+                sum += values[e]*X[colIndices[e]*xRowStride];
+            Y[i*yRowStride] = alpha*sum + beta*Y[i*yRowStride];
         }
+        return;
     }
+
+    Int kOff=0;
+    for( ; kOff+rhsBlocksize<=numRHS; kOff+=rhsBlocksize )
+        NormalRowsBlock<rhsBlocksize>
+        ( iBeg, iEnd, kOff, alpha, rowOffsets, colIndices, values,
+          X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+    if( kOff < numRHS )
+        NormalRowsBlock
+        ( iBeg, iEnd, kOff, numRHS-kOff, alpha,
+          rowOffsets, colIndices, values,
+          X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
 }
 
-template<>
-void MultiplyCSR<Complex<Quad>>
-( Orientation orientation,
-  Int m, Int n,
-  Complex<Quad> alpha,
+// Z += alpha op(A(iBeg:iEnd,:))^T X(iBeg:iEnd,:), where op conjugates if
+// requested
+template<typename T>
+void AdjointRows
+( bool conjugate, Int iBeg, Int iEnd, Int numRHS,
+  T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
-  const Complex<Quad>*   values,
-  const Complex<Quad>*   x,
-  Complex<Quad> beta,
-        Complex<Quad>*   y )
+  const T*   values,
+  const T*   X, Int xRowStride, Int xColStride,
+        T*   Z, Int zRowStride, Int zColStride )
 {
-    DEBUG_CSE
-    if( orientation == NORMAL )
+    for( Int i=iBeg; i<iEnd; ++i )
     {
-        for( Int i=0; i<m; ++i )
+        const T* xRow = &X[i*xRowStride];
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
         {
-            Complex<Quad> sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];         
-            y[i] = alpha*sum + beta*y[i];
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            y[j] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
+            const T prod = alpha*(conjugate ? Conj(values[e]) : values[e]);
+            T* zRow = &Z[colIndices[e]*zRowStride];
+            if( zColStride == 1 && xColStride == 1 )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*Conj(values[e])*x[i];         
+                for( Int k=0; k<numRHS; ++k )
+                    zRow[k] += prod*xRow[k];
             }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+            else
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*values[e]*x[i];         
+                for( Int k=0; k<numRHS; ++k )
+                    zRow[k*zColStride] += prod*xRow[k*xColStride];
             }
         }
     }
 }
-#endif // ifdef EL_HAVE_QUAD
 
+// Split the rows into contiguous chunks containing roughly the same number of
+// nonzeros
+inline void BalancedRowPartition
+( Int m, const Int* rowOffsets, Int numChunks, vector<Int>& rowStarts )
+{
+    const Int numEntries = rowOffsets[m] - rowOffsets[0];
+    rowStarts.resize( numChunks+1 );
+    rowStarts[0] = 0;
+    for( Int t=1; t<numChunks; ++t )
+    {
+        const Int target = rowOffsets[0] + (t*numEntries)/numChunks;
+        rowStarts[t] =
+          std::lower_bound( rowOffsets, rowOffsets+m+1, target ) - rowOffsets;
+        rowStarts[t] = Min( rowStarts[t], m );
+    }
+    rowStarts[numChunks] = m;
+}
+
+// Y := alpha op(A) X + beta Y for a CSR matrix A and arbitrary strides for
+// the right-hand sides. Within a hybrid build, the rows of A are partitioned
+// between threads so that each receives roughly the same number of nonzeros;
+// the transposed products are accumulated into per-thread buffers (the first
+// thread writes directly into Y) which are then reduced in parallel so that
+// no two threads update the same entry.
 template<typename T>
-void MultiplyCSR
+void MultiplyCSRStrided
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X, Int ldX,
+  const T*   X, Int xRowStride, Int xColStride,
   T beta,
-        T*   Y, Int ldY )
+        T*   Y, Int yRowStride, Int yColStride )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
+    const Int numEntries = rowOffsets[m] - rowOffsets[0];
+#ifdef EL_HYBRID
+    // The temporaries of MPFR and GMP types must be formed by the calling
+    // thread (whose default precision may differ from that of the workers)
+    Int numThreads =
+      ( omp_in_parallel() || !IsThreadSafe<T>::value ? 1 :
+        Int(omp_get_max_threads()) );
+    numThreads = Min( numThreads, (numEntries*numRHS)/minProductsPerThread );
+    numThreads = Max( numThreads, Int(1) );
+#else
+    const Int numThreads = 1;
+#endif
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        if( numThreads == 1 )
         {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
+            NormalRows
+            ( 0, m, numRHS, alpha, rowOffsets, colIndices, values,
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+            return;
         }
+#ifdef EL_HYBRID
+        vector<Int> rowStarts;
+        BalancedRowPartition( m, rowOffsets, numThreads, rowStarts );
+        #pragma omp parallel for schedule(static,1) num_threads(numThreads)
+        for( Int t=0; t<numThreads; ++t )
+            NormalRows
+            ( rowStarts[t], rowStarts[t+1], numRHS, alpha,
+              rowOffsets, colIndices, values,
+              X, xRowStride, xColStride, beta, Y, yRowStride, yColStride );
+#endif
+        return;
     }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
+
+    const bool conjugate = ( orientation == ADJOINT );
+    for( Int j=0; j<n; ++j )
         for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
+            Y[j*yRowStride+k*yColStride] *= beta;
+#ifdef EL_HYBRID
+    // Each extra thread requires an n x numRHS buffer which must later be
+    // reduced, so avoid spending more on the reduction than the products
+    if( n > 0 )
+        numThreads = Max( Min( numThreads, numEntries/n ), Int(1) );
+#endif
+    if( numThreads == 1 )
+    {
+        AdjointRows
+        ( conjugate, 0, m, numRHS, alpha, rowOffsets, colIndices, values,
+          X, xRowStride, xColStride, Y, yRowStride, yColStride );
+        return;
+    }
+#ifdef EL_HYBRID
+    vector<Int> rowStarts;
+    BalancedRowPartition( m, rowOffsets, numThreads, rowStarts );
+    const Int bufferSize = n*numRHS;
+    vector<T> buffers( (numThreads-1)*bufferSize, T(0) );
+    #pragma omp parallel num_threads(numThreads)
+    {
+        #pragma omp for schedule(static,1)
+        for( Int t=0; t<numThreads; ++t )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
-            }
+            if( t == 0 )
+                AdjointRows
+                ( conjugate, rowStarts[0], rowStarts[1], numRHS, alpha,
+                  rowOffsets, colIndices, values,
+                  X, xRowStride, xColStride, Y, yRowStride, yColStride );
+            else
+                AdjointRows
+                ( conjugate, rowStarts[t], rowStarts[t+1], numRHS, alpha,
+                  rowOffsets, colIndices, values,
+                  X, xRowStride, xColStride,
+                  &buffers[(t-1)*bufferSize], numRHS, 1 );
         }
-        else
+
+        // The implicit barrier above ensures that all of the buffers are
+        // complete
+        #pragma omp for schedule(static)
+        for( Int j=0; j<n; ++j )
         {
-            for( Int i=0; i<m; ++i )
+            for( Int t=1; t<numThreads; ++t )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i+k*ldX];         
-                }
+                const T* bufRow = &buffers[(t-1)*bufferSize+j*numRHS];
+                for( Int k=0; k<numRHS; ++k )
+                    Y[j*yRowStride+k*yColStride] += bufRow[k];
             }
         }
     }
+#endif
 }
 
 template<typename T>
-void MultiplyCSRInterX
+void MultiplyCSR
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  Int m, Int n,
   T alpha,
   const Int* rowOffsets,
   const Int* colIndices,
   const T*   values,
-  const T*   X,
+  const T*   x,
   T beta,
-        T*   Y, Int ldY )
+        T*   y )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
+#if defined(EL_HAVE_MKL) && !defined(EL_DISABLE_MKL_CSRMV)
+    char matDescrA[6];
+    matDescrA[0] = 'G';
+    matDescrA[3] = 'C';
+    mkl::csrmv
+    ( orientation, m, n, alpha, matDescrA, 
+      values, colIndices, rowOffsets, rowOffsets+1, x, beta, y );
+#else
+    MultiplyCSRStrided
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, values,
+      x, 1, 1, beta, y, 1, 1 );
+#endif
+}
 
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
-    }
+template<>
+void MultiplyCSR<Int>
+( Orientation orientation,
+  Int m, Int n,
+  Int alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const Int*   values,
+  const Int*   x,
+  Int beta,
+        Int*   y )
+{
+    DEBUG_CSE
+    MultiplyCSRStrided
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, values,
+      x, 1, 1, beta, y, 1, 1 );
+}
+
+#ifdef EL_HAVE_QUAD
+template<>
+void MultiplyCSR<Quad>
+( Orientation orientation,
+  Int m, Int n,
+  Quad alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const Quad*   values,
+  const Quad*   x,
+  Quad beta,
+        Quad*   y )
+{
+    DEBUG_CSE
+    MultiplyCSRStrided
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, values,
+      x, 1, 1, beta, y, 1, 1 );
+}
+
+template<>
+void MultiplyCSR<Complex<Quad>>
+( Orientation orientation,
+  Int m, Int n,
+  Complex<Quad> alpha,
+  const Int* rowOffsets,
+  const Int* colIndices,
+  const Complex<Quad>*   values,
+  const Complex<Quad>*   x,
+  Complex<Quad> beta,
+        Complex<Quad>*   y )
+{
+    DEBUG_CSE
+    MultiplyCSRStrided
+    ( orientation, m, n, 1, alpha, rowOffsets, colIndices, values,
+      x, 1, 1, beta, y, 1, 1 );
 }
+#endif // ifdef EL_HAVE_QUAD
 
 template<typename T>
-void MultiplyCSRInterY
+void MultiplyCSR
 ( Orientation orientation,
   Int m, Int n, Int numRHS,
   T alpha,
@@ -394,7 +397,7 @@ void MultiplyCSRInterY
   const T*   values,
   const T*   X, Int ldX,
   T beta,
-        T*   Y )
+        T*   Y, Int ldY )
 {
     DEBUG_CSE
     if( numRHS == 1 )
@@ -404,57 +407,9 @@ void MultiplyCSRInterY
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+      X, 1, ldX, beta, Y, 1, ldY );
 }
 
 template<typename T>
@@ -477,57 +432,9 @@ void MultiplyCSRInter
           rowOffsets, colIndices, values, X, beta, Y );
         return;
     }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int j=0; j<n; ++j )
-            for( Int k=0; k<numRHS; ++k )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i*numRHS+k]; 
-                }
-            }
-        }
-    }
+    MultiplyCSRStrided
+    ( orientation, m, n, numRHS, alpha, rowOffsets, colIndices, values,
+      X, numRHS, 1, beta, Y, numRHS, 1 );
 }
 
 } // anonymous namespace
@@ -539,6 +446,7 @@ void Multiply
   T beta,                                  Matrix<T>& Y )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SparseMultiply");
     DEBUG_ONLY(
       if( X.Width() != Y.Width() )
           LogicError("X and Y must have the same width");
@@ -569,17 +477,8 @@ void Multiply
           !mpi::Congruent( X.Comm(), Y.Comm() ) )
           LogicError("Communicators did not match");
     )
-
-    const bool time = false;
-
+    EL_PROFILE_REGION("DistSparseMultiply");
     mpi::Comm comm = A.Comm();
-    const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm );
-    // TODO: Use sequential implementation if commSize = 1?
-
-    Timer totalTimer, timer;
-    if( time && commRank == 0 )
-        totalTimer.Start();
 
     // Y := beta Y
     Y *= beta;
@@ -587,20 +486,27 @@ void Multiply
     A.InitializeMultMeta();
     const auto& meta = A.multMeta;
 
-    // Convert the sizes and offsets to be compatible with the current width
-    const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;    
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
+    // Gather the values of the local and ghost portions of A
+    const T* AValBuf = A.LockedValueBuffer();
+    const Int numLocalEntries = meta.localEntries.size();
+    const Int numGhostEntries = meta.ghostEntries.size();
+    vector<T> localVals, ghostVals;
+    FastResize( localVals, numLocalEntries );
+    FastResize( ghostVals, numGhostEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+        localVals[e] = AValBuf[meta.localEntries[e]];
+    for( Int e=0; e<numGhostEntries; ++e )
+        ghostVals[e] = AValBuf[meta.ghostEntries[e]];
 
+    const Int b = X.Width();
+    const Int numSendRanks = meta.sendRanks.size();
+    const Int numRecvRanks = meta.recvRanks.size();
+    const Int numSendInds = meta.sendInds.size();
+    const Int localHeight = A.LocalHeight();
+    const T* XBuffer = X.LockedMatrix().LockedBuffer();
+    const Int ldX = X.LockedMatrix().LDim();
+    T* YBuffer = Y.Matrix().Buffer();
+    const Int ldY = Y.Matrix().LDim();
     if( orientation == NORMAL )
     {
         if( A.Height() != Y.Height() )
@@ -608,39 +514,59 @@ void Multiply
         if( A.Width() != X.Height() )
             LogicError("The width of A must match the height of X");
 
-        // Pack the send values
-        const Int numSendInds = meta.sendInds.size();
+        // Post the receives for the ghost entries of X
+        vector<T> recvVals;
+        FastResize( recvVals, meta.numRecvInds*b );
+        vector<mpi::Request<T>> recvRequests(numRecvRanks);
+        for( Int r=0; r<numRecvRanks; ++r )
+        {
+            const int q = meta.recvRanks[r];
+            mpi::IRecv
+            ( &recvVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+              recvRequests[r] );
+        }
+
+        // Pack and send the entries of X which other processes require
         const Int firstLocalRow = X.FirstLocalRow();
         vector<T> sendVals;
         FastResize( sendVals, numSendInds*b );
-        const T* XBuffer = X.LockedMatrix().LockedBuffer();
-        const Int ldX = X.LockedMatrix().LDim();
-        for( Int s=0; s<numSendInds; ++s )
+        vector<mpi::Request<T>> sendRequests(numSendRanks);
+        for( Int r=0; r<numSendRanks; ++r )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
+            const int q = meta.sendRanks[r];
+            const Int sBeg = meta.sendOffs[q];
+            const Int sEnd = sBeg + meta.sendSizes[q];
+            for( Int s=sBeg; s<sEnd; ++s )
+            {
+                const Int iLoc = meta.sendInds[s] - firstLocalRow;
+                for( Int t=0; t<b; ++t )
+                    sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
+            }
+            mpi::ISend
+            ( &sendVals[sBeg*b], meta.sendSizes[q]*b, q, comm,
+              sendRequests[r] );
         }
 
-        // Now send them
-        vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(), 
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+        // While the ghost entries are in flight, perform the local
+        // multiply-accumulate with the locally-owned rows of X
+        MultiplyCSRStrided
+        ( NORMAL, localHeight, X.LocalHeight(), b,
+          alpha, meta.localRowOffs.data(),
+                 meta.localCols.data(),
+                 localVals.data(),
+                 XBuffer, 1, ldX,
+          T(1),  YBuffer, 1, ldY );
+
+        // Finish with the contributions from the ghost entries
+        mpi::WaitAll( numRecvRanks, recvRequests.data() );
+        MultiplyCSRStrided
+        ( NORMAL, localHeight, meta.numRecvInds, b,
+          alpha, meta.ghostRowOffs.data(),
+                 meta.ghostCols.data(),
+                 ghostVals.data(),
+                 recvVals.data(), b, 1,
+          T(1),  YBuffer, 1, ldY );
+        mpi::WaitAll( numSendRanks, sendRequests.data() );
     }
     else
     {
@@ -649,42 +575,63 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
-        if( time && commRank == 0 )
-            timer.Start();
-        vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
-
-        // Inject the updates to Y into the network
-        const Int numRecvInds = meta.sendInds.size();
+        // Post the receives for the updates to our rows of Y (the roles of
+        // 'send' and 'recv' are reversed in the adjoint case)
         vector<T> recvVals;
-        FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
-     
-        // Accumulate the received indices onto Y
+        FastResize( recvVals, numSendInds*b );
+        vector<mpi::Request<T>> recvRequests(numSendRanks);
+        for( Int r=0; r<numSendRanks; ++r )
+        {
+            const int q = meta.sendRanks[r];
+            mpi::IRecv
+            ( &recvVals[meta.sendOffs[q]*b], meta.sendSizes[q]*b, q, comm,
+              recvRequests[r] );
+        }
+
+        // Form and send the updates to the ghost rows of Y
+        vector<T> sendVals( meta.numRecvInds*b, T(0) );
+        MultiplyCSRStrided
+        ( orientation, localHeight, meta.numRecvInds, b,
+          alpha, meta.ghostRowOffs.data(),
+                 meta.ghostCols.data(),
+                 ghostVals.data(),
+                 XBuffer, 1, ldX,
+          T(1),  sendVals.data(), b, 1 );
+        vector<mpi::Request<T>> sendRequests(numRecvRanks);
+        for( Int r=0; r<numRecvRanks; ++r )
+        {
+            const int q = meta.recvRanks[r];
+            mpi::ISend
+            ( &sendVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+              sendRequests[r] );
+        }
+
+        // While the updates are in flight, directly update our rows of Y
+        MultiplyCSRStrided
+        ( orientation, localHeight, Y.LocalHeight(), b,
+          alpha, meta.localRowOffs.data(),
+                 meta.localCols.data(),
+                 localVals.data(),
+                 XBuffer, 1, ldX,
+          T(1),  YBuffer, 1, ldY );
+
+        // Accumulate the received updates onto Y
+        mpi::WaitAll( numSendRanks, recvRequests.data() );
         const Int firstLocalRow = Y.FirstLocalRow();
-        T* YBuffer = Y.Matrix().Buffer(); 
-        const Int ldY = Y.Matrix().LDim();
-        for( Int s=0; s<numRecvInds; ++s )
+        for( Int r=0; r<numSendRanks; ++r )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLoc = i - firstLocalRow;
-            for( Int t=0; t<b; ++t )
-                YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+            const int q = meta.sendRanks[r];
+            const Int sBeg = meta.sendOffs[q];
+            const Int sEnd = sBeg + meta.sendSizes[q];
+            for( Int s=sBeg; s<sEnd; ++s )
+            {
+                const Int iLoc = meta.sendInds[s] - firstLocalRow;
+                for( Int t=0; t<b; ++t )
+                    YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
+            }
         }
+        mpi::WaitAll( numRecvRanks, sendRequests.data() );
     }
-    if( time && commRank == 0 )
-        Output("Multiply total time: ",totalTimer.Stop());
 }
 
 #define PROTO(T) \
@@ -33,6 +33,7 @@ void Trsm
   bool checkIfSingular )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Trsm");
     DEBUG_ONLY(
       if( A.Height() != A.Width() )
           LogicError("Triangular matrix must be square");
@@ -58,6 +59,8 @@ void Trsm
             if( A.Get(j,j) == F(0) )
                 throw SingularMatrixException();
     }
+    EL_PROFILE_FLOPS
+    ( (IsComplex<F>::value ? 4. : 1.)*B.Height()*B.Width()*A.Height() );
     blas::Trsm
     ( sideChar, uploChar, transChar, diagChar, B.Height(), B.Width(),
       alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
@@ -76,6 +79,7 @@ void Trsm
   bool checkIfSingular, TrsmAlgorithm alg )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistTrsm");
     DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
@@ -28,7 +28,10 @@ void Riccati
 ( Matrix<F>& W, Matrix<F>& X, SignCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-    Sign( W, ctrl );
+    if( ctrl.structured )
+        HamiltonianSign( W, ctrl );
+    else
+        Sign( W, ctrl );
     const Int n = W.Height()/2;
     Matrix<F> WTL, WTR,
               WBL, WBR;
@@ -58,7 +61,10 @@ void Riccati
     auto& W = WProx.Get();
 
     const Grid& g = W.Grid();
-    Sign( W, ctrl );
+    if( ctrl.structured )
+        HamiltonianSign( W, ctrl );
+    else
+        Sign( W, ctrl );
     const Int n = W.Height()/2;
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
@@ -29,7 +29,10 @@ void Sylvester
   SignCtrl<Base<F>> ctrl )
 {
     DEBUG_CSE
-    Sign( W, ctrl );
+    if( ctrl.structured )
+        BlockTriangularSign( m, W, ctrl );
+    else
+        Sign( W, ctrl );
     Matrix<F> WTL, WTR,
               WBL, WBR;
     PartitionDownDiagonal
@@ -65,7 +68,10 @@ void Sylvester
     auto& W = WProx.Get();
 
     const Grid& g = W.Grid();
-    Sign( W, ctrl );
+    if( ctrl.structured )
+        BlockTriangularSign( m, W, ctrl );
+    else
+        Sign( W, ctrl );
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
     PartitionDownDiagonal
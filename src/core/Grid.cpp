@@ -8,6 +8,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1/Copy.hpp>
 
 namespace El {
 
@@ -82,6 +83,112 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+int Grid::FindNodeAwareFactor( int p, int nodeSize ) EL_NO_EXCEPT
+{
+    // Among the factors which either divide, or are multiples of, the node
+    // size, choose the one whose ratio with sqrt(p) is closest to one
+    int factor = 1;
+    double bestDist = -1;
+    for( int f=1; f<=p; ++f )
+    {
+        if( p % f != 0 || (nodeSize % f != 0 && f % nodeSize != 0) )
+            continue;
+        const double dist = Abs(log(double(f)/sqrt(double(p))));
+        if( bestDist < 0 || dist < bestDist )
+        {
+            factor = f;
+            bestDist = dist;
+        }
+    }
+    return factor;
+}
+
+Grid::Grid( mpi::Comm comm, GridOrder order, bool nodeAware )
+: haveViewers_(false), order_(order), nodeAware_(nodeAware)
+{
+    DEBUG_CSE
+    if( nodeAware_ )
+    {
+        // Renumber the processes so that those sharing a node are contiguous
+        // (preserving the original ordering within each node)
+        const int rank = mpi::Rank( comm );
+        mpi::Comm nodeComm, leaderComm;
+        mpi::SplitShared( comm, rank, nodeComm );
+        const int nodeRank = mpi::Rank( nodeComm );
+        const int nodeSize = mpi::Size( nodeComm );
+        mpi::Split
+        ( comm, ( nodeRank == 0 ? 0 : mpi::UNDEFINED ), rank, leaderComm );
+        int nodeIndex = ( nodeRank == 0 ? mpi::Rank(leaderComm) : 0 );
+        mpi::Broadcast( nodeIndex, 0, nodeComm );
+        const int maxNodeSize = mpi::AllReduce( nodeSize, mpi::MAX, comm );
+        mpi::Split( comm, 0, nodeIndex*maxNodeSize+nodeRank, viewingComm_ );
+        nodeSize_ = mpi::AllReduce( nodeSize, mpi::MIN, comm );
+        if( nodeSize_ != maxNodeSize )
+            nodeSize_ = 1;
+        if( leaderComm != mpi::COMM_NULL )
+            mpi::Free( leaderComm );
+        mpi::Free( nodeComm );
+    }
+    else
+        mpi::Dup( comm, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    size_ = mpi::Size( viewingComm_ );
+
+    // All processes own the grid, so we have to trivially split viewingGroup_
+    owningGroup_ = viewingGroup_;
+
+    // Ensure that the inner dimension of the grid, which is the height of a
+    // column-major grid and the width of a row-major grid, is compatible with
+    // the node size
+    if( nodeAware_ )
+    {
+        const int factor = FindNodeAwareFactor( size_, nodeSize_ );
+        height_ = ( order_ == COLUMN_MAJOR ? factor : size_/factor );
+    }
+    else
+        height_ = FindFactor( size_ );
+    SetUpGrid();
+    SetUpNodes();
+}
+
+void Grid::SetUpNodes()
+{
+    DEBUG_CSE
+    if( !nodeAware_ )
+        return;
+    mpi::SplitShared( viewingComm_, viewingRank_, nodeComm_ );
+    if( InGrid() )
+    {
+        mcHier_.Setup( mcComm_ );
+        mrHier_.Setup( mrComm_ );
+        vcHier_.Setup( vcComm_ );
+        vrHier_.Setup( vrComm_ );
+    }
+}
+
+const mpi::HierComm* Grid::Hier( mpi::Comm comm ) const EL_NO_EXCEPT
+{
+    if( !nodeAware_ || !InGrid() )
+        return nullptr;
+    const mpi::HierComm* hier = nullptr;
+    if( comm == mcComm_ )
+        hier = &mcHier_;
+    else if( comm == mrComm_ )
+        hier = &mrHier_;
+    else if( comm == vcComm_ )
+        hier = &vcHier_;
+    else if( comm == vrComm_ )
+        hier = &vrHier_;
+    return ( hier != nullptr && hier->Active() ? hier : nullptr );
+}
+
+bool Grid::NodeAware() const EL_NO_EXCEPT { return nodeAware_; }
+int Grid::NodeRank() const EL_NO_RELEASE_EXCEPT
+{ return ( nodeAware_ ? mpi::Rank(nodeComm_) : 0 ); }
+int Grid::NodeSize() const EL_NO_EXCEPT { return nodeSize_; }
+int Grid::NumNodes() const EL_NO_EXCEPT { return size_/nodeSize_; }
+mpi::Comm Grid::NodeComm() const EL_NO_EXCEPT { return nodeComm_; }
+
 void Grid::SetUpGrid()
 {
     DEBUG_CSE
@@ -210,8 +317,17 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // Discard any redistribution plans which refer to this grid
+    copy::ClearGeneralPurposePlans( *this );
     if( !mpi::Finalized() )
     {
+        // The hierarchical communicators refer to those of the grid
+        mcHier_.Clear();
+        mrHier_.Clear();
+        vcHier_.Clear();
+        vrHier_.Clear();
+        if( nodeComm_ != mpi::COMM_NULL )
+            mpi::Free( nodeComm_ );
         if( InGrid() )
         {
             mpi::Free( mdComm_ );
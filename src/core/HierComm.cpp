@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+namespace mpi {
+
+HierComm::~HierComm()
+{
+    if( !mpi::Finalized() )
+        Clear();
+}
+
+void HierComm::Setup( Comm comm )
+{
+    DEBUG_CSE
+    Clear();
+    comm_ = comm;
+    rank_ = Rank( comm );
+    size_ = Size( comm );
+
+    SplitShared( comm, rank_, nodeComm_ );
+    nodeRank_ = Rank( nodeComm_ );
+    nodeSize_ = Size( nodeComm_ );
+    Split( comm, ( nodeRank_ == 0 ? 0 : UNDEFINED ), rank_, leaderComm_ );
+
+    // Each node must hold a contiguous, equally-sized range of ranks
+    int leaderRank = rank_;
+    Broadcast( leaderRank, 0, nodeComm_ );
+    const int contiguous =
+      ( rank_ == leaderRank+nodeRank_ && leaderRank % nodeSize_ == 0 );
+    const int minNodeSize = AllReduce( nodeSize_, MIN, comm );
+    const int maxNodeSize = AllReduce( nodeSize_, MAX, comm );
+    const int allContiguous = AllReduce( contiguous, MIN, comm );
+    numNodes_ = size_ / nodeSize_;
+
+    active_ = HaveSharedWindows() && allContiguous &&
+              minNodeSize == maxNodeSize && minNodeSize > 1;
+}
+
+void HierComm::Clear()
+{
+    DEBUG_CSE
+    if( window_ != WIN_NULL )
+        WindowFree( window_ );
+    if( leaderComm_ != COMM_NULL )
+        Free( leaderComm_ );
+    if( nodeComm_ != COMM_NULL )
+        Free( nodeComm_ );
+    window_ = WIN_NULL;
+    windowBytes_ = 0;
+    windowBuf_ = nullptr;
+    comm_ = COMM_NULL;
+    active_ = false;
+    rank_ = nodeRank_ = 0;
+    size_ = nodeSize_ = numNodes_ = 1;
+}
+
+byte* HierComm::SharedBuffer( size_t numBytes ) const
+{
+    DEBUG_CSE
+    if( numBytes > windowBytes_ )
+    {
+        // Grow geometrically to avoid repeated (collective) reallocations
+        const size_t newBytes = Max( numBytes, 2*windowBytes_ );
+        if( window_ != WIN_NULL )
+            WindowFree( window_ );
+        WindowAllocateShared
+        ( nodeRank_ == 0 ? newBytes : 0, nodeComm_, window_ );
+        windowBuf_ = WindowSharedQuery( window_, 0 );
+        windowBytes_ = newBytes;
+        Fence();
+    }
+    return windowBuf_;
+}
+
+void HierComm::Fence() const
+{
+    DEBUG_CSE
+    WindowFence( window_ );
+}
+
+} // namespace mpi
+} // namespace El
@@ -0,0 +1,326 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+
+namespace {
+
+using El::byte;
+using El::vector;
+using std::size_t;
+
+// An allocator, which is kept alive for as long as the process so that the
+// buffers it produced can always be returned to it
+struct Allocator
+{
+    El::AllocateFunction allocate;
+    El::FreeFunction free;
+};
+
+// Each buffer is preceded by a header recording how it was obtained from the
+// underlying allocator so that it can be pooled or returned correctly
+struct BufferHeader
+{
+    size_t capacity;
+    size_t prefix;
+    size_t alignment;
+    const Allocator* allocator;
+};
+
+void* DefaultAllocate( size_t numBytes, size_t alignment )
+{
+    // Store the address returned by operator new just before the aligned
+    // buffer
+    byte* raw = static_cast<byte*>
+      (::operator new( numBytes+alignment+sizeof(void*) ));
+    const size_t rawAddress = reinterpret_cast<size_t>(raw)+sizeof(void*);
+    byte* aligned =
+      raw + sizeof(void*) + (alignment-rawAddress%alignment)%alignment;
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return aligned;
+}
+
+void DefaultFree( void* buffer, size_t numBytes )
+{ ::operator delete( reinterpret_cast<void**>(buffer)[-1] ); }
+
+const Allocator defaultAllocator{ DefaultAllocate, DefaultFree };
+std::atomic<const Allocator*> allocator(&defaultAllocator);
+
+size_t memoryAlignment = 64;
+bool memoryPooling = true;
+size_t memoryPoolLimit = size_t(1) << 22;
+bool firstTouch = false;
+
+std::atomic<size_t> memoryInUse(0), peakMemoryInUse(0), memoryPooled(0),
+  numSystemAllocations(0);
+
+// Requests are rounded up to one of four size classes per power of two
+// (so that at most a fourth of each pooled buffer is wasted)
+const size_t minClassBytes = 64;
+const size_t numSizeClasses = 4*(8*sizeof(size_t)-6)+1;
+
+inline size_t SizeClass( size_t numBytes, size_t& capacity )
+{
+    if( numBytes <= minClassBytes )
+    {
+        capacity = minClassBytes;
+        return 0;
+    }
+    const size_t m = numBytes-1;
+    size_t e = 0;
+    while( (m >> (e+1)) != 0 )
+        ++e;
+    const size_t quarter = (m >> (e-2)) - 4;
+    capacity = (5+quarter) << (e-2);
+    return 4*(e-6) + quarter + 1;
+}
+
+inline BufferHeader* HeaderOf( void* buffer )
+{ return reinterpret_cast<BufferHeader*>(buffer)-1; }
+
+void TouchPages( byte* buffer, size_t numBytes )
+{
+#ifdef EL_HYBRID
+    const size_t pageSize = 4096;
+    const El::Int numPages = (numBytes+pageSize-1) / pageSize;
+    if( numPages > 1 && omp_get_max_threads() > 1 )
+    {
+        #pragma omp parallel for schedule(static)
+        for( El::Int page=0; page<numPages; ++page )
+        {
+            const size_t offset = page*pageSize;
+            std::memset
+            ( buffer+offset, 0, El::Min(pageSize,numBytes-offset) );
+        }
+    }
+#endif
+}
+
+byte* SystemAllocate( size_t capacity, size_t alignment )
+{
+    const size_t prefix =
+      ((sizeof(BufferHeader)+alignment-1)/alignment)*alignment;
+    const Allocator* currentAllocator = ::allocator;
+    byte* base = static_cast<byte*>
+      (currentAllocator->allocate( prefix+capacity, alignment ));
+    ++numSystemAllocations;
+    byte* buffer = base + prefix;
+    BufferHeader* header = HeaderOf( buffer );
+    header->capacity = capacity;
+    header->prefix = prefix;
+    header->alignment = alignment;
+    header->allocator = currentAllocator;
+    if( firstTouch )
+        TouchPages( buffer, capacity );
+    return buffer;
+}
+
+void SystemFree( byte* buffer )
+{
+    const BufferHeader* header = HeaderOf( buffer );
+    const size_t numBytes = header->prefix + header->capacity;
+    header->allocator->free( buffer-header->prefix, numBytes );
+}
+
+// Set once the calling thread's pool has been destroyed (this flag is
+// trivially destructible, so it may still be read afterwards)
+thread_local bool poolDestroyed = false;
+
+// A cache of freed buffers, bucketed by size class, for a single thread
+struct Pool
+{
+    vector<vector<byte*>> buckets;
+    size_t numBytes;
+
+    Pool() : buckets(numSizeClasses), numBytes(0) { }
+
+    void Release()
+    {
+        for( auto& bucket : buckets )
+        {
+            for( auto* buffer : bucket )
+                SystemFree( buffer );
+            El::SwapClear( bucket );
+        }
+        memoryPooled -= numBytes;
+        numBytes = 0;
+    }
+
+    ~Pool()
+    {
+        Release();
+        poolDestroyed = true;
+    }
+};
+
+// Returns nullptr once the calling thread's pool has been destroyed (e.g.,
+// when static matrices are freed after the main thread's pool)
+Pool* ThreadPool()
+{
+    if( poolDestroyed )
+        return nullptr;
+    static thread_local Pool pool;
+    return &pool;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void SetAllocator( AllocateFunction allocate, FreeFunction free )
+{
+    // Buffers from the previous allocator (whether live or pooled by any
+    // thread) record it in their headers, so it is never destroyed
+    ::allocator = new Allocator{ allocate, free };
+    ReleaseMemoryPool();
+}
+
+void ResetAllocator()
+{
+    ::allocator = &::defaultAllocator;
+    ReleaseMemoryPool();
+}
+
+void SetMemoryAlignment( size_t alignment )
+{
+    if( alignment < sizeof(void*) || (alignment & (alignment-1)) != 0 )
+        LogicError
+        ("Alignment must be a power of two of at least ",sizeof(void*));
+    ::memoryAlignment = alignment;
+}
+
+size_t MemoryAlignment()
+{ return ::memoryAlignment; }
+
+void SetMemoryPooling( bool pooling )
+{
+    if( !pooling )
+        ReleaseMemoryPool();
+    ::memoryPooling = pooling;
+}
+
+bool MemoryPooling()
+{ return ::memoryPooling; }
+
+void SetMemoryPoolLimit( size_t numBytes )
+{ ::memoryPoolLimit = numBytes; }
+
+size_t MemoryPoolLimit()
+{ return ::memoryPoolLimit; }
+
+void ReleaseMemoryPool()
+{
+    Pool* pool = ThreadPool();
+    if( pool != nullptr )
+        pool->Release();
+}
+
+void ReleaseMemoryPools()
+{
+#ifdef EL_HYBRID
+    if( !omp_in_parallel() )
+    {
+        #pragma omp parallel
+        ReleaseMemoryPool();
+    }
+#endif
+    ReleaseMemoryPool();
+}
+
+void SetFirstTouch( bool touch )
+{ ::firstTouch = touch; }
+
+bool FirstTouch()
+{ return ::firstTouch; }
+
+size_t MemoryInUse()
+{ return ::memoryInUse; }
+
+size_t PeakMemoryInUse()
+{ return ::peakMemoryInUse; }
+
+size_t MemoryPooled()
+{ return ::memoryPooled; }
+
+size_t NumSystemAllocations()
+{ return ::numSystemAllocations; }
+
+void ResetPeakMemoryInUse()
+{ ::peakMemoryInUse = size_t(::memoryInUse); }
+
+void* AllocateBytes( size_t numBytes )
+{
+    if( numBytes == 0 )
+        return nullptr;
+    const size_t alignment = ::memoryAlignment;
+
+    byte* buffer = nullptr;
+    size_t capacity = numBytes;
+    Pool* pool = ThreadPool();
+    if( ::memoryPooling && pool != nullptr && numBytes <= ::memoryPoolLimit )
+    {
+        const size_t sizeClass = SizeClass( numBytes, capacity );
+        auto& bucket = pool->buckets[sizeClass];
+        while( !bucket.empty() && buffer == nullptr )
+        {
+            byte* candidate = bucket.back();
+            bucket.pop_back();
+            pool->numBytes -= capacity;
+            ::memoryPooled -= capacity;
+            // Discard buffers from before a change in the alignment or in
+            // the allocator
+            const BufferHeader* header = HeaderOf( candidate );
+            if( header->alignment >= alignment &&
+                header->allocator == ::allocator )
+                buffer = candidate;
+            else
+                SystemFree( candidate );
+        }
+    }
+    if( buffer == nullptr )
+        buffer = SystemAllocate( capacity, alignment );
+
+    const size_t inUse = (::memoryInUse += capacity);
+    size_t peak = ::peakMemoryInUse;
+    while( inUse > peak &&
+           !::peakMemoryInUse.compare_exchange_weak( peak, inUse ) ) { }
+    return buffer;
+}
+
+void FreeBytes( void* buffer, size_t numBytes )
+{
+    if( buffer == nullptr )
+        return;
+    byte* bytes = static_cast<byte*>(buffer);
+    const size_t capacity = HeaderOf(bytes)->capacity;
+    DEBUG_ONLY(
+      if( numBytes > capacity )
+          LogicError("Freed ",numBytes," bytes from a buffer of ",capacity);
+    )
+    ::memoryInUse -= capacity;
+
+    Pool* pool = ThreadPool();
+    if( ::memoryPooling && pool != nullptr )
+    {
+        size_t classCapacity;
+        const size_t sizeClass = SizeClass( capacity, classCapacity );
+        if( classCapacity == capacity &&
+            pool->numBytes+capacity <= ::memoryPoolLimit )
+        {
+            pool->buckets[sizeClass].push_back( bytes );
+            pool->numBytes += capacity;
+            ::memoryPooled += capacity;
+            return;
+        }
+    }
+    SystemFree( bytes );
+}
+
+} // namespace El
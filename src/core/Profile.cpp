@@ -0,0 +1,394 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+
+using El::Int;
+using El::string;
+using El::vector;
+using El::Clock;
+
+struct Stats
+{
+    Int calls=0;
+    // The number of active (recursive) calls, so that the inclusive time is
+    // only accumulated for the outermost
+    Int depth=0;
+    double time=0, exclusiveTime=0, flops=0, bytesSent=0, bytesReceived=0;
+};
+
+struct Frame
+{
+    const char* name;
+    Stats* stats;
+    Clock::time_point start;
+    double childTime, flops, bytes;
+};
+
+struct Event
+{
+    const char* name;
+    double start, duration, flops, bytes;
+};
+
+// Since the names are string literals, they are hashed by address and only
+// merged by value when the profile is written
+std::unordered_map<const char*,Stats> statsMap;
+vector<Frame> frames;
+vector<Event> events;
+
+bool enabled = true;
+bool recordTrace = false;
+Int traceLimit = Int(1) << 20;
+string outputFile;
+El::ProfileFormat outputFormat = El::PROFILE_JSON;
+Clock::time_point origin = Clock::now();
+
+inline double Seconds( Clock::time_point start, Clock::time_point stop )
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>
+           (stop-start).count();
+}
+
+inline bool Recording()
+{
+#ifdef EL_HYBRID
+    return ::enabled && omp_get_thread_num() == 0;
+#else
+    return ::enabled;
+#endif
+}
+
+// A merged view of the local statistics, indexed by routine name
+std::map<string,Stats> MergedStats()
+{
+    std::map<string,Stats> merged;
+    for( const auto& entry : ::statsMap )
+    {
+        Stats& stats = merged[entry.first];
+        stats.calls += entry.second.calls;
+        stats.time += entry.second.time;
+        stats.exclusiveTime += entry.second.exclusiveTime;
+        stats.flops += entry.second.flops;
+        stats.bytesSent += entry.second.bytesSent;
+        stats.bytesReceived += entry.second.bytesReceived;
+    }
+    return merged;
+}
+
+// Gather the strings from each process onto the root of COMM_WORLD
+vector<string> GatherStrings( const string& local )
+{
+    El::mpi::Comm comm = El::mpi::COMM_WORLD;
+    const int commSize = El::mpi::Size( comm );
+    const int commRank = El::mpi::Rank( comm );
+
+    const int localSize = local.size();
+    vector<int> sizes( commSize );
+    El::mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    vector<int> offsets;
+    const int totalSize = ( commRank == 0 ? El::Scan( sizes, offsets ) : 0 );
+    if( commRank != 0 )
+        offsets.resize( commSize, 0 );
+
+    vector<El::byte> gathered( totalSize );
+    El::mpi::Gather
+    ( reinterpret_cast<const El::byte*>(local.data()), localSize,
+      gathered.data(), sizes.data(), offsets.data(), 0, comm );
+
+    vector<string> strings;
+    if( commRank == 0 )
+    {
+        const char* data = reinterpret_cast<const char*>(gathered.data());
+        for( int q=0; q<commSize; ++q )
+            strings.emplace_back( data+offsets[q], sizes[q] );
+    }
+    return strings;
+}
+
+void WriteJSON( std::ofstream& file )
+{
+    // Each process contributes one tab-separated line per routine
+    std::ostringstream os;
+    os.precision( 17 );
+    for( const auto& entry : MergedStats() )
+    {
+        const Stats& stats = entry.second;
+        os << entry.first << "\t" << stats.calls << "\t" << stats.time << "\t"
+           << stats.exclusiveTime << "\t" << stats.flops << "\t"
+           << stats.bytesSent << "\t" << stats.bytesReceived << "\n";
+    }
+    const vector<string> strings = GatherStrings( os.str() );
+    if( El::mpi::Rank(El::mpi::COMM_WORLD) != 0 )
+        return;
+
+    struct Aggregate
+    {
+        Int calls=0, numProcesses=0;
+        double minTime=0, maxTime=0, sumTime=0, sumExclusiveTime=0,
+               flops=0, bytesSent=0, bytesReceived=0;
+    };
+    std::map<string,Aggregate> aggregates;
+    for( const auto& processString : strings )
+    {
+        std::istringstream is( processString );
+        string line;
+        while( std::getline( is, line ) )
+        {
+            std::istringstream lineStream( line );
+            string name;
+            Stats stats;
+            std::getline( lineStream, name, '\t' );
+            lineStream >> stats.calls >> stats.time >> stats.exclusiveTime
+                       >> stats.flops >> stats.bytesSent
+                       >> stats.bytesReceived;
+            Aggregate& agg = aggregates[name];
+            if( agg.numProcesses == 0 )
+            {
+                agg.minTime = stats.time;
+                agg.maxTime = stats.time;
+            }
+            else
+            {
+                agg.minTime = El::Min( agg.minTime, stats.time );
+                agg.maxTime = El::Max( agg.maxTime, stats.time );
+            }
+            ++agg.numProcesses;
+            agg.calls += stats.calls;
+            agg.sumTime += stats.time;
+            agg.sumExclusiveTime += stats.exclusiveTime;
+            agg.flops += stats.flops;
+            agg.bytesSent += stats.bytesSent;
+            agg.bytesReceived += stats.bytesReceived;
+        }
+    }
+
+    file.precision( 9 );
+    file << "{\n"
+         << "  \"numProcesses\": " << strings.size() << ",\n"
+         << "  \"routines\": [";
+    bool first = true;
+    for( const auto& entry : aggregates )
+    {
+        const Aggregate& agg = entry.second;
+        const double gflops =
+          ( agg.maxTime > 0 ? agg.flops/agg.maxTime/1e9 : 0 );
+        file << ( first ? "\n" : ",\n" )
+             << "    {\"name\": \"" << entry.first << "\", "
+             << "\"numProcesses\": " << agg.numProcesses << ", "
+             << "\"calls\": " << agg.calls << ", "
+             << "\"minTime\": " << agg.minTime << ", "
+             << "\"maxTime\": " << agg.maxTime << ", "
+             << "\"avgTime\": " << agg.sumTime/agg.numProcesses << ", "
+             << "\"avgExclusiveTime\": "
+             << agg.sumExclusiveTime/agg.numProcesses << ", "
+             << "\"flops\": " << agg.flops << ", "
+             << "\"gflopsPerSec\": " << gflops << ", "
+             << "\"bytesSent\": " << agg.bytesSent << ", "
+             << "\"bytesReceived\": " << agg.bytesReceived << "}";
+        first = false;
+    }
+    file << "\n  ]\n}\n";
+}
+
+void WriteChromeTrace( std::ofstream& file )
+{
+    const int commRank = El::mpi::Rank( El::mpi::COMM_WORLD );
+    std::ostringstream os;
+    os.precision( 15 );
+    for( const auto& event : ::events )
+    {
+        os << ",\n  {\"name\": \"" << event.name << "\", \"ph\": \"X\", "
+           << "\"pid\": " << commRank << ", \"tid\": 0, "
+           << "\"ts\": " << event.start*1e6 << ", "
+           << "\"dur\": " << event.duration*1e6 << ", "
+           << "\"args\": {\"flops\": " << event.flops << ", "
+           << "\"bytes\": " << event.bytes << "}}";
+    }
+    const vector<string> strings = GatherStrings( os.str() );
+    if( commRank != 0 )
+        return;
+
+    file << "{\"traceEvents\": [\n"
+         << "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, "
+         << "\"args\": {\"name\": \"Elemental\"}}";
+    for( const auto& processString : strings )
+        file << processString;
+    file << "\n]}\n";
+}
+
+} // anonymous namespace
+
+namespace El {
+namespace profile {
+
+void Enable( bool enable )
+{ ::enabled = enable; }
+
+void Disable()
+{ ::enabled = false; }
+
+bool Enabled()
+{ return ::enabled; }
+
+void SetOutput( const string& filename, ProfileFormat format )
+{
+    ::outputFile = filename;
+    ::outputFormat = format;
+    ::recordTrace = ( format == PROFILE_CHROME_TRACE );
+}
+
+void SetTraceLimit( Int limit )
+{ ::traceLimit = limit; }
+
+Int TraceLimit()
+{ return ::traceLimit; }
+
+void Write( const string& filename, ProfileFormat format )
+{
+    DEBUG_CSE
+    // Avoid profiling the communication used to gather the profile
+    const bool wasEnabled = ::enabled;
+    ::enabled = false;
+
+    std::ofstream file;
+    if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+    {
+        file.open( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+    }
+    if( format == PROFILE_CHROME_TRACE )
+        WriteChromeTrace( file );
+    else
+        WriteJSON( file );
+
+    ::enabled = wasEnabled;
+}
+
+void Reset()
+{
+    ::statsMap.clear();
+    ::frames.clear();
+    SwapClear( ::events );
+    ::origin = Clock::now();
+}
+
+Counters LocalCounters( const string& name )
+{
+    Counters counters;
+    for( const auto& entry : ::statsMap )
+    {
+        if( name != entry.first )
+            continue;
+        counters.calls += entry.second.calls;
+        counters.time += entry.second.time;
+        counters.exclusiveTime += entry.second.exclusiveTime;
+        counters.flops += entry.second.flops;
+        counters.bytesSent += entry.second.bytesSent;
+        counters.bytesReceived += entry.second.bytesReceived;
+    }
+    return counters;
+}
+
+void AddFlops( double flops )
+{
+    if( !Recording() || ::frames.empty() )
+        return;
+    Frame& frame = ::frames.back();
+    frame.stats->flops += flops;
+    frame.flops += flops;
+}
+
+void AddBytes( double bytesSent, double bytesReceived )
+{
+    if( !Recording() || ::frames.empty() )
+        return;
+    Frame& frame = ::frames.back();
+    frame.stats->bytesSent += bytesSent;
+    frame.stats->bytesReceived += bytesReceived;
+    frame.bytes += bytesSent + bytesReceived;
+}
+
+Region::Region( const char* name )
+: active_(false)
+{
+    if( !Recording() )
+        return;
+    Frame frame;
+    frame.name = name;
+    frame.stats = &::statsMap[name];
+    frame.childTime = 0;
+    frame.flops = 0;
+    frame.bytes = 0;
+    ++frame.stats->depth;
+    frame.start = Clock::now();
+    ::frames.push_back( frame );
+    active_ = true;
+}
+
+Region::~Region()
+{
+    if( !active_ || ::frames.empty() )
+        return;
+    const auto stop = Clock::now();
+    const Frame& frame = ::frames.back();
+    const double time = Seconds( frame.start, stop );
+    Stats& stats = *frame.stats;
+    ++stats.calls;
+    if( --stats.depth == 0 )
+        stats.time += time;
+    stats.exclusiveTime += time - frame.childTime;
+    if( ::recordTrace && Int(::events.size()) < ::traceLimit )
+    {
+        Event event;
+        event.name = frame.name;
+        event.start = Seconds( ::origin, frame.start );
+        event.duration = time;
+        event.flops = frame.flops;
+        event.bytes = frame.bytes;
+        ::events.push_back( event );
+    }
+    ::frames.pop_back();
+    if( !::frames.empty() )
+        ::frames.back().childTime += time;
+}
+
+void Initialize()
+{
+#ifdef EL_PROFILE
+    Reset();
+    const char* filename = std::getenv( "EL_PROFILE_OUTPUT" );
+    if( filename != nullptr )
+    {
+        const char* formatString = std::getenv( "EL_PROFILE_FORMAT" );
+        const bool chrome =
+          formatString != nullptr && string(formatString) == "chrome";
+        SetOutput( filename, chrome ? PROFILE_CHROME_TRACE : PROFILE_JSON );
+    }
+#endif
+}
+
+void Finalize()
+{
+#ifdef EL_PROFILE
+    if( !::outputFile.empty() && !mpi::Finalized() )
+        Write( ::outputFile, ::outputFormat );
+    Reset();
+#endif
+}
+
+} // namespace profile
+} // namespace El
@@ -190,6 +190,7 @@ void Initialize( int& argc, char**& argv )
 #endif
 
     InitializeRandom();
+    profile::Initialize();
 
     // Create the types and ops
     // NOTE: mpfr::SetPrecision created the BigFloat types
@@ -210,6 +211,8 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        profile::Finalize();
+
         delete ::args;
         ::args = 0;
 
@@ -226,6 +229,7 @@ void Finalize()
 
 
         EmptyBlocksizeStack();
+        ReleaseMemoryPools();
 
 #ifdef EL_HAVE_QD
         FinalizeQD();
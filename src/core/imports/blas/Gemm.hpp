@@ -44,222 +44,331 @@ void EL_BLAS(zgemm)
 namespace El {
 namespace blas {
 
+namespace gemm {
+
+// Register (MR x NR) and cache (MC x KC panels of A, KC x NC panels of B)
+// blocking parameters for the packed generic Gemm. The defaults are chosen so
+// that a packed MC x KC panel of A fits comfortably within L2 and a KC x NR
+// sliver of B within L1; types whose arithmetic is dominated by software
+// emulation rather than memory traffic use smaller panels.
 template<typename T>
-void Gemm
-( char transA, char transB,
-  BlasInt m, BlasInt n, BlasInt k,
-  const T& alpha,
-  const T* A, BlasInt ALDim,
-  const T* B, BlasInt BLDim,
-  const T& beta,
-        T* C, BlasInt CLDim )
+struct Blocksize
 {
-    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
-    //       involves a memory allocation
-    if( m > 0 && n > 0 && k == 0 && beta == T(0) )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] = 0;
-        return;
-    }
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 128;
+    static const BlasInt KC = 256;
+    static const BlasInt NC = 2048;
+};
 
-    // Scale C
-    if( beta == T(0) )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] = 0;
-    }
-    else if( beta != T(1) )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<m; ++i )
-                C[i+j*CLDim] *= beta;
-    }
+#ifdef EL_HAVE_QD
+template<>
+struct Blocksize<QuadDouble>
+{
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 64;
+    static const BlasInt KC = 128;
+    static const BlasInt NC = 1024;
+};
+template<>
+struct Blocksize<Complex<DoubleDouble>>
+{
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 64;
+    static const BlasInt KC = 128;
+    static const BlasInt NC = 1024;
+};
+template<>
+struct Blocksize<Complex<QuadDouble>>
+{
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 2;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 128;
+    static const BlasInt NC = 512;
+};
+#endif
+#ifdef EL_HAVE_QUAD
+template<>
+struct Blocksize<Complex<Quad>>
+{
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 64;
+    static const BlasInt KC = 128;
+    static const BlasInt NC = 1024;
+};
+#endif
+#ifdef EL_HAVE_MPC
+// The limbs of a BigInt/BigFloat live on the heap, so register tiling only
+// serves to amortize the loads of the packed operands
+template<>
+struct Blocksize<BigInt>
+{
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 64;
+    static const BlasInt NC = 256;
+};
+template<>
+struct Blocksize<BigFloat>
+{
+    static const BlasInt MR = 4;
+    static const BlasInt NR = 4;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 64;
+    static const BlasInt NC = 256;
+};
+template<>
+struct Blocksize<Complex<BigFloat>>
+{
+    static const BlasInt MR = 2;
+    static const BlasInt NR = 2;
+    static const BlasInt MC = 32;
+    static const BlasInt KC = 64;
+    static const BlasInt NC = 256;
+};
+#endif
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
+// Pack alpha op(A)(iOff:iOff+mc,lOff:lOff+kc) into MR x kc row slivers, each
+// stored with the MR entries of a column contiguous
+template<typename T>
+void PackA
+( char transA, BlasInt mc, BlasInt kc, BlasInt iOff, BlasInt lOff,
+  const T& alpha, const T* A, BlasInt ALDim, T* APack )
+{
+    const BlasInt MR = Blocksize<T>::MR;
+    const bool normal = ( transA == 'N' );
+    const bool conjugate = ( transA == 'C' );
+    const bool scale = ( alpha != T(1) );
+    for( BlasInt ir=0; ir<mc; ir+=MR )
     {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
+        const BlasInt mr = Min(MR,mc-ir);
+        T* APackSliver = &APack[ir*kc];
+        for( BlasInt l=0; l<kc; ++l )
         {
-            for( BlasInt l=0; l<k; ++l )
+            for( BlasInt i=0; i<mr; ++i )
             {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
+                const BlasInt iA = iOff + ir + i;
+                const BlasInt lA = lOff + l;
+                T& alpha_il = APackSliver[i+l*MR];
+                if( normal )
+                    alpha_il = A[iA+lA*ALDim];
+                else if( conjugate )
+                    Conj( A[lA+iA*ALDim], alpha_il );
+                else
+                    alpha_il = A[lA+iA*ALDim];
+                if( scale )
+                    alpha_il *= alpha;
             }
         }
     }
-    else if( std::toupper(transA) == 'N' )
+}
+
+// Pack op(B)(lOff:lOff+kc,jOff:jOff+nc) into kc x NR column slivers, each
+// stored with the NR entries of a row contiguous
+template<typename T>
+void PackB
+( char transB, BlasInt kc, BlasInt nc, BlasInt lOff, BlasInt jOff,
+  const T* B, BlasInt BLDim, T* BPack )
+{
+    const BlasInt NR = Blocksize<T>::NR;
+    const bool normal = ( transB == 'N' );
+    const bool conjugate = ( transB == 'C' );
+    EL_PARALLEL_FOR
+    for( BlasInt jr=0; jr<nc; jr+=NR )
     {
-        if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
+        const BlasInt nr = Min(NR,nc-jr);
+        T* BPackSliver = &BPack[jr*kc];
+        for( BlasInt l=0; l<kc; ++l )
         {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
+            for( BlasInt j=0; j<nr; ++j )
             {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
+                const BlasInt lB = lOff + l;
+                const BlasInt jB = jOff + jr + j;
+                T& beta_lj = BPackSliver[j+l*NR];
+                if( normal )
+                    beta_lj = B[lB+jB*BLDim];
+                else if( conjugate )
+                    Conj( B[jB+lB*BLDim], beta_lj );
+                else
+                    beta_lj = B[jB+lB*BLDim];
             }
         }
     }
-    else if( std::toupper(transB) == 'N' )
+}
+
+// C(0:mr,0:nr) += APack BPack, where APack is an MR x kc sliver and BPack is
+// a kc x NR sliver. The accumulator and scratch entries are supplied by the
+// caller so that no temporaries are constructed within the loop. The tile
+// extents are either BlasInt's or std::integral_constant's, so that the
+// loops over full tiles have compile-time trip counts.
+template<typename T,typename RowExtent,typename ColExtent>
+inline void MicroKernel
+( RowExtent mr, ColExtent nr, BlasInt kc,
+  const T* EL_RESTRICT APack, const T* EL_RESTRICT BPack,
+        T* EL_RESTRICT C, BlasInt CLDim,
+        T* EL_RESTRICT acc, T& delta )
+{
+    const BlasInt MR = Blocksize<T>::MR;
+    const BlasInt NR = Blocksize<T>::NR;
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            acc[i+j*MR] = 0;
+    for( BlasInt l=0; l<kc; ++l )
     {
-        if( std::toupper(transA) == 'T' )
+        const T* a = &APack[l*MR];
+        const T* b = &BPack[l*NR];
+        for( BlasInt j=0; j<nr; ++j )
         {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<mr; ++i )
             {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
+                delta = a[i];
+                delta *= b[j];
+                acc[i+j*MR] += delta;
             }
         }
     }
-    else
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += acc[i+j*MR];
+}
+
+// C(0:mc,0:nc) += APack BPack, sweeping the packed slivers with the
+// micro-kernel (which is specialized at compile time for full MR x NR tiles)
+template<typename T>
+void MacroKernel
+( BlasInt mc, BlasInt nc, BlasInt kc,
+  const T* APack, const T* BPack,
+        T* C, BlasInt CLDim,
+        T* acc, T& delta )
+{
+    const BlasInt MR = Blocksize<T>::MR;
+    const BlasInt NR = Blocksize<T>::NR;
+    for( BlasInt jr=0; jr<nc; jr+=NR )
     {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
+        const BlasInt nr = Min(NR,nc-jr);
+        for( BlasInt ir=0; ir<mc; ir+=MR )
         {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
+            const BlasInt mr = Min(MR,mc-ir);
+            T* CTile = &C[ir+jr*CLDim];
+            if( mr == MR && nr == NR )
+                MicroKernel
+                ( std::integral_constant<BlasInt,Blocksize<T>::MR>(),
+                  std::integral_constant<BlasInt,Blocksize<T>::NR>(),
+                  kc, &APack[ir*kc], &BPack[jr*kc], CTile, CLDim, acc, delta );
+            else
+                MicroKernel
+                ( mr, nr, kc, &APack[ir*kc], &BPack[jr*kc],
+                  CTile, CLDim, acc, delta );
         }
-        else
+    }
+}
+
+// C := alpha op(A) op(B) + C via GotoBLAS-style packing: for each KC x NC
+// panel of op(B) (packed once and shared), each MC x KC panel of op(A) is
+// packed (with alpha folded in) and multiplied by the macro-kernel. With
+// EL_HYBRID, the MC-row blocks of C are distributed over the threads.
+template<typename T>
+void Packed
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    const BlasInt MR = Blocksize<T>::MR;
+    const BlasInt NR = Blocksize<T>::NR;
+    const BlasInt MC = Blocksize<T>::MC;
+    const BlasInt KC = Blocksize<T>::KC;
+    const BlasInt NC = Blocksize<T>::NC;
+
+    // Size the workspaces for the panels that will actually be packed so that
+    // small products (e.g., of BigFloat's) do not pay for unused entries
+    const BlasInt mcMax = Min(MC,((m+MR-1)/MR)*MR);
+    const BlasInt kcMax = Min(KC,k);
+    const BlasInt ncMax = Min(NC,((n+NR-1)/NR)*NR);
+#ifdef EL_HYBRID
+    const BlasInt numThreads = Min(BlasInt(omp_get_max_threads()),(m+MC-1)/MC);
+#else
+    const BlasInt numThreads = 1;
+#endif
+    vector<T> BPack(kcMax*ncMax), APacks(numThreads*mcMax*kcMax),
+              accs(numThreads*MR*NR), deltas(numThreads);
+
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
         {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
+            const BlasInt kc = Min(KC,k-pc);
+            PackB( transB, kc, nc, pc, jc, B, BLDim, BPack.data() );
+
+            const BlasInt numRowBlocks = (m+MC-1)/MC;
+#ifdef EL_HYBRID
+            #pragma omp parallel for num_threads(numThreads)
+#endif
+            for( BlasInt icBlock=0; icBlock<numRowBlocks; ++icBlock )
             {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );       
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
+#ifdef EL_HYBRID
+                const BlasInt thread = omp_get_thread_num();
+#else
+                const BlasInt thread = 0;
+#endif
+                const BlasInt ic = icBlock*MC;
+                const BlasInt mc = Min(MC,m-ic);
+                T* APack = &APacks[thread*mcMax*kcMax];
+                PackA( transA, mc, kc, ic, pc, alpha, A, ALDim, APack );
+                MacroKernel
+                ( mc, nc, kc, APack, BPack.data(), &C[ic+jc*CLDim], CLDim,
+                  &accs[thread*MR*NR], deltas[thread] );
             }
         }
     }
 }
+
+} // namespace gemm
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
+    //       involves a memory allocation
+    if( m <= 0 || n <= 0 )
+        return;
+
+    // Scale C
+    if( beta == T(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != T(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+    if( k <= 0 || alpha == T(0) )
+        return;
+
+    // C := alpha op(A) op(B) + C
+    gemm::Packed
+    ( char(std::toupper(transA)), char(std::toupper(transB)), m, n, k,
+      alpha, A, ALDim, B, BLDim, C, CLDim );
+}
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -13,6 +13,7 @@ namespace {
 
 size_t numLimbs;
 int numIntLimbs;
+bool contiguousLimbs = false;
 
 El::BigInt bigIntZero, bigIntOne, bigIntTwo;
 
@@ -69,6 +70,12 @@ void SetMinIntBits( int numBits )
     previouslySet = true;
 }
 
+void SetContiguousLimbs( bool contiguous )
+{ ::contiguousLimbs = contiguous; }
+
+bool ContiguousLimbs()
+{ return ::contiguousLimbs; }
+
 int NumIntBits()
 { return ::numIntLimbs*GMP_NUMB_BITS; }
 
@@ -20,6 +20,7 @@ void BigFloat::Init( mpfr_prec_t prec )
 {
     mpfr_init2( mpfrFloat_, prec );
     SetNumLimbs( prec );
+    ownsLimbs_ = true;
 }
 
 mpfr_ptr BigFloat::Pointer()
@@ -39,13 +40,31 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
-    SetNumLimbs( prec );
+    if( ownsLimbs_ )
+    {
+        mpfr_set_prec( mpfrFloat_, prec ); 
+        SetNumLimbs( prec );
+    }
+    else if( size_t((prec-1)/GMP_NUMB_BITS+1) <= numLimbs_ )
+    {
+        // The external limbs can hold the new precision
+        mpfr_custom_init_set
+        ( mpfrFloat_, MPFR_NAN_KIND, 0, prec, mpfrFloat_->_mpfr_d );
+        SetNumLimbs( prec );
+    }
+    else
+    {
+        // Abandon the external limbs in favor of our own
+        Init( prec );
+    }
 }
 
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::OwnsLimbs() const
+{ return ownsLimbs_; }
+
 BigFloat::BigFloat()
 {
     DEBUG_CSE
@@ -223,15 +242,34 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     DEBUG_CSE
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.ownsLimbs_ )
+    {
+        Pointer()->_mpfr_d = 0;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+        ownsLimbs_ = true;
+    }
+    else
+    {
+        // The limbs of 'a' belong to an arena and cannot be stolen
+        Init( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
+}
+
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec )
+{
+    DEBUG_CSE
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( mpfrFloat_, MPFR_NAN_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+    ownsLimbs_ = false;
 }
 
 BigFloat::~BigFloat()
 {
     DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( ownsLimbs_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -388,8 +426,16 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     DEBUG_CSE
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( ownsLimbs_ && a.ownsLimbs_ )
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // Arena-backed limbs must stay with their owner
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
     return *this;
 }
 
@@ -1398,6 +1444,87 @@ std::istream& operator>>( std::istream& is, BigFloat& alpha )
     return is;
 }
 
+namespace mpfr {
+
+namespace {
+
+// The entries (and limbs) of each array are aligned to cache lines, and the
+// line preceding the entries holds the bookkeeping for freeing the array
+const size_t arrayAlignment = 64;
+
+struct ArrayHeader
+{
+    void* block;
+    size_t blockBytes;
+    size_t size;
+};
+
+inline size_t RoundUp( size_t n, size_t alignment )
+{ return ((n+alignment-1)/alignment)*alignment; }
+
+} // anonymous namespace
+
+BigFloat* NewBigFloatArray( size_t size )
+{
+    DEBUG_CSE
+    static_assert
+    ( sizeof(ArrayHeader) <= arrayAlignment,
+      "The array header does not fit within its alignment" );
+    const bool contiguous = ContiguousLimbs();
+    const mpfr_prec_t prec = Precision();
+    const size_t numLimbs = (prec-1) / GMP_NUMB_BITS + 1;
+
+    const size_t entryBytes = RoundUp( size*sizeof(BigFloat), arrayAlignment );
+    const size_t limbBytes =
+      ( contiguous ? size*numLimbs*sizeof(mp_limb_t) : 0 );
+    const size_t blockBytes =
+      (arrayAlignment-1) + arrayAlignment + entryBytes + limbBytes;
+    void* block = AllocateBytes( blockBytes );
+
+    const size_t blockAddress = reinterpret_cast<size_t>(block);
+    byte* alignedStart =
+      static_cast<byte*>(block) +
+      (RoundUp(blockAddress,arrayAlignment)-blockAddress);
+    ArrayHeader* header = reinterpret_cast<ArrayHeader*>(alignedStart);
+    header->block = block;
+    header->blockBytes = blockBytes;
+    header->size = size;
+
+    BigFloat* array =
+      reinterpret_cast<BigFloat*>(alignedStart+arrayAlignment);
+    if( contiguous )
+    {
+        mp_limb_t* limbs =
+          reinterpret_cast<mp_limb_t*>(alignedStart+arrayAlignment+entryBytes);
+        for( size_t i=0; i<size; ++i )
+            new (&array[i]) BigFloat( &limbs[i*numLimbs], prec );
+    }
+    else
+    {
+        for( size_t i=0; i<size; ++i )
+            new (&array[i]) BigFloat;
+    }
+    return array;
+}
+
+void DeleteBigFloatArray( BigFloat* array )
+{
+    DEBUG_CSE
+    if( array == nullptr )
+        return;
+    const ArrayHeader* header =
+      reinterpret_cast<const ArrayHeader*>
+      (reinterpret_cast<byte*>(array)-arrayAlignment);
+    void* block = header->block;
+    const size_t blockBytes = header->blockBytes;
+    const size_t size = header->size;
+    for( size_t i=0; i<size; ++i )
+        array[i].~BigFloat();
+    FreeBytes( block, blockBytes );
+}
+
+} // namespace mpfr
+
 } // namespace El
 
 #endif // ifdef EL_HAVE_MPC
@@ -35,6 +35,22 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
 namespace El {
 namespace mpi {
 
+#ifdef EL_PROFILE
+namespace {
+
+// The sum of the counts for each member of the communicator
+inline int SumCounts( const int* counts, Comm comm )
+{
+    const int commSize = Size( comm );
+    int total = 0;
+    for( int q=0; q<commSize; ++q )
+        total += counts[q];
+    return total;
+}
+
+} // anonymous namespace
+#endif
+
 bool CommSameSizeAsInteger() EL_NO_EXCEPT
 { return sizeof(MPI_Comm) == sizeof(int); }
 
@@ -157,6 +173,68 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &newComm.comm ) );
+#else
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &newComm.comm ) );
+#endif
+}
+
+bool HaveSharedWindows() EL_NO_EXCEPT
+{
+#if MPI_VERSION >= 3
+    return true;
+#else
+    return false;
+#endif
+}
+
+void WindowAllocateShared
+( size_t numBytes, Comm comm, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    void* base;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( Aint(numBytes), 1, MPI_INFO_NULL, comm.comm, &base, &window ) );
+#else
+    LogicError("Shared-memory windows require MPI-3");
+#endif
+}
+
+byte* WindowSharedQuery( Window window, int rank ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    Aint numBytes;
+    int dispUnit;
+    void* base;
+    SafeMpi( MPI_Win_shared_query( window, rank, &numBytes, &dispUnit, &base ) );
+    return static_cast<byte*>(base);
+#else
+    LogicError("Shared-memory windows require MPI-3");
+    return nullptr;
+#endif
+}
+
+void WindowFence( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    SafeMpi( MPI_Win_fence( 0, window ) );
+}
+
+void WindowFree( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+    SafeMpi( MPI_Win_free( &window ) );
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
@@ -459,6 +537,7 @@ void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
         request.receivingPacked = false;
     }
     request.buffer.clear();
+    request.sendBuffer.clear();
 }
 
 template<typename T,typename,typename>
@@ -497,6 +576,7 @@ EL_NO_RELEASE_EXCEPT
             requests[j].receivingPacked = false;
         }
         requests[j].buffer.clear();
+        requests[j].sendBuffer.clear();
     }
 }
 
@@ -526,6 +606,7 @@ void TaggedSend( const Real* buf, int count, int to, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::Send",sizeof(Real)*count,0);
     SafeMpi
     ( MPI_Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
@@ -537,6 +618,7 @@ void TaggedSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::Send",sizeof(Complex<Real>)*count,0);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -554,6 +636,7 @@ template<typename T,typename,typename>
 void TaggedSend( const T* buf, int count, int to, int tag, Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::Send",sizeof(T)*count,0);
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
@@ -579,6 +662,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ISend",sizeof(Real)*count,0);
     SafeMpi
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -591,6 +675,7 @@ void TaggedISend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ISend",sizeof(Complex<Real>)*count,0);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -610,6 +695,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ISend",sizeof(T)*count,0);
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Isend
@@ -640,6 +726,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::IRSend",sizeof(Real)*count,0);
     SafeMpi
     ( MPI_Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -652,6 +739,7 @@ void TaggedIRSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::IRSend",sizeof(Complex<Real>)*count,0);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irsend
@@ -672,6 +760,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::IRSend",sizeof(T)*count,0);
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Irsend
@@ -701,6 +790,7 @@ void TaggedISSend
   Request<Real>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ISSend",sizeof(Real)*count,0);
     SafeMpi
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
@@ -713,6 +803,7 @@ void TaggedISSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ISSend",sizeof(Complex<Real>)*count,0);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -732,6 +823,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ISSend",sizeof(T)*count,0);
     Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Issend
@@ -754,6 +846,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::Recv",0,sizeof(Real)*count);
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
@@ -764,6 +857,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::Recv",0,sizeof(Complex<Real>)*count);
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -779,6 +873,7 @@ template<typename T,typename,typename>
 void TaggedRecv( T* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::Recv",0,sizeof(T)*count);
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Status status;
@@ -810,6 +905,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::IRecv",0,sizeof(Real)*count);
     SafeMpi
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
@@ -822,6 +918,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::IRecv",0,sizeof(Complex<Real>)*count);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv
@@ -841,6 +938,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::IRecv",0,sizeof(T)*count);
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
@@ -873,6 +971,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::SendRecv",sizeof(Real)*sc,sizeof(Real)*rc);
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -888,6 +987,10 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::SendRecv",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*rc);
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -911,6 +1014,7 @@ void TaggedSendRecv
         T* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::SendRecv",sizeof(T)*sc,sizeof(T)*rc);
     Status status;
     std::vector<byte> packedSend, packedRecv;
     Serialize( sc, sbuf, packedSend );
@@ -950,6 +1054,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::SendRecv",sizeof(Real)*count,sizeof(Real)*count);
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -964,6 +1069,10 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::SendRecv",
+     sizeof(Complex<Real>)*count,
+     sizeof(Complex<Real>)*count);
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -984,6 +1093,7 @@ void TaggedSendRecv
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::SendRecv",sizeof(T)*count,sizeof(T)*count);
     std::vector<byte> packedBuf;
     ReserveSerialized( count, buf, packedBuf );
     Serialize( count, buf, packedBuf );
@@ -1005,6 +1115,10 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Broadcast",
+     sizeof(Real)*(Rank(comm)==root ? count : 0),
+     sizeof(Real)*(Rank(comm)==root ? 0 : count));
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1015,6 +1129,10 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Broadcast",
+     sizeof(Complex<Real>)*(Rank(comm)==root ? count : 0),
+     sizeof(Complex<Real>)*(Rank(comm)==root ? 0 : count));
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1029,6 +1147,10 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Broadcast",
+     sizeof(T)*(Rank(comm)==root ? count : 0),
+     sizeof(T)*(Rank(comm)==root ? 0 : count));
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1048,6 +1170,10 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::IBroadcast",
+     sizeof(Real)*(Rank(comm)==root ? count : 0),
+     sizeof(Real)*(Rank(comm)==root ? 0 : count));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Ibcast
@@ -1063,6 +1189,10 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::IBroadcast",
+     sizeof(Complex<Real>)*(Rank(comm)==root ? count : 0),
+     sizeof(Complex<Real>)*(Rank(comm)==root ? 0 : count));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1084,14 +1214,20 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::IBroadcast",
+     sizeof(T)*(Rank(comm)==root ? count : 0),
+     sizeof(T)*(Rank(comm)==root ? 0 : count));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    request.receivingPacked = true;
+    // The root's packed buffer is sent as-is and the others are unpacked by
+    // Wait
+    request.receivingPacked = ( Rank(comm) != root );
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    Serialize( count, buf, request.buffer );
     SafeMpi
     ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1109,6 +1245,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Gather",
+     sizeof(Real)*sc,
+     sizeof(Real)*(Rank(comm)==root ? rc*Size(comm) : 0));
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1122,6 +1262,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Gather",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*(Rank(comm)==root ? rc*Size(comm) : 0));
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1144,6 +1288,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Gather",
+     sizeof(T)*sc,
+     sizeof(T)*(Rank(comm)==root ? rc*Size(comm) : 0));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1169,6 +1317,10 @@ void IGather
   Request<Real>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::IGather",
+     sizeof(Real)*sc,
+     sizeof(Real)*(Rank(comm)==root ? rc*Size(comm) : 0));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Igather
@@ -1188,6 +1340,10 @@ void IGather
   Request<Complex<Real>>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::IGather",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*(Rank(comm)==root ? rc*Size(comm) : 0));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1215,7 +1371,12 @@ void IGather
   Request<T>& request )
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::IGather",
+     sizeof(T)*sc,
+     sizeof(T)*(Rank(comm)==root ? rc*Size(comm) : 0));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    Serialize( sc, sbuf, request.sendBuffer );
     if( mpi::Rank(comm) == root )
     {
         const int commSize = mpi::Size(comm);
@@ -1226,8 +1387,8 @@ void IGather
     }
     SafeMpi
     ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1242,6 +1403,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Gather",
+     sizeof(Real)*sc,
+     sizeof(Real)*(Rank(comm)==root ? SumCounts(rcs,comm) : 0));
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf), 
@@ -1263,6 +1428,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Gather",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*(Rank(comm)==root ? SumCounts(rcs,comm) : 0));
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1305,6 +1474,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Gather",
+     sizeof(T)*sc,
+     sizeof(T)*(Rank(comm)==root ? SumCounts(rcs,comm) : 0));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1338,6 +1511,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllGather",
+     sizeof(Real)*sc,
+     sizeof(Real)*rc*Size(comm));
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1359,6 +1536,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllGather",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*rc*Size(comm));
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1391,6 +1572,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::AllGather",sizeof(T)*sc,sizeof(T)*rc*Size(comm));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1405,6 +1587,84 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,typename>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_PROFILE_COMM
+    ("mpi::IAllGather",
+     sizeof(Real)*sc,
+     sizeof(Real)*rc*Size(comm));
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+#endif
+}
+
+template<typename Real,typename>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_PROFILE_COMM
+    ("mpi::IAllGather",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*rc*Size(comm));
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_PROFILE_COMM("mpi::IAllGather",sizeof(T)*sc,sizeof(T)*rc*Size(comm));
+    const int totalRecv = rc*Size(comm);
+    Serialize( sc, sbuf, request.sendBuffer );
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    SafeMpi
+    ( MPI_Iallgather
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), comm.comm,
+        &request.backend ) );
+#else
+    AllGather( sbuf, sc, rbuf, rc, comm );
+#endif
+}
+
 template<typename Real,typename>
 void AllGather
 ( const Real* sbuf, int sc,
@@ -1412,6 +1672,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllGather",
+     sizeof(Real)*sc,
+     sizeof(Real)*SumCounts(rcs,comm));
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1446,6 +1710,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllGather",
+     sizeof(Complex<Real>)*sc,
+     sizeof(Complex<Real>)*SumCounts(rcs,comm));
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1496,6 +1764,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllGather",
+     sizeof(T)*sc,
+     sizeof(T)*SumCounts(rcs,comm));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1523,6 +1795,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Scatter",
+     sizeof(Real)*(Rank(comm)==root ? sc*Size(comm) : 0),
+     sizeof(Real)*rc);
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1536,6 +1812,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Scatter",
+     sizeof(Complex<Real>)*(Rank(comm)==root ? sc*Size(comm) : 0),
+     sizeof(Complex<Real>)*rc);
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1558,6 +1838,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Scatter",
+     sizeof(T)*(Rank(comm)==root ? sc*Size(comm) : 0),
+     sizeof(T)*rc);
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1579,6 +1863,10 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Scatter",
+     sizeof(Real)*(Rank(comm)==root ? sc*Size(comm) : 0),
+     sizeof(Real)*rc);
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1601,6 +1889,10 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Scatter",
+     sizeof(Complex<Real>)*(Rank(comm)==root ? sc*Size(comm) : 0),
+     sizeof(Complex<Real>)*rc);
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1637,6 +1929,10 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Scatter",
+     sizeof(T)*(Rank(comm)==root ? sc*Size(comm) : 0),
+     sizeof(T)*rc);
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1662,6 +1958,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllToAll",
+     sizeof(Real)*sc*Size(comm),
+     sizeof(Real)*rc*Size(comm));
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1675,6 +1975,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllToAll",
+     sizeof(Complex<Real>)*sc*Size(comm),
+     sizeof(Complex<Real>)*rc*Size(comm));
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1699,6 +2003,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllToAll",
+     sizeof(T)*sc*Size(comm),
+     sizeof(T)*rc*Size(comm));
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1720,6 +2028,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllToAll",
+     sizeof(Real)*SumCounts(scs,comm),
+     sizeof(Real)*SumCounts(rcs,comm));
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf), 
@@ -1740,6 +2052,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllToAll",
+     sizeof(Complex<Real>)*SumCounts(scs,comm),
+     sizeof(Complex<Real>)*SumCounts(rcs,comm));
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1779,6 +2095,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllToAll",
+     sizeof(T)*SumCounts(scs,comm),
+     sizeof(T)*SumCounts(rcs,comm));
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1822,6 +2142,10 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Reduce",
+     sizeof(Real)*count,
+     sizeof(Real)*(Rank(comm)==root ? count : 0));
     if( count == 0 )
         return;
 
@@ -1848,6 +2172,10 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Reduce",
+     sizeof(Complex<Real>)*count,
+     sizeof(Complex<Real>)*(Rank(comm)==root ? count : 0));
     if( count == 0 )
         return;
 
@@ -1884,6 +2212,10 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Reduce",
+     sizeof(T)*count,
+     sizeof(T)*(Rank(comm)==root ? count : 0));
     if( count == 0 )
         return;
 
@@ -1939,6 +2271,10 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Reduce",
+     sizeof(Real)*count,
+     sizeof(Real)*(Rank(comm)==root ? count : 0));
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -1971,6 +2307,10 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Reduce",
+     sizeof(Complex<Real>)*count,
+     sizeof(Complex<Real>)*(Rank(comm)==root ? count : 0));
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2031,6 +2371,10 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::Reduce",
+     sizeof(T)*count,
+     sizeof(T)*(Rank(comm)==root ? count : 0));
     if( count == 0 )
         return;
 
@@ -2070,6 +2414,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::AllReduce",sizeof(Real)*count,sizeof(Real)*count);
     if( count != 0 )
     {
         MPI_Op opC;
@@ -2095,6 +2440,10 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllReduce",
+     sizeof(Complex<Real>)*count,
+     sizeof(Complex<Real>)*count);
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2130,6 +2479,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::AllReduce",sizeof(T)*count,sizeof(T)*count);
     if( count == 0 )
         return;
 
@@ -2174,6 +2524,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::AllReduce",sizeof(Real)*count,sizeof(Real)*count);
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2197,6 +2548,10 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::AllReduce",
+     sizeof(Complex<Real>)*count,
+     sizeof(Complex<Real>)*count);
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2230,6 +2585,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::AllReduce",sizeof(T)*count,sizeof(T)*count);
     if( count == 0 )
         return;
 
@@ -2259,11 +2615,125 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,typename>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_PROFILE_COMM("mpi::IAllReduce",sizeof(Real)*count,sizeof(Real)*count);
+    MPI_Op opC;
+    if( op == SUM )
+        opC = SumOp<Real>().op;
+    else if( op == MAX )
+        opC = MaxOp<Real>().op;
+    else if( op == MIN )
+        opC = MinOp<Real>().op;
+    else
+        opC = op.op;
+
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename Real,typename>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_PROFILE_COMM
+    ("mpi::IAllReduce",
+     sizeof(Complex<Real>)*count,
+     sizeof(Complex<Real>)*count);
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = SumOp<Real>().op;
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = op.op;
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
+            opC, comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = ( op==SUM ? SumOp<Complex<Real>>().op : op.op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#endif
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 )
+        return;
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    EL_PROFILE_COMM("mpi::IAllReduce",sizeof(T)*count,sizeof(T)*count);
+    MPI_Op opC;
+    if( op == SUM )
+        opC = SumOp<T>().op;
+    else if( op == MAX )
+        opC = MaxOp<T>().op;
+    else if( op == MIN )
+        opC = MinOp<T>().op;
+    else
+        opC = op.op;
+
+    // The packed buffer is reduced in place and unpacked by Wait
+    Serialize( count, buf, request.buffer );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = buf;
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, request.buffer.data(), count, TypeMap<T>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,typename>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(Real)*rc*Size(comm),
+     sizeof(Real)*rc);
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2297,6 +2767,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(Complex<Real>)*rc*Size(comm),
+     sizeof(Complex<Real>)*rc);
     if( rc == 0 )
         return;
 
@@ -2329,6 +2803,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ReduceScatter",sizeof(T)*rc*Size(comm),sizeof(T)*rc);
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2383,6 +2858,10 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(Real)*rc*Size(comm),
+     sizeof(Real)*rc);
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2418,6 +2897,10 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(Complex<Real>)*rc*Size(comm),
+     sizeof(Complex<Real>)*rc);
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2451,6 +2934,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM("mpi::ReduceScatter",sizeof(T)*rc*Size(comm),sizeof(T)*rc);
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2496,6 +2980,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(Real)*SumCounts(rcs,comm),
+     sizeof(Real)*rcs[Rank(comm)]);
     MPI_Op opC;
     if( op == SUM )
         opC = SumOp<Real>().op; 
@@ -2519,6 +3007,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(Complex<Real>)*SumCounts(rcs,comm),
+     sizeof(Complex<Real>)*rcs[Rank(comm)]);
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2558,6 +3050,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
+    EL_PROFILE_COMM
+    ("mpi::ReduceScatter",
+     sizeof(T)*SumCounts(rcs,comm),
+     sizeof(T)*rcs[Rank(comm)]);
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2955,6 +3451,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -3006,6 +3505,10 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -17,6 +17,20 @@ std::mt19937 generator;
 gmp_randstate_t gmpRandState;
 #endif
 
+// The seed shared by all processes for the counter-based generators and the
+// index of the next stream to be used by a distributed generator
+std::uint64_t counterSeed = 21;
+El::Int counterStream = 0;
+
+// The finalizer of the SplitMix64 generator, which is used to scramble
+// (seed,stream) pairs into Philox keys
+std::uint64_t Scramble( std::uint64_t z )
+{
+    z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
 }
 
 namespace El {
@@ -31,6 +45,11 @@ void InitializeRandom( bool deterministic )
 
     srand( seed );
 
+    // Unlike the above, the counter-based seed must agree on all processes
+    Int counterSeed = secs;
+    mpi::Broadcast( counterSeed, 0, mpi::COMM_WORLD );
+    SetCounterSeed( std::uint64_t(counterSeed) );
+
 #ifdef EL_HAVE_MPC
     mpfr::SetMinIntBits( 256 );
     mpfr::SetPrecision( 256 );
@@ -49,6 +68,34 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+void SetCounterSeed( std::uint64_t seed )
+{
+    ::counterSeed = seed;
+    ::counterStream = 0;
+}
+
+std::uint64_t CounterSeed()
+{ return ::counterSeed; }
+
+std::uint64_t NextCounterKey( mpi::Comm comm )
+{
+    DEBUG_CSE
+    // Processes which have taken part in different numbers of distributed
+    // generations (e.g., over different subcommunicators) agree upon the
+    // largest stream index so that no stream is reused
+    const Int stream = mpi::AllReduce( ::counterStream, mpi::MAX, comm );
+    ::counterStream = stream + 1;
+    return ::Scramble( ::counterSeed + ::Scramble(stream) );
+}
+
+std::uint64_t LocalCounterKey()
+{
+    std::mt19937& gen = Generator();
+    const std::uint64_t hi = gen();
+    const std::uint64_t lo = gen();
+    return (hi << 32) | lo;
+}
+
 #ifdef EL_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_BINARYHEADER_HPP
+#define EL_IO_BINARYHEADER_HPP
+
+namespace El {
+namespace io {
+
+// The original revision of the BINARY format stores the height and width of
+// the matrix followed by its column-major entries. The second revision
+// begins with the entries
+//
+//   [magic, revision, sizeof(T), height, width, dataOffset],
+//
+// zero-padded up to the data offset (a page boundary), so that the entries
+// can be memory-mapped in place. The magic number is negative so that it
+// cannot be mistaken for the height of an original-revision file.
+const Int binaryMagic = -0x454C4232;
+const Int binaryRevision = 2;
+const Int binaryHeaderLength = 6;
+const Int binaryDataOffset = 4096;
+
+struct BinaryHeader
+{
+    Int revision;
+    Int height;
+    Int width;
+    Int dataOffset;
+};
+
+// Interpret the (up to) binaryHeaderLength leading entries of a BINARY file
+// of the given size
+template<typename T>
+BinaryHeader ParseBinaryHeader
+( const Int* entries, Int numBytes, const string& filename )
+{
+    DEBUG_CSE
+    BinaryHeader header;
+    if( numBytes < Int(2*sizeof(Int)) )
+        RuntimeError(filename," is too small to be a BINARY file");
+    if( entries[0] == binaryMagic )
+    {
+        if( numBytes < Int(binaryHeaderLength*sizeof(Int)) )
+            RuntimeError(filename," has a truncated header");
+        header.revision = entries[1];
+        if( header.revision != binaryRevision )
+            RuntimeError
+            ("Unsupported BINARY revision ",header.revision," in ",filename);
+        if( entries[2] != Int(sizeof(T)) )
+            RuntimeError
+            (filename," stores ",entries[2],"-byte entries but ",sizeof(T),
+             " bytes were expected");
+        header.height = entries[3];
+        header.width = entries[4];
+        header.dataOffset = entries[5];
+    }
+    else
+    {
+        header.revision = 1;
+        header.height = entries[0];
+        header.width = entries[1];
+        header.dataOffset = 2*sizeof(Int);
+    }
+
+    const Int numBytesExp =
+      header.dataOffset + header.height*header.width*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    return header;
+}
+
+// Fill the (binaryDataOffset bytes of) the current header revision
+template<typename T>
+vector<char> FormBinaryHeader( Int height, Int width )
+{
+    vector<char> header( binaryDataOffset, 0 );
+    const Int entries[binaryHeaderLength] =
+      { binaryMagic, binaryRevision, Int(sizeof(T)), height, width,
+        binaryDataOffset };
+    MemCopy( header.data(), (const char*)entries, sizeof(entries) );
+    return header;
+}
+
+// Sparse matrices are stored in the BINARY_SPARSE format as the entries
+//
+//   [magic, revision, sizeof(T), height, width, numEntries],
+//
+// followed by the row indices, the column indices, and the values of the
+// nonzeros (each as a contiguous array). The entries are sorted by row so
+// that each process can locate its rows of a distributed matrix.
+const Int binarySparseMagic = -0x454C5350;
+const Int binarySparseRevision = 1;
+
+struct BinarySparseHeader
+{
+    Int height;
+    Int width;
+    Int numEntries;
+
+    Int SourceOffset() const { return binaryHeaderLength*sizeof(Int); }
+    Int TargetOffset() const { return SourceOffset()+numEntries*sizeof(Int); }
+    Int ValueOffset() const { return TargetOffset()+numEntries*sizeof(Int); }
+};
+
+template<typename T>
+BinarySparseHeader ParseBinarySparseHeader
+( const Int* entries, Int numBytes, const string& filename )
+{
+    DEBUG_CSE
+    if( numBytes < Int(binaryHeaderLength*sizeof(Int)) ||
+        entries[0] != binarySparseMagic )
+        RuntimeError(filename," is not a BINARY_SPARSE file");
+    if( entries[1] != binarySparseRevision )
+        RuntimeError
+        ("Unsupported BINARY_SPARSE revision ",entries[1]," in ",filename);
+    if( entries[2] != Int(sizeof(T)) )
+        RuntimeError
+        (filename," stores ",entries[2],"-byte entries but ",sizeof(T),
+         " bytes were expected");
+    BinarySparseHeader header;
+    header.height = entries[3];
+    header.width = entries[4];
+    header.numEntries = entries[5];
+    const Int numBytesExp =
+      header.ValueOffset() + header.numEntries*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    return header;
+}
+
+template<typename T>
+vector<Int> FormBinarySparseHeader( Int height, Int width, Int numEntries )
+{
+    return vector<Int>
+      { binarySparseMagic, binarySparseRevision, Int(sizeof(T)), height, width,
+        numEntries };
+}
+
+} // namespace io
+} // namespace El
+
+#endif // ifndef EL_IO_BINARYHEADER_HPP
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_FILEVIEW_HPP
+#define EL_IO_FILEVIEW_HPP
+
+namespace El {
+namespace io {
+
+inline void
+SafeMpiIO( int mpiError, const string& filename )
+{
+    if( mpiError != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int lengthOfErrorString;
+        MPI_Error_string( mpiError, errorString, &lengthOfErrorString );
+        RuntimeError
+        ("MPI-IO failure on ",filename,": ",std::string(errorString));
+    }
+}
+
+// A file which is collectively opened over the viewing communicator of a
+// distributed matrix (and closed when the object is destroyed)
+struct CollectiveFile
+{
+    MPI_File handle;
+    mpi::Comm comm;
+    string filename;
+
+    CollectiveFile( mpi::Comm fileComm, const string& name, bool write )
+    : comm(fileComm), filename(name)
+    {
+        DEBUG_CSE
+        const int mode =
+          ( write ? MPI_MODE_CREATE|MPI_MODE_WRONLY : MPI_MODE_RDONLY );
+        const int error =
+          MPI_File_open
+          ( comm.comm, const_cast<char*>(filename.c_str()), mode,
+            MPI_INFO_NULL, &handle );
+        if( error != MPI_SUCCESS )
+            RuntimeError("Could not open ",filename);
+    }
+
+    ~CollectiveFile() { MPI_File_close( &handle ); }
+
+    Int Size() const
+    {
+        MPI_Offset numBytes;
+        SafeMpiIO( MPI_File_get_size( handle, &numBytes ), filename );
+        return numBytes;
+    }
+};
+
+// Independently read or write a contiguous range of bytes of the file (in
+// pieces whose sizes fit within an int)
+const Int maxBytesPerTransfer = 1<<30;
+
+inline void
+ReadBytes( CollectiveFile& file, Int offset, void* buffer, Int numBytes )
+{
+    DEBUG_CSE
+    char* bufferBytes = static_cast<char*>(buffer);
+    for( Int start=0; start<numBytes; start+=maxBytesPerTransfer )
+    {
+        const int count = Min(numBytes-start,maxBytesPerTransfer);
+        SafeMpiIO
+        ( MPI_File_read_at
+          ( file.handle, offset+start, bufferBytes+start, count, MPI_BYTE,
+            MPI_STATUS_IGNORE ), file.filename );
+    }
+}
+
+inline void
+WriteBytes
+( CollectiveFile& file, Int offset, const void* buffer, Int numBytes )
+{
+    DEBUG_CSE
+    char* bufferBytes = static_cast<char*>(const_cast<void*>(buffer));
+    for( Int start=0; start<numBytes; start+=maxBytesPerTransfer )
+    {
+        const int count = Min(numBytes-start,maxBytesPerTransfer);
+        SafeMpiIO
+        ( MPI_File_write_at
+          ( file.handle, offset+start, bufferBytes+start, count, MPI_BYTE,
+            MPI_STATUS_IGNORE ), file.filename );
+    }
+}
+
+// Build the MPI datatypes which map the locally-owned entries of A between
+// the column-major, height x width array of entries stored in the file and
+// the local buffer. The file type is a list of (global) row runs repeated at
+// the offsets of the local columns, so that its description requires
+// O(localHeight+localWidth) rather than O(localHeight*localWidth) storage
+// (and block-cyclic distributions yield runs of full blocks).
+template<typename T>
+void LocalTypes
+( const AbstractDistMatrix<T>& A,
+  bool contributing,
+  mpi::Datatype& entryType,
+  mpi::Datatype& fileType,
+  mpi::Datatype& memType,
+  int& memCount )
+{
+    DEBUG_CSE
+    MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType );
+    MPI_Type_commit( &entryType );
+
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    if( !contributing || localHeight == 0 || localWidth == 0 )
+    {
+        // Set a trivial view and transfer nothing
+        MPI_Type_dup( entryType, &fileType );
+        MPI_Type_dup( entryType, &memType );
+        memCount = 0;
+        return;
+    }
+
+    // The run starts are stored as byte displacements so that files with
+    // more than 2^31 bytes can be described
+    vector<Int> rowRunStarts;
+    vector<int> rowRunSizes;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( !rowRunStarts.empty() &&
+            i == rowRunStarts.back()+rowRunSizes.back() )
+            ++rowRunSizes.back();
+        else
+        {
+            rowRunStarts.push_back( i );
+            rowRunSizes.push_back( 1 );
+        }
+    }
+    const Int numRowRuns = rowRunStarts.size();
+    vector<MPI_Aint> rowRunOffsets( numRowRuns );
+    for( Int run=0; run<numRowRuns; ++run )
+        rowRunOffsets[run] = MPI_Aint(rowRunStarts[run])*sizeof(T);
+    mpi::Datatype colType;
+    MPI_Type_create_hindexed
+    ( numRowRuns, rowRunSizes.data(), rowRunOffsets.data(), entryType,
+      &colType );
+
+    vector<int> colCounts( localWidth, 1 );
+    vector<MPI_Aint> colOffsets( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colOffsets[jLoc] = MPI_Aint(A.GlobalCol(jLoc))*height*sizeof(T);
+    MPI_Type_create_hindexed
+    ( localWidth, colCounts.data(), colOffsets.data(), colType, &fileType );
+    MPI_Type_commit( &fileType );
+    mpi::Free( colType );
+
+    MPI_Type_vector( localWidth, localHeight, A.LDim(), entryType, &memType );
+    MPI_Type_commit( &memType );
+    memCount = 1;
+}
+
+// Collectively read the locally-owned entries of A from the column-major
+// array of entries which begins at the given byte offset of the file
+template<typename T>
+void ReadLocal
+( AbstractDistMatrix<T>& A, CollectiveFile& file, Int dataOffset )
+{
+    DEBUG_CSE
+    mpi::Datatype entryType, fileType, memType;
+    int memCount;
+    LocalTypes
+    ( A, A.Participating(), entryType, fileType, memType, memCount );
+    SafeMpiIO
+    ( MPI_File_set_view
+      ( file.handle, dataOffset, entryType, fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ), file.filename );
+    SafeMpiIO
+    ( MPI_File_read_all
+      ( file.handle, A.Buffer(), memCount, memType, MPI_STATUS_IGNORE ),
+      file.filename );
+    mpi::Free( memType );
+    mpi::Free( fileType );
+    mpi::Free( entryType );
+}
+
+// Collectively write the locally-owned entries of A into the column-major
+// array of entries which begins at the given byte offset of the file (only
+// one member of each redundant group contributes)
+template<typename T>
+void WriteLocal
+( const AbstractDistMatrix<T>& A, CollectiveFile& file, Int dataOffset )
+{
+    DEBUG_CSE
+    const bool contributing = A.Participating() && A.RedundantRank() == 0;
+    mpi::Datatype entryType, fileType, memType;
+    int memCount;
+    LocalTypes( A, contributing, entryType, fileType, memType, memCount );
+    SafeMpiIO
+    ( MPI_File_set_view
+      ( file.handle, dataOffset, entryType, fileType,
+        const_cast<char*>("native"), MPI_INFO_NULL ), file.filename );
+    SafeMpiIO
+    ( MPI_File_write_all
+      ( file.handle, const_cast<T*>(A.LockedBuffer()), memCount, memType,
+        MPI_STATUS_IGNORE ), file.filename );
+    mpi::Free( memType );
+    mpi::Free( fileType );
+    mpi::Free( entryType );
+}
+
+} // namespace io
+} // namespace El
+
+#endif // ifndef EL_IO_FILEVIEW_HPP
@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "./BinaryHeader.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace El {
+
+namespace {
+
+void SafeSystemCall( int error, const string& call, const string& filename )
+{
+    if( error != 0 )
+        RuntimeError(call," failed for ",filename,": ",std::strerror(errno));
+}
+
+void ReadBytes
+( int fd, void* buffer, Int numBytes, Int offset, const string& filename )
+{
+    char* bytes = static_cast<char*>(buffer);
+    while( numBytes > 0 )
+    {
+        const auto numRead = pread( fd, bytes, numBytes, offset );
+        if( numRead <= 0 )
+            RuntimeError
+            ("Could not read from ",filename,": ",std::strerror(errno));
+        bytes += numRead;
+        numBytes -= numRead;
+        offset += numRead;
+    }
+}
+
+bool WriteBytes( int fd, const void* buffer, Int numBytes, Int offset )
+{
+    const char* bytes = static_cast<const char*>(buffer);
+    while( numBytes > 0 )
+    {
+        const auto numWritten = pwrite( fd, bytes, numBytes, offset );
+        if( numWritten <= 0 )
+            return false;
+        bytes += numWritten;
+        numBytes -= numWritten;
+        offset += numWritten;
+    }
+    return fsync( fd ) == 0;
+}
+
+} // anonymous namespace
+
+// The entire file, including any header, is mapped so that the mapping
+// begins on a page boundary; revision-2 BINARY files place their entries at
+// a page-aligned offset, but the original revision (and BINARY_FLAT) can be
+// mapped as well. The entries of an original-revision file are only aligned
+// to sizeof(Int) (e.g., a 32-bit Int misaligns Quad and Complex<double>), in
+// which case they are copied into memory rather than viewed in place.
+template<typename T>
+MappedFile<T>::MappedFile
+( const string filename, MappingMode mode, FileFormat format,
+  Int height, Int width )
+: filename_(filename), mode_(mode)
+{
+    DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("Only BINARY and BINARY_FLAT files can be mapped");
+    const bool create = ( mode == MAPPED_CREATE );
+    if( (create || format == BINARY_FLAT) && (height < 0 || width < 0) )
+        LogicError("The dimensions of the mapped file must be specified");
+
+    const int flags = ( mode == MAPPED_READ_ONLY ? O_RDONLY :
+                        create ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR );
+    fd_ = open( filename.c_str(), flags, 0644 );
+    if( fd_ < 0 )
+        RuntimeError("Could not open ",filename,": ",std::strerror(errno));
+
+    // The descriptor must be released if the file cannot be mapped
+    try
+    {
+        if( create )
+        {
+            height_ = height;
+            width_ = width;
+            if( format == BINARY )
+            {
+                const auto header = io::FormBinaryHeader<T>( height, width );
+                dataOffset_ = header.size();
+                if( write( fd_, header.data(), header.size() ) !=
+                    ssize_t(header.size()) )
+                    RuntimeError
+                    ("Could not write header of ",filename,": ",
+                     std::strerror(errno));
+            }
+            mappedBytes_ = dataOffset_ + height*width*sizeof(T);
+            SafeSystemCall
+            ( ftruncate( fd_, mappedBytes_ ), "ftruncate", filename );
+        }
+        else
+        {
+            struct stat fileStat;
+            SafeSystemCall( fstat( fd_, &fileStat ), "fstat", filename );
+            mappedBytes_ = fileStat.st_size;
+            if( format == BINARY )
+            {
+                Int entries[io::binaryHeaderLength] = { 0 };
+                const Int maxHeaderBytes = io::binaryHeaderLength*sizeof(Int);
+                const Int headerBytes = Min(mappedBytes_,maxHeaderBytes);
+                const auto numRead = pread( fd_, entries, headerBytes, 0 );
+                if( numRead != ssize_t(headerBytes) )
+                    RuntimeError
+                    ("Could not read header of ",filename,": ",
+                     std::strerror(errno));
+                const auto header =
+                  io::ParseBinaryHeader<T>( entries, mappedBytes_, filename );
+                height_ = header.height;
+                width_ = header.width;
+                dataOffset_ = header.dataOffset;
+            }
+            else
+            {
+                height_ = height;
+                width_ = width;
+                const Int numBytesExp = height*width*sizeof(T);
+                if( mappedBytes_ != numBytesExp )
+                    RuntimeError
+                    ("Expected file to be ",numBytesExp," bytes but found ",
+                     mappedBytes_);
+            }
+        }
+
+        if( dataOffset_ % Int(alignof(T)) != 0 )
+        {
+            buffer_.resize( height_*width_ );
+            if( !create )
+                ReadBytes
+                ( fd_, buffer_.data(), buffer_.size()*sizeof(T), dataOffset_,
+                  filename );
+            data_ = buffer_.data();
+        }
+        else if( mappedBytes_ > 0 )
+        {
+            const int prot =
+              ( mode == MAPPED_READ_ONLY ? PROT_READ : PROT_READ | PROT_WRITE );
+            base_ = mmap( nullptr, mappedBytes_, prot, MAP_SHARED, fd_, 0 );
+            if( base_ == MAP_FAILED )
+            {
+                base_ = nullptr;
+                RuntimeError
+                ("Could not map ",filename,": ",std::strerror(errno));
+            }
+            char* dataBytes = static_cast<char*>(base_) + dataOffset_;
+            data_ = reinterpret_cast<T*>( dataBytes );
+        }
+    }
+    catch( ... )
+    {
+        close( fd_ );
+        fd_ = -1;
+        throw;
+    }
+}
+
+template<typename T>
+MappedFile<T>::~MappedFile()
+{
+    if( base_ != nullptr )
+    {
+        // Errors cannot be safely reported from a destructor
+        if( Writable() )
+            msync( base_, mappedBytes_, MS_SYNC );
+        munmap( base_, mappedBytes_ );
+    }
+    if( Writable() && !buffer_.empty() )
+        WriteBytes
+        ( fd_, buffer_.data(), buffer_.size()*sizeof(T), dataOffset_ );
+    if( fd_ >= 0 )
+        close( fd_ );
+}
+
+template<typename T>
+void MappedFile<T>::View( Matrix<T>& A )
+{
+    DEBUG_CSE
+    if( !Writable() )
+        LogicError("Cannot form a mutable view of a read-only mapping");
+    A.Attach( height_, width_, data_, Max(height_,Int(1)) );
+}
+
+template<typename T>
+void MappedFile<T>::LockedView( Matrix<T>& A ) const
+{
+    DEBUG_CSE
+    A.LockedAttach( height_, width_, data_, Max(height_,Int(1)) );
+}
+
+template<typename T>
+void MappedFile<T>::Flush()
+{
+    DEBUG_CSE
+    if( Writable() && base_ != nullptr )
+        SafeSystemCall
+        ( msync( base_, mappedBytes_, MS_SYNC ), "msync", filename_ );
+    if( Writable() && !buffer_.empty() &&
+        !WriteBytes
+         ( fd_, buffer_.data(), buffer_.size()*sizeof(T), dataOffset_ ) )
+        RuntimeError
+        ("Could not write to ",filename_,": ",std::strerror(errno));
+}
+
+#define PROTO(T) template class MappedFile<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
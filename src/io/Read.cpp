@@ -8,10 +8,14 @@
 */
 #include <El.hpp>
 
+#include "./FileView.hpp"
+#include "./BinaryHeader.hpp"
+
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
+#include "./Read/BinarySparse.hpp"
 #include "./Read/MatrixMarket.hpp"
 
 namespace El {
@@ -102,12 +106,56 @@ void Read
     }
 }
 
+template<typename T>
+void Read( SparseMatrix<T>& A, const string filename, FileFormat format )
+{
+    DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY_SPARSE:
+        read::BinarySparse( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for reading sparse matrices");
+    }
+}
+
+template<typename T>
+void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
+{
+    DEBUG_CSE
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY_SPARSE:
+        read::BinarySparse( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for reading sparse matrices");
+    }
+}
+
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const string filename, FileFormat format ); \
   template void Read \
   ( AbstractDistMatrix<T>& A, const string filename, \
-    FileFormat format, bool sequential );
+    FileFormat format, bool sequential ); \
+  template void Read \
+  ( SparseMatrix<T>& A, const string filename, FileFormat format ); \
+  template void Read \
+  ( DistSparseMatrix<T>& A, const string filename, FileFormat format );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -21,16 +21,15 @@ Binary( Matrix<T>& A, const string filename )
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
     const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    const Int maxHeaderBytes = io::binaryHeaderLength*sizeof(Int);
+    Int entries[io::binaryHeaderLength] = { 0 };
+    file.read( (char*)entries, Min(numBytes,maxHeaderBytes) );
+    const auto header = io::ParseBinaryHeader<T>( entries, numBytes, filename );
+    const Int height = header.height;
+    const Int width = header.width;
+    file.clear();
+    file.seekg( header.dataOffset );
 
     A.Resize( height, width );
     if( A.Height() == A.LDim() )
@@ -40,66 +39,27 @@ Binary( Matrix<T>& A, const string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Each process collectively reads its local entries through an MPI-IO file
+// view rather than funneling the file through a single process
 template<typename T>
 inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     DEBUG_CSE
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    io::CollectiveFile file( A.Grid().ViewingComm(), filename, false );
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    const Int numBytes = file.Size();
+    const Int maxHeaderBytes = io::binaryHeaderLength*sizeof(Int);
+    Int entries[io::binaryHeaderLength] = { 0 };
+    const int headerBytes = Min(numBytes,maxHeaderBytes);
+    io::SafeMpiIO
+    ( MPI_File_read_at_all
+      ( file.handle, 0, entries, headerBytes, MPI_BYTE, MPI_STATUS_IGNORE ),
+      filename );
+    const auto header = io::ParseBinaryHeader<T>( entries, numBytes, filename );
 
-    A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    A.Resize( header.height, header.width );
+    io::ReadLocal( A, file, header.dataOffset );
 }
 
 } // namespace read
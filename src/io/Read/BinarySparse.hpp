@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_BINARYSPARSE_HPP
+#define EL_READ_BINARYSPARSE_HPP
+
+namespace El {
+namespace read {
+
+namespace binary_sparse {
+
+// The number of entries transferred at once
+const Int batchSize = 1<<20;
+
+} // namespace binary_sparse
+
+template<typename T>
+inline void
+BinarySparse( SparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int numBytes = FileSize( file );
+    const Int maxHeaderBytes = io::binaryHeaderLength*sizeof(Int);
+    Int entries[io::binaryHeaderLength] = { 0 };
+    file.read( (char*)entries, Min(numBytes,maxHeaderBytes) );
+    const auto header =
+      io::ParseBinarySparseHeader<T>( entries, numBytes, filename );
+
+    A.Resize( header.height, header.width );
+    A.Reserve( header.numEntries );
+    vector<Int> sources, targets;
+    vector<T> values;
+    for( Int kBeg=0; kBeg<header.numEntries;
+         kBeg+=binary_sparse::batchSize )
+    {
+        const Int numBatch =
+          Min(binary_sparse::batchSize,header.numEntries-kBeg);
+        sources.resize( numBatch );
+        targets.resize( numBatch );
+        values.resize( numBatch );
+        file.seekg( header.SourceOffset()+kBeg*sizeof(Int) );
+        file.read( (char*)sources.data(), numBatch*sizeof(Int) );
+        file.seekg( header.TargetOffset()+kBeg*sizeof(Int) );
+        file.read( (char*)targets.data(), numBatch*sizeof(Int) );
+        file.seekg( header.ValueOffset()+kBeg*sizeof(T) );
+        file.read( (char*)values.data(), numBatch*sizeof(T) );
+        if( !file )
+            RuntimeError("Could not read entries of ",filename);
+        for( Int k=0; k<numBatch; ++k )
+            A.QueueUpdate( sources[k], targets[k], values[k] );
+    }
+    A.ProcessQueues();
+}
+
+// Since the entries are stored in order of their rows, each process can
+// binary search for (and independently read) precisely its local entries
+template<typename T>
+inline void
+BinarySparse( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    io::CollectiveFile file( A.Comm(), filename, false );
+
+    const Int numBytes = file.Size();
+    const Int maxHeaderBytes = io::binaryHeaderLength*sizeof(Int);
+    Int entries[io::binaryHeaderLength] = { 0 };
+    const int headerBytes = Min(numBytes,maxHeaderBytes);
+    io::SafeMpiIO
+    ( MPI_File_read_at_all
+      ( file.handle, 0, entries, headerBytes, MPI_BYTE, MPI_STATUS_IGNORE ),
+      filename );
+    const auto header =
+      io::ParseBinarySparseHeader<T>( entries, numBytes, filename );
+    A.Resize( header.height, header.width );
+
+    // Find the first entry whose row is at least i
+    auto rowBound = [&]( Int i )
+      {
+          Int lower=0, upper=header.numEntries;
+          while( lower < upper )
+          {
+              const Int mid = lower + (upper-lower)/2;
+              Int source;
+              io::ReadBytes
+              ( file, header.SourceOffset()+mid*sizeof(Int), &source,
+                sizeof(Int) );
+              if( source < i )
+                  lower = mid+1;
+              else
+                  upper = mid;
+          }
+          return lower;
+      };
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const Int kLocalBeg = rowBound( firstLocalRow );
+    const Int kLocalEnd = rowBound( firstLocalRow+localHeight );
+
+    A.Reserve( kLocalEnd-kLocalBeg );
+    vector<Int> sources, targets;
+    vector<T> values;
+    for( Int kBeg=kLocalBeg; kBeg<kLocalEnd; kBeg+=binary_sparse::batchSize )
+    {
+        const Int numBatch = Min(binary_sparse::batchSize,kLocalEnd-kBeg);
+        sources.resize( numBatch );
+        targets.resize( numBatch );
+        values.resize( numBatch );
+        io::ReadBytes
+        ( file, header.SourceOffset()+kBeg*sizeof(Int), sources.data(),
+          numBatch*sizeof(Int) );
+        io::ReadBytes
+        ( file, header.TargetOffset()+kBeg*sizeof(Int), targets.data(),
+          numBatch*sizeof(Int) );
+        io::ReadBytes
+        ( file, header.ValueOffset()+kBeg*sizeof(T), values.data(),
+          numBatch*sizeof(T) );
+        for( Int k=0; k<numBatch; ++k )
+        {
+            const Int iLoc = sources[k] - firstLocalRow;
+            if( iLoc < 0 || iLoc >= localHeight )
+                RuntimeError
+                ("The entries of ",filename," are not sorted by row");
+            A.QueueLocalUpdate( iLoc, targets[k], values[k] );
+        }
+    }
+    A.ProcessLocalQueues();
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYSPARSE_HPP
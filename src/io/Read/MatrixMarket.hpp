@@ -2,8 +2,8 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #ifndef EL_READ_MATRIXMARKET_HPP
@@ -12,15 +12,34 @@
 namespace El {
 namespace read {
 
-template<typename T>
-inline void
-MatrixMarket( Matrix<T>& A, const string filename )
+namespace mm {
+
+// The file is read in pieces of (at least) this many bytes
+const Int chunkSize = 1<<26;
+// Avoid spawning threads to parse small pieces of the file
+const Int minBytesPerThread = 1<<16;
+
+struct Info
+{
+    bool isMatrix;
+    bool isArray;
+    bool isComplex;
+    bool isPattern;
+    bool isSymmetric;
+    bool isSkewSymmetric;
+    bool isHermitian;
+
+    Int height;
+    Int width;
+    Int numNonzero; // only meaningful for the coordinate format
+};
+
+// Read the header, comments, and size line of a Matrix Market file, leaving
+// the stream at the beginning of the first entry
+inline Info ReadHeader( std::istream& file )
 {
     DEBUG_CSE
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    Info info;
 
     // Read the header
     // ===============
@@ -31,10 +50,10 @@ MatrixMarket( Matrix<T>& A, const string filename )
         RuntimeError("Could not extract header line");
     {
         std::stringstream lineStream( line );
-        lineStream >> stamp; 
+        lineStream >> stamp;
         if( stamp != string("%%MatrixMarket") )
             RuntimeError("Invalid Matrix Market stamp: ",stamp);
-        if( !(lineStream >> object) ) 
+        if( !(lineStream >> object) )
             RuntimeError("Missing Matrix Market object");
         if( !(lineStream >> format) )
             RuntimeError("Missing Matrix Market format");
@@ -45,70 +64,394 @@ MatrixMarket( Matrix<T>& A, const string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == string("matrix") );
-    const bool isArray = ( format == string("array") );
-    const bool isComplex = ( field == string("complex") );
-    const bool isPattern = ( field == string("pattern") );
+    info.isMatrix = ( object == string("matrix") );
+    info.isArray = ( format == string("array") );
+    info.isComplex = ( field == string("complex") );
+    info.isPattern = ( field == string("pattern") );
+    info.isSymmetric = ( symmetry == string("symmetric") );
+    info.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    info.isHermitian = ( symmetry == string("hermitian") );
     const bool isGeneral = ( symmetry == string("general") );
-    const bool isSymmetric = ( symmetry == string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == string("hermitian") );
-    if( !isMatrix && object != string("vector") )
+    if( !info.isMatrix && object != string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != string("coordinate") )
+    if( !info.isArray && format != string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern && 
-        field != string("real") && 
+    if( !info.isComplex && !info.isPattern &&
+        field != string("real") &&
         field != string("double") &&
         field != string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !isGeneral && !info.isSymmetric && !info.isSkewSymmetric &&
+        !info.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( info.isArray && info.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( info.isSkewSymmetric && info.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( info.isHermitian && !info.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
     // ======================
-    while( file.peek() == '%' ) 
+    while( file.peek() == '%' )
         std::getline( file, line );
-  
-    int m, n;
+
+    // Read in the dimensions (and the number of nonzeros)
+    // ===================================================
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
-    if( isArray )
+    std::stringstream lineStream( line );
+    if( info.isMatrix )
+    {
+        if( !(lineStream >> info.height) )
+            RuntimeError("Missing matrix height: ",line);
+        if( !(lineStream >> info.width) )
+            RuntimeError("Missing matrix width: ",line);
+    }
+    else
+    {
+        if( !(lineStream >> info.height) )
+            RuntimeError("Missing vector height: ",line);
+        info.width = 1;
+    }
+    if( info.isArray )
+        info.numNonzero = info.height*info.width;
+    else if( !(lineStream >> info.numNonzero) )
+        RuntimeError("Missing nonzeros entry: ",line);
+
+    return info;
+}
+
+// Fast parsing of null-terminated lines
+// =====================================
+inline void SkipBlanks( const char*& p )
+{ while( *p == ' ' || *p == '\t' || *p == '\r' ) ++p; }
+
+inline bool ParseIndex( const char*& p, Int& index )
+{
+    SkipBlanks( p );
+    if( *p < '0' || *p > '9' )
+        return false;
+    Int value = 0;
+    do
+    {
+        value = 10*value + (*p-'0');
+        ++p;
+    } while( *p >= '0' && *p <= '9' );
+    index = value;
+    return true;
+}
+
+inline bool EndOfToken( char c )
+{ return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\0'; }
+
+// Fall back to stream extraction for the extended-precision types
+template<typename Real>
+inline bool ParseReal( const char*& p, Real& value )
+{
+    SkipBlanks( p );
+    const char* tokenEnd = p;
+    while( !EndOfToken(*tokenEnd) )
+        ++tokenEnd;
+    if( tokenEnd == p )
+        return false;
+    std::stringstream tokenStream( string(p,tokenEnd) );
+    if( !(tokenStream >> value) )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+template<>
+inline bool ParseReal( const char*& p, float& value )
+{
+    SkipBlanks( p );
+    if( *p == '\n' || *p == '\0' )
+        return false;
+    char* tokenEnd;
+    value = std::strtof( p, &tokenEnd );
+    if( tokenEnd == p )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+template<>
+inline bool ParseReal( const char*& p, double& value )
+{
+    SkipBlanks( p );
+    if( *p == '\n' || *p == '\0' )
+        return false;
+    char* tokenEnd;
+    value = std::strtod( p, &tokenEnd );
+    if( tokenEnd == p )
+        return false;
+    p = tokenEnd;
+    return true;
+}
+
+// Parse the coordinate-format lines within [beg,end), which must end with a
+// newline and be followed by a null character, appending the (zero-based)
+// entries. If 'expand' is true, then the implicit entries of a (skew-)
+// symmetric or Hermitian matrix are appended as well. Blank lines and
+// comments are skipped. Since this routine is run within OpenMP parallel
+// regions, it does not throw: the beginning of the first line which could
+// not be parsed is returned instead (or nullptr upon success).
+template<typename T>
+const char* ParseCoordinates
+( const char* beg,
+  const char* end,
+  const Info& info,
+        bool expand,
+        vector<Entry<T>>& entries )
+{
+    typedef Base<T> Real;
+    const bool mirror = expand &&
+      (info.isSymmetric || info.isSkewSymmetric || info.isHermitian);
+    const char* p = beg;
+    while( p < end )
     {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
+        const char* line = p;
+        SkipBlanks( p );
+        if( *p == '%' || *p == '\n' )
+        {
+            while( *p != '\n' )
+                ++p;
+            ++p;
+            continue;
+        }
+
+        Int i, j=1;
+        if( !ParseIndex( p, i ) )
+            return line;
+        if( info.isMatrix && !ParseIndex( p, j ) )
+            return line;
+        if( i < 1 || i > info.height || j < 1 || j > info.width )
+            return line;
+        --i; --j; // convert from Fortran to C indexing
+
+        T value(1);
+        if( !info.isPattern )
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
+            Real realPart, imagPart;
+            if( !ParseReal( p, realPart ) )
+                return line;
+            SetRealPart( value, realPart );
+            if( info.isComplex )
+            {
+                if( !ParseReal( p, imagPart ) || !IsComplex<T>::value )
+                    return line;
+                SetImagPart( value, imagPart );
+            }
+        }
+        SkipBlanks( p );
+        if( *p != '\n' )
+            return line;
+        ++p;
+
+        entries.push_back( Entry<T>{ i, j, value } );
+        if( mirror && i != j )
+        {
+            if( info.isHermitian )
+                entries.push_back( Entry<T>{ j, i, Conj(value) } );
+            else if( info.isSkewSymmetric )
+                entries.push_back( Entry<T>{ j, i, -value } );
+            else
+                entries.push_back( Entry<T>{ j, i, value } );
+        }
+    }
+    return nullptr;
+}
+
+// Split [beg,end) at line boundaries between OpenMP threads and concatenate
+// the entries they parse (in order)
+template<typename T>
+void ParseChunk
+( const char* beg,
+  const char* end,
+  const Info& info,
+        bool expand,
+        vector<Entry<T>>& entries )
+{
+    DEBUG_CSE
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    // MPFR's default precision is thread-local, so MPFR-based entries are
+    // parsed by a single thread
+    if( !omp_in_parallel() && El::IsThreadSafe<T>::value )
+        numThreads =
+          Max(Min(Int(omp_get_max_threads()),
+                  Int(end-beg)/minBytesPerThread),Int(1));
+#endif
+    if( numThreads == 1 )
+    {
+        entries.resize( 0 );
+        const char* badLine =
+          ParseCoordinates( beg, end, info, expand, entries );
+        if( badLine != nullptr )
+            RuntimeError
+            ("Could not parse Matrix Market entry: ",
+             string(badLine,std::find(badLine,end,'\n')));
+        return;
+    }
+
+    vector<const char*> splits( numThreads+1 );
+    splits[0] = beg;
+    splits[numThreads] = end;
+    for( Int t=1; t<numThreads; ++t )
+    {
+        const char* p = std::max( beg+t*(end-beg)/numThreads, splits[t-1] );
+        while( p < end && p[-1] != '\n' )
+            ++p;
+        splits[t] = p;
+    }
+
+    vector<vector<Entry<T>>> threadEntries( numThreads );
+    vector<const char*> badLines( numThreads, nullptr );
+#ifdef EL_HYBRID
+    #pragma omp parallel for schedule(static,1) num_threads(numThreads)
+#endif
+    for( Int t=0; t<numThreads; ++t )
+    {
+        // Reserve for lines of (very roughly) sixteen bytes
+        threadEntries[t].reserve( (splits[t+1]-splits[t])/16 );
+        badLines[t] =
+          ParseCoordinates
+          ( splits[t], splits[t+1], info, expand, threadEntries[t] );
+    }
+    for( Int t=0; t<numThreads; ++t )
+        if( badLines[t] != nullptr )
+            RuntimeError
+            ("Could not parse Matrix Market entry: ",
+             string(badLines[t],std::find(badLines[t],end,'\n')));
+
+    Int numEntries = 0;
+    for( Int t=0; t<numThreads; ++t )
+        numEntries += threadEntries[t].size();
+    entries.resize( numEntries );
+    Int offset = 0;
+    for( Int t=0; t<numThreads; ++t )
+    {
+        std::copy
+        ( threadEntries[t].begin(), threadEntries[t].end(),
+          entries.begin()+offset );
+        offset += threadEntries[t].size();
+    }
+}
+
+// Parse the coordinate-format entries on every line which begins within
+// the byte range [rangeBeg,rangeEnd) of the file, whose entries begin at
+// byte dataOffset, and pass each (parsed) chunk of entries to 'process'.
+// Since each line is owned by the range containing its first byte, disjoint
+// ranges which cover the data yield each entry exactly once.
+template<typename T,class ProcessType>
+void StreamCoordinates
+( std::ifstream& file,
+  const Info& info,
+        Int dataOffset,
+        Int rangeBeg,
+        Int rangeEnd,
+        bool expand,
+        ProcessType process )
+{
+    DEBUG_CSE
+    const Int fileEnd = FileSize( file );
+    rangeEnd = Min( rangeEnd, fileEnd );
+
+    // Move to the beginning of the first line which begins in the range
+    Int pos = rangeBeg;
+    if( rangeBeg > dataOffset && rangeBeg < rangeEnd )
+    {
+        file.seekg( rangeBeg-1 );
+        pos = rangeBeg-1;
+        char c;
+        while( file.get(c) )
+        {
+            ++pos;
+            if( c == '\n' )
+                break;
+        }
+        if( !file )
+            pos = fileEnd;
+        file.clear();
+    }
+
+    vector<char> buffer;
+    vector<Entry<T>> entries;
+    Int readSize = chunkSize;
+    while( pos < rangeEnd )
+    {
+        const Int readEnd = Min( pos+readSize, fileEnd );
+        const Int numBytes = readEnd - pos;
+        buffer.resize( numBytes+2 );
+        file.seekg( pos );
+        if( !file.read( buffer.data(), numBytes ) )
+            RuntimeError("Could not read bytes ",pos," through ",readEnd);
+
+        // Only parse complete lines
+        Int numParse;
+        if( readEnd == fileEnd )
+        {
+            numParse = numBytes;
+            if( numParse == 0 || buffer[numParse-1] != '\n' )
+                buffer[numParse++] = '\n';
         }
         else
         {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
+            numParse = numBytes;
+            while( numParse > 0 && buffer[numParse-1] != '\n' )
+                --numParse;
+            if( numParse == 0 )
+            {
+                // A single line spans the chunk
+                readSize *= 2;
+                continue;
+            }
         }
+        // Stop after the line containing the last byte of the range
+        const Int numOwned = rangeEnd - pos;
+        if( numParse > numOwned )
+        {
+            Int lineEnd = numOwned-1;
+            while( buffer[lineEnd] != '\n' )
+                ++lineEnd;
+            numParse = lineEnd+1;
+        }
+        buffer[numParse] = '\0';
 
-        // Resize the matrix
-        // =================
-        Zeros( A, m, n );
+        ParseChunk
+        ( buffer.data(), buffer.data()+numParse, info, expand, entries );
+        process( entries );
+        pos += numParse;
+        readSize = chunkSize;
+    }
+}
+
+} // namespace mm
 
+template<typename T>
+inline void
+MatrixMarket( Matrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const mm::Info info = mm::ReadHeader( file );
+    const Int m = info.height;
+    const Int n = info.width;
+    Zeros( A, m, n );
+    if( info.isArray )
+    {
         // Now read in the data
         // ====================
+        string line;
         Real realPart, imagPart;
         for( Int j=0; j<n; ++j )
         {
@@ -121,7 +464,7 @@ MatrixMarket( Matrix<T>& A, const string filename )
                     RuntimeError
                     ("Could not extract real part of entry (",i,",",j,")");
                 A.SetRealPart( i, j, realPart );
-                if( isComplex )
+                if( info.isComplex )
                 {
                     if( !(lineStream >> imagPart) )
                         RuntimeError
@@ -133,84 +476,36 @@ MatrixMarket( Matrix<T>& A, const string filename )
     }
     else
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-
-        // Create a matrix of zeros
-        // ========================
-        Zeros( A, m, n );
-
         // Fill in the nonzero entries
         // ===========================
-        int i, j;
-        Real realPart, imagPart;
-        for( Int k=0; k<numNonzero; ++k )
-        {
-            if( !std::getline( file, line ) )
-                RuntimeError("Could not get nonzero ",k);
-            std::stringstream lineStream( line );
-            if( !(lineStream >> i) )
-                RuntimeError("Could not extract row coordinate of nonzero ",k);
-            --i; // convert from Fortran to C indexing
-            if( isMatrix )
-            {
-                if( !(lineStream >> j) )
-                    RuntimeError
-                    ("Could not extract col coordinate of nonzero ",k);
-                --j;
-            }
-            else
-                j = 0;
-
-            if( isPattern )
-            {
-                A.Set( i, j, T(1) );
-            }
-            else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.UpdateRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.UpdateImagPart( i, j, imagPart );
-                }
-            }
-        }
+        const Int dataOffset = file.tellg();
+        Int numParsed = 0;
+        mm::StreamCoordinates<T>
+        ( file, info, dataOffset, dataOffset, FileSize(file), false,
+          [&]( const vector<Entry<T>>& entries )
+          {
+              for( const auto& entry : entries )
+              {
+                  if( info.isPattern )
+                      A.Set( entry );
+                  else
+                      A.Update( entry );
+              }
+              numParsed += entries.size();
+          } );
+        if( numParsed != info.numNonzero )
+            RuntimeError
+            ("Expected ",info.numNonzero," nonzeros but found ",numParsed);
     }
 
-    if( isSymmetric )
+    if( info.isSymmetric )
         MakeSymmetric( LOWER, A );
-    if( isHermitian )
+    if( info.isHermitian )
         MakeHermitian( LOWER, A );
     // I'm not certain of what the MM standard is for complex skew-symmetry,
     // so I'll default to assuming no conjugation
     const bool conjugateSkew = false;
-    if( isSkewSymmetric )
+    if( info.isSkewSymmetric )
     {
         MakeSymmetric( LOWER, A, conjugateSkew );
         ScaleTrapezoid( T(-1), UPPER, A, 1 );
@@ -234,6 +529,103 @@ MatrixMarket( AbstractDistMatrix<T>& A, const string filename )
     Copy( A_CIRC_CIRC, A );
 }
 
+// The implicit entries of (skew-)symmetric and Hermitian matrices are
+// explicitly stored in the sparse matrix. Only the coordinate format is
+// supported.
+template<typename T>
+inline void
+MatrixMarket( SparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const mm::Info info = mm::ReadHeader( file );
+    if( info.isArray )
+        LogicError
+        ("Sparse matrices require the Matrix Market coordinate format");
+    A.Resize( info.height, info.width );
+    const bool mirror =
+      info.isSymmetric || info.isSkewSymmetric || info.isHermitian;
+    A.Reserve( mirror ? 2*info.numNonzero : info.numNonzero );
+
+    const Int dataOffset = file.tellg();
+    Int numParsed = 0;
+    mm::StreamCoordinates<T>
+    ( file, info, dataOffset, dataOffset, FileSize(file), true,
+      [&]( const vector<Entry<T>>& entries )
+      {
+          for( const auto& entry : entries )
+          {
+              if( entry.i >= entry.j || !mirror )
+                  ++numParsed;
+              A.QueueUpdate( entry );
+          }
+      } );
+    if( numParsed != info.numNonzero )
+        RuntimeError
+        ("Expected ",info.numNonzero," nonzeros but found ",numParsed);
+    A.ProcessQueues();
+}
+
+// Each process parses the lines which begin within its (contiguous) portion
+// of the entries of the file and queues them for their owners
+template<typename T>
+inline void
+MatrixMarket( DistSparseMatrix<T>& A, const string filename )
+{
+    DEBUG_CSE
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const mm::Info info = mm::ReadHeader( file );
+    if( info.isArray )
+        LogicError
+        ("Sparse matrices require the Matrix Market coordinate format");
+    A.Resize( info.height, info.width );
+    const bool mirror =
+      info.isSymmetric || info.isSkewSymmetric || info.isHermitian;
+
+    mpi::Comm comm = A.Comm();
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    const Int dataOffset = file.tellg();
+    const Int numDataBytes = Int(FileSize(file)) - dataOffset;
+    const Int rangeBeg = dataOffset + (commRank*numDataBytes)/commSize;
+    const Int rangeEnd = dataOffset + ((commRank+1)*numDataBytes)/commSize;
+
+    const Int localHeight = A.LocalHeight();
+
+    // Reserve once (with some headroom) for this process's share of the
+    // entries, split between the local and remote queues in proportion to
+    // the local rows, since each reservation reallocates the queues
+    const Int numExpanded = ( mirror ? 2 : 1 )*info.numNonzero;
+    const Int numExpected = numExpanded/commSize + numExpanded/(8*commSize);
+    const Int numLocalExpected =
+      Int((double(numExpected)*localHeight)/Max(info.height,Int(1)));
+    A.Reserve( numLocalExpected, numExpected-numLocalExpected );
+
+    Int numParsed = 0;
+    mm::StreamCoordinates<T>
+    ( file, info, dataOffset, rangeBeg, rangeEnd, true,
+      [&]( const vector<Entry<T>>& entries )
+      {
+          for( const auto& entry : entries )
+          {
+              if( entry.i >= entry.j || !mirror )
+                  ++numParsed;
+              A.QueueUpdate( entry );
+          }
+      } );
+    numParsed = mpi::AllReduce( numParsed, comm );
+    if( numParsed != info.numNonzero )
+        RuntimeError
+        ("Expected ",info.numNonzero," nonzeros but found ",numParsed);
+    A.ProcessQueues();
+}
+
 } // namespace read
 } // namespace El
 
@@ -8,10 +8,14 @@
 */
 #include <El.hpp>
 
+#include "./FileView.hpp"
+#include "./BinaryHeader.hpp"
+
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
 #include "./Write/BinaryFlat.hpp"
+#include "./Write/BinarySparse.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
 
@@ -54,6 +58,10 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( format == BINARY )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT )
+        write::BinaryFlat( A, basename );
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -62,13 +70,42 @@ void Write
     }
 }
 
+template<typename T>
+void Write( const SparseMatrix<T>& A, string basename, FileFormat format )
+{
+    DEBUG_CSE
+    switch( format )
+    {
+    case BINARY_SPARSE: write::BinarySparse( A, basename ); break;
+    default:
+        LogicError("Invalid file format for sparse matrices");
+    }
+}
+
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, string basename, FileFormat format )
+{
+    DEBUG_CSE
+    switch( format )
+    {
+    case BINARY_SPARSE: write::BinarySparse( A, basename ); break;
+    default:
+        LogicError("Invalid file format for sparse matrices");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
     string basename, FileFormat format, string title ); \
   template void Write \
   ( const AbstractDistMatrix<T>& A, \
-    string basename, FileFormat format, string title );
+    string basename, FileFormat format, string title ); \
+  template void Write \
+  ( const SparseMatrix<T>& A, string basename, FileFormat format ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, string basename, FileFormat format );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -23,11 +23,8 @@ Binary( const Matrix<T>& A, string basename="matrix" )
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    Int n;
-    n = A.Height();
-    file.write( (char*)&n, sizeof(Int) );
-    n = A.Width();
-    file.write( (char*)&n, sizeof(Int) );
+    const auto header = io::FormBinaryHeader<T>( A.Height(), A.Width() );
+    file.write( header.data(), header.size() );
     if( A.Height() == A.LDim() )
         file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
     else
@@ -35,6 +32,32 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Each process collectively writes its local entries through an MPI-IO file
+// view rather than funneling the matrix through a single process
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    io::CollectiveFile file( A.Grid().ViewingComm(), filename, true );
+
+    const Int metaBytes = io::binaryDataOffset;
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    io::SafeMpiIO
+    ( MPI_File_set_size( file.handle, metaBytes+dataBytes ), filename );
+    if( mpi::Rank(file.comm) == 0 )
+    {
+        auto header = io::FormBinaryHeader<T>( A.Height(), A.Width() );
+        io::SafeMpiIO
+        ( MPI_File_write_at
+          ( file.handle, 0, header.data(), metaBytes, MPI_BYTE,
+            MPI_STATUS_IGNORE ),
+          filename );
+    }
+    io::WriteLocal( A, file, metaBytes );
+}
+
 } // namespace write
 } // namespace El
 
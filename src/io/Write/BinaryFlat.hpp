@@ -30,6 +30,21 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Each process collectively writes its local entries through an MPI-IO file
+// view rather than funneling the matrix through a single process
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    io::CollectiveFile file( A.Grid().ViewingComm(), filename, true );
+
+    const Int dataBytes = A.Height()*A.Width()*sizeof(T);
+    io::SafeMpiIO( MPI_File_set_size( file.handle, dataBytes ), filename );
+    io::WriteLocal( A, file, 0 );
+}
+
 } // namespace write
 } // namespace El
 
@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_BINARYSPARSE_HPP
+#define EL_WRITE_BINARYSPARSE_HPP
+
+namespace El {
+namespace write {
+
+template<typename T>
+inline void
+BinarySparse( const SparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    if( !A.Consistent() )
+        LogicError("Sparse matrix must be consistent before writing");
+    string filename = basename + "." + FileExtension(BINARY_SPARSE);
+    ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int numEntries = A.NumEntries();
+    const auto header =
+      io::FormBinarySparseHeader<T>( A.Height(), A.Width(), numEntries );
+    file.write( (char*)header.data(), header.size()*sizeof(Int) );
+    file.write( (char*)A.LockedSourceBuffer(), numEntries*sizeof(Int) );
+    file.write( (char*)A.LockedTargetBuffer(), numEntries*sizeof(Int) );
+    file.write( (char*)A.LockedValueBuffer(), numEntries*sizeof(T) );
+}
+
+// Since each process owns a contiguous set of rows, the local entries can be
+// written in order at offsets determined by a prefix sum
+template<typename T>
+inline void
+BinarySparse( const DistSparseMatrix<T>& A, string basename="matrix" )
+{
+    DEBUG_CSE
+    if( !A.LocallyConsistent() )
+        LogicError("Sparse matrix must be consistent before writing");
+    string filename = basename + "." + FileExtension(BINARY_SPARSE);
+    mpi::Comm comm = A.Comm();
+    io::CollectiveFile file( comm, filename, true );
+
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int numEntries = mpi::AllReduce( numLocalEntries, comm );
+    const Int kLocalBeg = mpi::Scan( numLocalEntries, comm ) - numLocalEntries;
+    io::BinarySparseHeader header;
+    header.height = A.Height();
+    header.width = A.Width();
+    header.numEntries = numEntries;
+    io::SafeMpiIO
+    ( MPI_File_set_size
+      ( file.handle, header.ValueOffset()+numEntries*sizeof(T) ), filename );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const auto headerEntries =
+          io::FormBinarySparseHeader<T>( A.Height(), A.Width(), numEntries );
+        io::WriteBytes
+        ( file, 0, headerEntries.data(), headerEntries.size()*sizeof(Int) );
+    }
+    io::WriteBytes
+    ( file, header.SourceOffset()+kLocalBeg*sizeof(Int),
+      A.LockedSourceBuffer(), numLocalEntries*sizeof(Int) );
+    io::WriteBytes
+    ( file, header.TargetOffset()+kLocalBeg*sizeof(Int),
+      A.LockedTargetBuffer(), numLocalEntries*sizeof(Int) );
+    io::WriteBytes
+    ( file, header.ValueOffset()+kLocalBeg*sizeof(T),
+      A.LockedValueBuffer(), numLocalEntries*sizeof(T) );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYSPARSE_HPP
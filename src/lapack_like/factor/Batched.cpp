@@ -0,0 +1,311 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// As with the batched BLAS-like kernels, each of the following unblocked
+// factorizations operates on a block of 'numLanes' matrices whose entry (i,j)
+// is stored at A[i*RI+j*CI+lane]. Since exceptions cannot escape the threaded
+// loops over the blocks, failures are recorded per matrix and reported after.
+
+namespace El {
+
+namespace batched {
+
+template<typename F>
+void LUKernel
+( Int m, Int n, F* A, Int RI, Int CI, Int numLanes, Int* failed )
+{
+    const Int minDim = Min(m,n);
+    for( Int k=0; k<minDim; ++k )
+    {
+        const F* alpha11 = &A[k*RI+k*CI];
+        for( Int l=0; l<numLanes; ++l )
+            if( alpha11[l] == F(0) )
+                failed[l] = true;
+
+        // a21 := a21 / alpha11
+        for( Int i=k+1; i<m; ++i )
+        {
+            F* alpha21 = &A[i*RI+k*CI];
+            for( Int l=0; l<numLanes; ++l )
+                alpha21[l] /= alpha11[l];
+        }
+
+        // A22 := A22 - a21 a12
+        for( Int j=k+1; j<n; ++j )
+        {
+            const F* alpha12 = &A[k*RI+j*CI];
+            for( Int i=k+1; i<m; ++i )
+            {
+                const F* alpha21 = &A[i*RI+k*CI];
+                F* alpha22 = &A[i*RI+j*CI];
+                for( Int l=0; l<numLanes; ++l )
+                    alpha22[l] -= alpha21[l]*alpha12[l];
+            }
+        }
+    }
+}
+
+// Since the pivots differ between the matrices, the pivot searches and row
+// swaps proceed one matrix at a time
+template<typename F>
+void PivotedLUKernel
+( Int m, Int n, F* A, Int RI, Int CI, Int numLanes,
+  Int* pivots, Int pivotStride, Int* failed )
+{
+    typedef Base<F> Real;
+    const Int minDim = Min(m,n);
+    for( Int k=0; k<minDim; ++k )
+    {
+        for( Int l=0; l<numLanes; ++l )
+        {
+            Int iPiv = k;
+            Real maxAbs = Abs(A[k*RI+k*CI+l]);
+            for( Int i=k+1; i<m; ++i )
+            {
+                const Real absVal = Abs(A[i*RI+k*CI+l]);
+                if( absVal > maxAbs )
+                {
+                    iPiv = i;
+                    maxAbs = absVal;
+                }
+            }
+            pivots[k+l*pivotStride] = iPiv;
+            if( maxAbs == Real(0) )
+                failed[l] = true;
+            if( iPiv != k )
+                for( Int j=0; j<n; ++j )
+                    std::swap( A[k*RI+j*CI+l], A[iPiv*RI+j*CI+l] );
+        }
+        const F* alpha11 = &A[k*RI+k*CI];
+        for( Int i=k+1; i<m; ++i )
+        {
+            F* alpha21 = &A[i*RI+k*CI];
+            for( Int l=0; l<numLanes; ++l )
+                alpha21[l] /= alpha11[l];
+        }
+        for( Int j=k+1; j<n; ++j )
+        {
+            const F* alpha12 = &A[k*RI+j*CI];
+            for( Int i=k+1; i<m; ++i )
+            {
+                const F* alpha21 = &A[i*RI+k*CI];
+                F* alpha22 = &A[i*RI+j*CI];
+                for( Int l=0; l<numLanes; ++l )
+                    alpha22[l] -= alpha21[l]*alpha12[l];
+            }
+        }
+    }
+}
+
+// Overwrite the lower triangle of A with its Cholesky factor
+template<typename F>
+void CholeskyKernel( Int n, F* A, Int RI, Int CI, Int numLanes, Int* failed )
+{
+    typedef Base<F> Real;
+    for( Int k=0; k<n; ++k )
+    {
+        F* alpha11 = &A[k*RI+k*CI];
+        for( Int l=0; l<numLanes; ++l )
+        {
+            const Real delta = RealPart(alpha11[l]);
+            if( delta <= Real(0) )
+                failed[l] = true;
+            else
+                alpha11[l] = Sqrt(delta);
+        }
+
+        for( Int i=k+1; i<n; ++i )
+        {
+            F* alpha21 = &A[i*RI+k*CI];
+            for( Int l=0; l<numLanes; ++l )
+                alpha21[l] /= alpha11[l];
+        }
+
+        // A22 := A22 - a21 a21^H (lower triangle only)
+        for( Int j=k+1; j<n; ++j )
+        {
+            const F* alpha21j = &A[j*RI+k*CI];
+            for( Int i=j; i<n; ++i )
+            {
+                const F* alpha21i = &A[i*RI+k*CI];
+                F* alpha22 = &A[i*RI+j*CI];
+                for( Int l=0; l<numLanes; ++l )
+                    alpha22[l] -= alpha21i[l]*Conj(alpha21j[l]);
+            }
+        }
+    }
+}
+
+// Overwrite the strictly lower triangle of A with the unit lower-triangular
+// factor, L, and leave D on the diagonal. As with ldl::Var3Unb, zero pivots
+// are not detected.
+template<typename F>
+void LDLKernel( Int n, F* A, Int RI, Int CI, Int numLanes, bool conjugate )
+{
+    typedef Base<F> Real;
+    F deltaInv[batchLaneBlock];
+    for( Int k=0; k<n; ++k )
+    {
+        const F* alpha11 = &A[k*RI+k*CI];
+        for( Int l=0; l<numLanes; ++l )
+            deltaInv[l] =
+              ( conjugate ? F(Real(1)/RealPart(alpha11[l]))
+                          : F(1)/alpha11[l] );
+
+        // A22 := A22 - a21 inv(delta) a21^{T/H} (lower triangle only)
+        for( Int j=k+1; j<n; ++j )
+        {
+            const F* alpha21j = &A[j*RI+k*CI];
+            for( Int i=j; i<n; ++i )
+            {
+                const F* alpha21i = &A[i*RI+k*CI];
+                F* alpha22 = &A[i*RI+j*CI];
+                if( conjugate )
+                    for( Int l=0; l<numLanes; ++l )
+                        alpha22[l] -=
+                          alpha21i[l]*deltaInv[l]*Conj(alpha21j[l]);
+                else
+                    for( Int l=0; l<numLanes; ++l )
+                        alpha22[l] -= alpha21i[l]*deltaInv[l]*alpha21j[l];
+            }
+        }
+
+        // a21 := a21 inv(delta)
+        for( Int i=k+1; i<n; ++i )
+        {
+            F* alpha21 = &A[i*RI+k*CI];
+            for( Int l=0; l<numLanes; ++l )
+                alpha21[l] *= deltaInv[l];
+        }
+    }
+}
+
+} // namespace batched
+
+template<typename F>
+void LU( MatrixBatch<F>& A )
+{
+    DEBUG_CSE
+    const Int batchSize = A.BatchSize();
+    const Int laneBlock = A.LaneBlock();
+    const Int numBlocks = (batchSize+laneBlock-1) / laneBlock;
+    vector<Int> failed( batchSize, false );
+    // MPFR and GMP temporaries must be formed by the calling thread, whose
+    // default precision may differ from that of the workers
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(IsThreadSafe<F>::value)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int b = block*laneBlock;
+        batched::LUKernel
+        ( A.Height(), A.Width(), A.Buffer(b), A.RowInc(), A.ColInc(),
+          Min(laneBlock,batchSize-b), &failed[b] );
+    }
+    for( Int b=0; b<batchSize; ++b )
+        if( failed[b] )
+            throw SingularMatrixException();
+}
+
+template<typename F>
+void LU( MatrixBatch<F>& A, Matrix<Int>& pivots )
+{
+    DEBUG_CSE
+    const Int batchSize = A.BatchSize();
+    const Int laneBlock = A.LaneBlock();
+    const Int numBlocks = (batchSize+laneBlock-1) / laneBlock;
+    const Int minDim = Min(A.Height(),A.Width());
+    pivots.Resize( minDim, batchSize );
+    Int* pivotBuf = pivots.Buffer();
+    const Int pivotLDim = pivots.LDim();
+    vector<Int> failed( batchSize, false );
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(IsThreadSafe<F>::value)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int b = block*laneBlock;
+        batched::PivotedLUKernel
+        ( A.Height(), A.Width(), A.Buffer(b), A.RowInc(), A.ColInc(),
+          Min(laneBlock,batchSize-b), &pivotBuf[b*pivotLDim], pivotLDim,
+          &failed[b] );
+    }
+    for( Int b=0; b<batchSize; ++b )
+        if( failed[b] )
+            throw SingularMatrixException();
+}
+
+template<typename F>
+void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factors of square matrices");
+
+    // Since the upper triangle of A is the lower triangle of its transpose,
+    // which is the conjugate of A (with Cholesky factor conj(U^H)), the upper
+    // factorization is the lower factorization with the increments swapped
+    const Int RI = ( uplo == LOWER ? A.RowInc() : A.ColInc() );
+    const Int CI = ( uplo == LOWER ? A.ColInc() : A.RowInc() );
+
+    const Int batchSize = A.BatchSize();
+    const Int laneBlock = A.LaneBlock();
+    const Int numBlocks = (batchSize+laneBlock-1) / laneBlock;
+    vector<Int> failed( batchSize, false );
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(IsThreadSafe<F>::value)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int b = block*laneBlock;
+        batched::CholeskyKernel
+        ( A.Height(), A.Buffer(b), RI, CI, Min(laneBlock,batchSize-b),
+          &failed[b] );
+    }
+    for( Int b=0; b<batchSize; ++b )
+        if( failed[b] )
+            LogicError("Matrix ",b," of the batch was not numerically HPD");
+}
+
+template<typename F>
+void LDL( MatrixBatch<F>& A, bool conjugate )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute LDL factorizations of square matrices");
+    const Int batchSize = A.BatchSize();
+    const Int laneBlock = A.LaneBlock();
+    const Int numBlocks = (batchSize+laneBlock-1) / laneBlock;
+#ifdef EL_HYBRID
+    #pragma omp parallel for if(IsThreadSafe<F>::value)
+#endif
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int b = block*laneBlock;
+        batched::LDLKernel
+        ( A.Height(), A.Buffer(b), A.RowInc(), A.ColInc(),
+          Min(laneBlock,batchSize-b), conjugate );
+    }
+}
+
+#define PROTO(F) \
+  template void LU( MatrixBatch<F>& A ); \
+  template void LU( MatrixBatch<F>& A, Matrix<Int>& pivots ); \
+  template void Cholesky( UpperOrLower uplo, MatrixBatch<F>& A ); \
+  template void LDL( MatrixBatch<F>& A, bool conjugate );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -25,6 +25,7 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("Cholesky");
     DEBUG_ONLY(
       if( A.Height() != A.Width() )
           LogicError("A must be square");
@@ -99,6 +100,7 @@ template<typename F>
 void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistCholesky");
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
@@ -41,6 +41,7 @@ template<typename F>
 void LDL( Matrix<F>& A, bool conjugate )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LDL");
     ldl::Var3( A, conjugate );
 }
 
@@ -48,6 +49,7 @@ template<typename F>
 void LDL( ElementalMatrix<F>& A, bool conjugate )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistLDL");
     ldl::Var3( A, conjugate );
 }
 
@@ -66,6 +68,7 @@ void LDL
   const LDLPivotCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LDL");
     ldl::Pivoted( A, dSub, p, conjugate, ctrl );
 }
 
@@ -78,6 +81,7 @@ void LDL
   const LDLPivotCtrl<Base<F>>& ctrl ) 
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistLDL");
     ldl::Pivoted( A, dSub, p, conjugate, ctrl );
 }
 
@@ -90,6 +94,7 @@ void LDL
   LDLFrontType newType )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("SparseLDL");
     if( !Unfactored(front.type) )
         LogicError("Matrix is already factored");
 
@@ -110,6 +115,7 @@ void LDL
   LDLFrontType newType )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistSparseLDL");
     if( !Unfactored(front.type) )
         LogicError("Matrix is already factored");
 
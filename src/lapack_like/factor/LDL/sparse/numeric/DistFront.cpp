@@ -69,23 +69,28 @@ void UnpackEntriesLocal
 {
     DEBUG_CSE
 
-    // Delete any existing children
-    for( auto* childFront : front.children )
-        delete childFront;
-
+    // Reuse the existing children (and their buffers) if the tree shape
+    // is unchanged; otherwise, rebuild them
     const Int numChildren = sep.children.size();
-    front.children.resize( numChildren );
+    if( Int(front.children.size()) != numChildren )
+    {
+        for( auto* childFront : front.children )
+            delete childFront;
+        front.children.resize( numChildren );
+        for( Int c=0; c<numChildren; ++c )
+            front.children[c] = new Front<F>(&front);
+    }
     for( Int c=0; c<numChildren; ++c )
     {
-        front.children[c] = new Front<F>(&front);
+        front.children[c]->type = front.type;
+        front.children[c]->isHermitian = front.isHermitian;
         UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c], 
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
     }
     // Mark this node as a sparse leaf if it does not have any children
     // and is not a duplicate of a dense distributed node
-    if( numChildren == 0 && !front.duplicate )
-        front.sparseLeaf = true;
+    front.sparseLeaf = ( numChildren == 0 && !front.duplicate );
 
     const Int size = node.size;
     const Int off = node.off;
@@ -210,8 +215,12 @@ void UnpackEntries
 
     if( sep.child == nullptr )
     {
-        delete front.duplicate;
-        front.duplicate = new Front<F>(&front);
+        delete front.child;
+        front.child = nullptr;
+        if( front.duplicate == nullptr )
+            front.duplicate = new Front<F>(&front);
+        front.duplicate->type = front.type;
+        front.duplicate->isHermitian = front.isHermitian;
         UnpackEntriesLocal
         ( *sep.duplicate, *node.duplicate, *front.duplicate, 
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
@@ -220,8 +229,12 @@ void UnpackEntries
 
         return;
     }
-    delete front.child;
-    front.child = new DistFront<F>(&front);
+    delete front.duplicate;
+    front.duplicate = nullptr;
+    if( front.child == nullptr )
+        front.child = new DistFront<F>(&front);
+    front.child->type = front.type;
+    front.child->isHermitian = front.isHermitian;
     UnpackEntries
     ( *sep.child, *node.child, *front.child, 
       A, rRowLengths, rEntries, rTargets, offs, entryOffs );
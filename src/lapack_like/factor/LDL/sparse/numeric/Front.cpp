@@ -88,20 +88,26 @@ void Front<F>::Pull
     function<void(const NodeInfo&,Front<F>&)> pull = 
       [&]( const NodeInfo& node, Front<F>& front )
       {
-        // Delete any existing children
-        for( auto* child : front.children )
-            delete child;
-
+        // Reuse the existing children (and their buffers) if the tree shape
+        // is unchanged, e.g., when refactoring a matrix with the same
+        // sparsity pattern; otherwise, rebuild them
         const Int numChildren = node.children.size();
-        front.children.resize( numChildren );
+        if( Int(front.children.size()) != numChildren )
+        {
+            for( auto* child : front.children )
+                delete child;
+            front.children.resize( numChildren );
+            for( Int c=0; c<numChildren; ++c )
+                front.children[c] = new Front<F>(&front);
+        }
         for( Int c=0; c<numChildren; ++c )
         {
-            front.children[c] = new Front<F>(&front);
+            front.children[c]->type = front.type;
+            front.children[c]->isHermitian = front.isHermitian;
             pull( *node.children[c], *front.children[c] );
         }
         // Mark this node as a sparse leaf if it does not have any children
-        if( numChildren == 0 )
-            front.sparseLeaf = true;
+        front.sparseLeaf = ( numChildren == 0 );
 
         const Int lowerSize = node.lowerStruct.size();
         const F* AValBuf = A.LockedValueBuffer();
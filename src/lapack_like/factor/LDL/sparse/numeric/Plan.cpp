@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+inline bool PatternMatches
+( Int height, const vector<Int>& offsets, const vector<Int>& targets,
+  Int AHeight, Int numEntries,
+  const Int* AOffsetBuf, const Int* ATargetBuf )
+{
+    if( height != AHeight || Int(targets.size()) != numEntries ||
+        Int(offsets.size()) != AHeight+1 )
+        return false;
+    return std::equal( offsets.begin(), offsets.end(), AOffsetBuf ) &&
+           std::equal( targets.begin(), targets.end(), ATargetBuf );
+}
+
+// Whether an analysis with the given control would reproduce the last one
+inline bool SameBisection( const BisectCtrl& ctrl, const BisectCtrl& ctrlOld )
+{
+    return ctrl.sequential == ctrlOld.sequential &&
+           ctrl.numDistSeps == ctrlOld.numDistSeps &&
+           ctrl.numSeqSeps == ctrlOld.numSeqSeps &&
+           ctrl.cutoff == ctrlOld.cutoff &&
+           ctrl.storeFactRecvInds == ctrlOld.storeFactRecvInds;
+}
+
+} // anonymous namespace
+
+template<typename F>
+FactorizationPlan<F>::FactorizationPlan()
+: height_(-1), numAnalyses_(0)
+{ }
+
+template<typename F>
+bool FactorizationPlan<F>::Matches( const SparseMatrix<F>& A ) const
+{
+    DEBUG_CSE
+    return PatternMatches
+    ( height_, offsets_, targets_, A.Height(), A.NumEntries(),
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer() );
+}
+
+template<typename F>
+bool FactorizationPlan<F>::Analyze
+( const SparseMatrix<F>& A, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( Matches(A) && SameBisection(ctrl,ctrl_) )
+        return false;
+
+    NestedDissection( A.LockedGraph(), map, rootSep, info, ctrl );
+    InvertMap( map, invMap );
+
+    const Int height = A.Height();
+    const Int numEntries = A.NumEntries();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    height_ = height;
+    offsets_.assign( offsetBuf, offsetBuf+height+1 );
+    targets_.assign( targetBuf, targetBuf+numEntries );
+    ctrl_ = ctrl;
+    ++numAnalyses_;
+    return true;
+}
+
+template<typename F>
+void FactorizationPlan<F>::Factor
+( const SparseMatrix<F>& A,
+  LDLFrontType factorType,
+  bool conjugate,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    Analyze( A, ctrl );
+    front.Pull( A, map, info, conjugate );
+    LDL( info, front, factorType );
+}
+
+template<typename F>
+void FactorizationPlan<F>::Reset()
+{
+    DEBUG_CSE
+    height_ = -1;
+    SwapClear( offsets_ );
+    SwapClear( targets_ );
+}
+
+template<typename F>
+Int FactorizationPlan<F>::NumAnalyses() const
+{ return numAnalyses_; }
+
+template<typename F>
+DistFactorizationPlan<F>::DistFactorizationPlan()
+: comm_(mpi::COMM_SELF), height_(-1), numAnalyses_(0)
+{ }
+
+template<typename F>
+bool DistFactorizationPlan<F>::Matches( const DistSparseMatrix<F>& A ) const
+{
+    DEBUG_CSE
+    if( comm_ != A.Comm() )
+        return false;
+    const bool localMatch =
+      PatternMatches
+      ( height_, offsets_, targets_, A.LocalHeight(), A.NumLocalEntries(),
+        A.LockedOffsetBuffer(), A.LockedTargetBuffer() );
+    const int match = mpi::AllReduce( int(localMatch), mpi::MIN, A.Comm() );
+    return match == 1;
+}
+
+template<typename F>
+bool DistFactorizationPlan<F>::Analyze
+( const DistSparseMatrix<F>& A, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    if( Matches(A) && SameBisection(ctrl,ctrl_) )
+        return false;
+
+    NestedDissection( A.LockedDistGraph(), map, rootSep, info, ctrl );
+    InvertMap( map, invMap );
+    // The communication metadata for pulling entries into the fronts depends
+    // upon the reordering and must be recomputed
+    SwapClear( mappedSources );
+    SwapClear( mappedTargets );
+    SwapClear( colOffs );
+
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    comm_ = A.Comm();
+    height_ = localHeight;
+    offsets_.assign( offsetBuf, offsetBuf+localHeight+1 );
+    targets_.assign( targetBuf, targetBuf+numLocalEntries );
+    ctrl_ = ctrl;
+    ++numAnalyses_;
+    return true;
+}
+
+template<typename F>
+void DistFactorizationPlan<F>::Factor
+( const DistSparseMatrix<F>& A,
+  LDLFrontType factorType,
+  bool conjugate,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    Analyze( A, ctrl );
+    front.Pull
+    ( A, map, rootSep, info, mappedSources, mappedTargets, colOffs,
+      conjugate );
+    LDL( info, front, factorType );
+}
+
+template<typename F>
+void DistFactorizationPlan<F>::Reset()
+{
+    DEBUG_CSE
+    height_ = -1;
+    SwapClear( offsets_ );
+    SwapClear( targets_ );
+}
+
+template<typename F>
+Int DistFactorizationPlan<F>::NumAnalyses() const
+{ return numAnalyses_; }
+
+#define PROTO(F) \
+  template struct FactorizationPlan<F>; \
+  template struct DistFactorizationPlan<F>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -25,9 +25,63 @@
 namespace El {
 namespace ldl {
 
+#ifdef EL_HYBRID
+// The number of bytes of child update matrices which are currently being
+// held simultaneously due to concurrently-factored sibling subtrees
+inline double& SubtreeTaskMemoryInUse()
+{
+    static double bytes = 0;
+    return bytes;
+}
+
+// Decide whether the children of the given node should be factored as
+// concurrent tasks and, if so, reserve the memory for their update matrices
+inline bool ReserveSubtreeTasks
+( const NodeInfo& info, Int entrySize, double& reservedBytes )
+{
+    reservedBytes = 0;
+    if( info.children.size() < 2 || omp_get_num_threads() == 1 )
+        return false;
+
+    Int numLargeChildren = 0;
+    double updateBytes = 0;
+    const double gflopCutoff = SubtreeTaskGFlopCutoff();
+    for( const NodeInfo* child : info.children )
+    {
+        const double childUpdateSize = child->lowerStruct.size();
+        updateBytes += childUpdateSize*childUpdateSize*entrySize;
+        if( SubtreeFactorGFlops(*child) >= gflopCutoff )
+            ++numLargeChildren;
+    }
+    if( numLargeChildren < 2 )
+        return false;
+
+    bool reserved = false;
+    #pragma omp critical(ElSubtreeTaskMemory)
+    {
+        double& bytesInUse = SubtreeTaskMemoryInUse();
+        if( bytesInUse + updateBytes <= SubtreeTaskMemoryLimit() )
+        {
+            bytesInUse += updateBytes;
+            reserved = true;
+        }
+    }
+    if( reserved )
+        reservedBytes = updateBytes;
+    return reserved;
+}
+
+inline void ReleaseSubtreeTasks( double reservedBytes )
+{
+    #pragma omp critical(ElSubtreeTaskMemory)
+    SubtreeTaskMemoryInUse() -= reservedBytes;
+}
+#endif // ifdef EL_HYBRID
+
 template<typename F> 
 inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+ProcessSubtree
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
 {
     DEBUG_CSE
     const int updateSize = info.lowerStruct.size();
@@ -118,9 +172,45 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
 
         // Process children and add in their updates
         const int numChildren = info.children.size();
+        bool processedChildren = false;
+#ifdef EL_HYBRID
+        double reservedBytes;
+        if( IsThreadSafe<F>::value &&
+            ReserveSubtreeTasks( info, sizeof(F), reservedBytes ) )
+        {
+            // Factor the sibling subtrees concurrently, but forward any
+            // exceptions to the parent (they may not escape a task)
+            vector<std::exception_ptr> errors(numChildren);
+            for( Int c=0; c<numChildren; ++c )
+            {
+                #pragma omp task default(shared) firstprivate(c)
+                {
+                    try
+                    {
+                        ProcessSubtree
+                        ( *info.children[c], *front.children[c], factorType );
+                    }
+                    catch( ... )
+                    { errors[c] = std::current_exception(); }
+                }
+            }
+            #pragma omp taskwait
+            for( Int c=0; c<numChildren; ++c )
+            {
+                if( errors[c] )
+                {
+                    ReleaseSubtreeTasks( reservedBytes );
+                    std::rethrow_exception( errors[c] );
+                }
+            }
+            processedChildren = true;
+        }
+#endif
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            if( !processedChildren )
+                ProcessSubtree
+                ( *info.children[c], *front.children[c], factorType );
 
             auto& childU = front.children[c]->workDense;
             const int childUSize = childU.Height();
@@ -139,10 +229,42 @@ Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
             }
             childU.Empty();
         }
+#ifdef EL_HYBRID
+        if( processedChildren )
+            ReleaseSubtreeTasks( reservedBytes );
+#endif
         ProcessFront( front, factorType );
     }
 }
 
+template<typename F> 
+inline void 
+Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_CSE
+#ifdef EL_HYBRID
+    // Launch a team of threads which share the tasks of the subtrees (the
+    // fronts of non-thread-safe types must be formed by the calling thread)
+    if( IsThreadSafe<F>::value &&
+        !omp_in_parallel() && omp_get_max_threads() > 1 )
+    {
+        std::exception_ptr error;
+        #pragma omp parallel
+        {
+            #pragma omp single
+            {
+                try { ProcessSubtree( info, front, factorType ); }
+                catch( ... ) { error = std::current_exception(); }
+            }
+        }
+        if( error )
+            std::rethrow_exception( error );
+        return;
+    }
+#endif
+    ProcessSubtree( info, front, factorType );
+}
+
 template<typename F>
 inline void
 Process
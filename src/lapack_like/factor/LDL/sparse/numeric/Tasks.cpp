@@ -0,0 +1,37 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace {
+
+double subtreeTaskGFlopCutoff = 0.01;
+double subtreeTaskMemoryLimit = 1e9;
+
+} // anonymous namespace
+
+namespace El {
+namespace ldl {
+
+void SetSubtreeTaskGFlopCutoff( double gflops )
+{ ::subtreeTaskGFlopCutoff = gflops; }
+
+double SubtreeTaskGFlopCutoff()
+{ return ::subtreeTaskGFlopCutoff; }
+
+void SetSubtreeTaskMemoryLimit( double bytes )
+{ ::subtreeTaskMemoryLimit = bytes; }
+
+double SubtreeTaskMemoryLimit()
+{ return ::subtreeTaskMemoryLimit; }
+
+double SubtreeFactorGFlops( const NodeInfo& info )
+{ return info.subtreeGFlops; }
+
+} // namespace ldl
+} // namespace El
@@ -279,6 +279,14 @@ Int Analysis( NodeInfo& node, Int myOff )
             node.origLowerRelInds[i] = i + node.size;
     }
 
+    // Accumulate the flops from the dense partial factorizations of the
+    // fronts of the subtree
+    const double n = node.size;
+    const double u = node.lowerStruct.size();
+    node.subtreeGFlops = ((1./3.)*n*n*n + n*n*u + n*u*u)/1.e9;
+    for( const NodeInfo* child : node.children )
+        node.subtreeGFlops += child->subtreeGFlops;
+
     return myOff + node.size;
 }
 
@@ -22,6 +22,7 @@ template<typename F>
 void LU( Matrix<F>& A )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
@@ -47,15 +48,21 @@ template<typename F>
 void LU( ElementalMatrix<F>& APre )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistLU");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
 
+    // Each panel is updated (and the redistribution of its pieces is started)
+    // before the remainder of the trailing matrix so that its communication
+    // can overlap the rest of the update. Since the current A21 is needed for
+    // the entire update, its [MC,* ] copies alternate between two matrices.
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,MC,  STAR> A21_MC_STAR(g);
+    DistMatrix<F,MC,  STAR> A21Even_MC_STAR(g), A21Odd_MC_STAR(g);
     DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+    CopyRequest<F> A11Request, A21Request;
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -71,12 +78,21 @@ void LU( ElementalMatrix<F>& APre )
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
 
-        A11_STAR_STAR = A11;
+        const bool even = ( (k/bsize) % 2 == 0 );
+        auto& A21_MC_STAR = ( even ? A21Even_MC_STAR : A21Odd_MC_STAR );
+        auto& A21Next_MC_STAR = ( even ? A21Odd_MC_STAR : A21Even_MC_STAR );
+        if( k == 0 )
+        {
+            A21_MC_STAR.AlignWith( A22 );
+            ICopy( A11, A11_STAR_STAR, A11Request );
+            ICopy( A21, A21_MC_STAR, A21Request );
+        }
+
+        A11Request.Wait();
         LU( A11_STAR_STAR );
         A11 = A11_STAR_STAR;
 
-        A21_MC_STAR.AlignWith( A22 );
-        A21_MC_STAR = A21;
+        A21Request.Wait();
         LocalTrsm
         ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
         A21 = A21_MC_STAR;
@@ -90,7 +106,31 @@ void LU( ElementalMatrix<F>& APre )
 
         A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
-        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        const Int nbNext = Min(bsize,minDim-(k+nb));
+        if( nbNext > 0 )
+        {
+            const IR indL( 0, nbNext ), indR( nbNext, END );
+            auto A22L = A22( ALL, indL );
+            auto A22R = A22( ALL, indR );
+            auto A12L_STAR_MR = A12_STAR_MR( ALL, indL );
+            auto A12R_STAR_MR = A12_STAR_MR( ALL, indR );
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12L_STAR_MR, F(1), A22L );
+
+            auto A11Next = A22( indL, indL );
+            auto A21Next = A22( indR, indL );
+            auto A22Next = A22( indR, indR );
+            A21Next_MC_STAR.AlignWith( A22Next );
+            ICopy( A11Next, A11_STAR_STAR, A11Request );
+            ICopy( A21Next, A21Next_MC_STAR, A21Request );
+
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12R_STAR_MR, F(1), A22R );
+        }
+        else
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
         A12 = A12_STAR_MR;
     }
 }
@@ -105,6 +145,7 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -148,6 +189,7 @@ void LU
   Permutation& Q )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("LU");
     lu::Full( A, P, Q );
 }
 
@@ -155,6 +197,7 @@ template<typename F>
 void LU( ElementalMatrix<F>& APre, DistPermutation& P )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistLU");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -227,6 +270,7 @@ void LU
   DistPermutation& Q )
 {
     DEBUG_CSE
+    EL_PROFILE_REGION("DistLU");
     lu::Full( A, P, Q );
 }
 
@@ -21,6 +21,30 @@
 
 namespace El {
 
+namespace {
+
+TSQRTree tsqrTree = TSQR_BINARY_TREE;
+Int tsqrNodeSize = 0;
+
+} // anonymous namespace
+
+namespace qr {
+namespace ts {
+
+void SetTree( TSQRTree tree ) { tsqrTree = tree; }
+TSQRTree Tree() { return tsqrTree; }
+
+void SetNodeSize( Int nodeSize )
+{
+    if( nodeSize < 0 )
+        LogicError("The TSQR node size must be non-negative");
+    tsqrNodeSize = nodeSize;
+}
+Int NodeSize() { return tsqrNodeSize; }
+
+} // namespace ts
+} // namespace qr
+
 template<typename F> 
 void QR
 ( Matrix<F>& A,
@@ -197,7 +221,17 @@ void QR
   template void qr::ts::Reduce \
   ( const ElementalMatrix<F>& A, TreeData<F>& treeData ); \
   template void qr::ts::Scatter \
-  ( ElementalMatrix<F>& A, const TreeData<F>& treeData ); 
+  ( ElementalMatrix<F>& A, const TreeData<F>& treeData ); \
+  template void qr::ts::ApplyQ \
+  ( const ElementalMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+    const ElementalMatrix<F>& Y, \
+          ElementalMatrix<F>& X ); \
+  template void qr::ts::ApplyQAdjoint \
+  ( const ElementalMatrix<F>& A, \
+    const TreeData<F>& treeData, \
+    const ElementalMatrix<F>& X, \
+          ElementalMatrix<F>& Y );
 
 #define PROTO(F) \
   PROTO_BASE(F) \
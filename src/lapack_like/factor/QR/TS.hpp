@@ -13,6 +13,81 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// Append the levels of a binary tree over the given (sorted) ranks, where
+// each level maps every active process to the rank it sends its triangular
+// factor to (itself if it is combining factors at that level) and maps the
+// processes which were already absorbed to -1
+inline void AppendBinaryLevels
+( const vector<Int>& members, Int p, vector<vector<Int>>& levels )
+{
+    const Int numMembers = members.size();
+    for( Int stride=1; stride<numMembers; stride*=2 )
+    {
+        vector<Int> parents( p, -1 );
+        for( Int i=0; i<numMembers; i+=stride )
+            parents[members[i]] = members[i-(i%(2*stride))];
+        levels.push_back( parents );
+    }
+}
+
+// Build the levels of the reduction tree selected by ts::Tree(). Every
+// process computes the same tree, and rank 0 is always the root.
+inline vector<vector<Int>> ReductionLevels( mpi::Comm colComm )
+{
+    DEBUG_CSE
+    const Int p = mpi::Size( colComm );
+    vector<vector<Int>> levels;
+    if( p == 1 )
+        return levels;
+
+    vector<Int> ranks( p );
+    for( Int q=0; q<p; ++q )
+        ranks[q] = q;
+
+    const TSQRTree tree = Tree();
+    if( tree == TSQR_FLAT_TREE )
+    {
+        levels.push_back( vector<Int>(p,0) );
+    }
+    else if( tree == TSQR_HYBRID_TREE )
+    {
+        // Each process is led by the smallest rank on its node
+        vector<Int> leaders( p );
+        const Int nodeSize = NodeSize();
+        if( nodeSize > 0 )
+        {
+            for( Int q=0; q<p; ++q )
+                leaders[q] = q - (q%nodeSize);
+        }
+        else
+        {
+            const int rank = mpi::Rank( colComm );
+            mpi::Comm nodeComm;
+            mpi::SplitShared( colComm, rank, nodeComm );
+            int leader = rank;
+            mpi::Broadcast( leader, 0, nodeComm );
+            mpi::Free( nodeComm );
+            vector<int> leadersInt( p );
+            mpi::AllGather( &leader, 1, leadersInt.data(), 1, colComm );
+            for( Int q=0; q<p; ++q )
+                leaders[q] = leadersInt[q];
+        }
+
+        vector<Int> nodeLeaders;
+        for( Int q=0; q<p; ++q )
+            if( leaders[q] == q )
+                nodeLeaders.push_back( q );
+        if( Int(nodeLeaders.size()) < p )
+            levels.push_back( leaders );
+        AppendBinaryLevels( nodeLeaders, p, levels );
+    }
+    else
+    {
+        AppendBinaryLevels( ranks, p, levels );
+    }
+    return levels;
+}
+
 template<typename F>
 void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -28,61 +103,78 @@ void Reduce( const ElementalMatrix<F>& A, TreeData<F>& treeData )
     if( p == 1 )
         return;
     const Int rank = mpi::Rank( colComm );
-    if( m < p*n ) 
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    Matrix<F> lastZ;
-    lastZ = treeData.QR0( IR(0,n), IR(0,n) );
-
-    treeData.QRList.resize( logp );
-    treeData.phaseList.resize( logp );
-    treeData.signatureList.resize( logp );
+    if( m < n ) 
+        LogicError("TSQR assumes height >= width");
 
-    // Run the binary tree reduction
-    Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+    // Extract our portion of the tree
+    const auto levels = ReductionLevels( colComm );
+    treeData.childrenList.clear();
+    treeData.parent = -1;
+    for( const auto& parents : levels )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
+        if( parents[rank] != rank )
         {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
-        else
-        {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
+            treeData.parent = parents[rank];
             break;
         }
+        vector<Int> children;
+        for( Int q=0; q<p; ++q )
+            if( q != rank && parents[q] == rank )
+                children.push_back( q );
+        if( children.size() > 0 )
+            treeData.childrenList.push_back( children );
+    }
+    const Int numStages = treeData.childrenList.size();
+
+    // Processes with fewer than n local rows zero-pad their triangular factor
+    const Int localHeight = treeData.QR0.Height();
+    const Int localMinDim = Min(localHeight,n);
+    Matrix<F> lastZ;
+    Zeros( lastZ, n, n );
+    auto lastZTop = lastZ( IR(0,localMinDim), ALL );
+    lastZTop = treeData.QR0( IR(0,localMinDim), ALL );
+    MakeTrapezoidal( UPPER, lastZ );
+
+    treeData.QRList.resize( numStages );
+    treeData.phaseList.resize( numStages );
+    treeData.signatureList.resize( numStages );
 
+    // Run the tree reduction
+    Matrix<F> ZChild(n,n,n);
+    for( Int stage=0; stage<numStages; ++stage )
+    {
+        // Stack our n x n matrix on top of those of our children
+        const auto& children = treeData.childrenList[stage];
+        const Int numChildren = children.size();
         auto& QRFact = treeData.QRList[stage];
         auto& phase = treeData.phaseList[stage];
         auto& signature = treeData.signatureList[stage];
-        QRFact.Resize( 2*n, n, 2*n );
-        phase.Resize( n, 1 );
-        signature.Resize( n, 1 );
-        auto QRFactTop = QRFact( IR(0,n),   IR(0,n) );
-        auto QRFactBot = QRFact( IR(n,2*n), IR(0,n) );
-        QRFactTop = ZTop;
-        QRFactBot = ZBot;
+        QRFact.Resize( (numChildren+1)*n, n, (numChildren+1)*n );
+        auto QRFactTop = QRFact( IR(0,n), ALL );
+        QRFactTop = lastZ;
+        for( Int c=0; c<numChildren; ++c )
+        {
+            mpi::Recv( ZChild.Buffer(), n*n, children[c], colComm );
+            auto QRFactChild = QRFact( IR((c+1)*n,(c+2)*n), ALL );
+            QRFactChild = ZChild;
+        }
 
         // Note that the last QR is not performed by this routine, as many
         // higher-level routines, such as TS-SVT, are simplified if the final
         // small matrix is left alone.
-        if( stage < logp-1 )
+        if( treeData.parent != -1 || stage < numStages-1 )
         {
-            // TODO: Exploit double-triangular structure
+            // TODO: Exploit the triangular structure of the blocks
             QR( QRFact, phase, signature );
-            lastZ = QRFact( IR(0,n), IR(0,n) );
+            lastZ = QRFact( IR(0,n), ALL );
+            MakeTrapezoidal( UPPER, lastZ );
         }
     }
+    if( treeData.parent != -1 )
+    {
+        ZChild = lastZ;
+        mpi::Send( ZChild.LockedBuffer(), n*n, treeData.parent, colComm );
+    }
 }
 
 template<typename F>
@@ -181,6 +273,73 @@ RootSignature( const ElementalMatrix<F>& A, const TreeData<F>& treeData )
         return treeData.signatureList.back();
 }
 
+// Run the tree from the root down to the leaves, applying the Q from each
+// stage, where the root provides the stacked result of its last stage in
+// ZRoot (with the given width) and the local rows of the result are returned
+// in XLoc
+template<typename F>
+void ScatterStacked
+(       mpi::Comm colComm,
+  const TreeData<F>& treeData,
+  const Matrix<F>& ZRoot,
+        Int width,
+        Matrix<F>& XLoc )
+{
+    DEBUG_CSE
+    const Int n = treeData.QR0.Width();
+    const Int numStages = treeData.childrenList.size();
+
+    Matrix<F> Z, ZHalf, ZChild(n,width,n);
+    if( treeData.parent != -1 )
+    {
+        ZHalf.Resize( n, width, n );
+        mpi::Recv( ZHalf.Buffer(), n*width, treeData.parent, colComm );
+    }
+    for( Int stage=numStages-1; stage>=0; --stage )
+    {
+        const auto& children = treeData.childrenList[stage];
+        const Int numChildren = children.size();
+        if( treeData.parent == -1 && stage == numStages-1 )
+        {
+            Z = ZRoot;
+        }
+        else
+        {
+            // Multiply by the current Q
+            Zeros( Z, (numChildren+1)*n, width );
+            auto ZTop = Z( IR(0,n), ALL );
+            ZTop = ZHalf;
+            // TODO: Exploit sparsity?
+            qr::ApplyQ
+            ( LEFT, NORMAL,
+              treeData.QRList[stage],
+              treeData.phaseList[stage],
+              treeData.signatureList[stage],
+              Z );
+        }
+
+        // Send the bottom blocks to our children and keep the top block
+        for( Int c=0; c<numChildren; ++c )
+        {
+            ZChild = Z( IR((c+1)*n,(c+2)*n), ALL );
+            mpi::Send( ZChild.LockedBuffer(), n*width, children[c], colComm );
+        }
+        ZHalf = Z( IR(0,n), ALL );
+    }
+
+    // Apply the initial Q (only the leading rows of ZHalf can be nonzero
+    // when there are fewer than n local rows)
+    const Int localHeight = treeData.QR0.Height();
+    const Int localMinDim = Min(localHeight,n);
+    Zeros( XLoc, localHeight, width );
+    auto XLocTop = XLoc( IR(0,localMinDim), ALL );
+    XLocTop = ZHalf( IR(0,localMinDim), ALL );
+    // TODO: Exploit sparsity
+    qr::ApplyQ
+    ( LEFT, NORMAL,
+      treeData.QR0, treeData.phase0, treeData.signature0, XLoc );
+}
+
 template<typename F>
 void Scatter( ElementalMatrix<F>& A, const TreeData<F>& treeData )
 {
@@ -189,71 +348,139 @@ void Scatter( ElementalMatrix<F>& A, const TreeData<F>& treeData )
       if( A.RowDist() != STAR )
           LogicError("Invalid row distribution for TSQR");
     )
-    const Int m = A.Height();
     const Int n = A.Width();
     const mpi::Comm colComm = A.ColComm();
     const Int p = mpi::Size( colComm );
     if( p == 1 )
         return;
-    const Int rank = mpi::Rank( colComm );
-    if( m < p*n ) 
-        LogicError("TSQR currently assumes height >= width*numProcesses");
-    if( !PowerOfTwo(p) )
-        LogicError("TSQR currently requires power-of-two number of processes");
-    const Int logp = FlooredLog2(p);
-
-    // Run the binary tree scatter
-    Matrix<F> Z(2*n,n,2*n), ZHalf(n,n,n);
-    if( rank == 0 )
-        Z = RootQR( A, treeData );
-    auto ZTop = Z( IR(0,n),   IR(0,n) );
-    auto ZBot = Z( IR(n,2*n), IR(0,n) );
-    for( Int revStage=0; revStage<logp; ++revStage )
+    if( A.ColRank() == 0 )
+        ScatterStacked( colComm, treeData, RootQR(A,treeData), n, A.Matrix() );
+    else
+        ScatterStacked( colComm, treeData, Matrix<F>(), n, A.Matrix() );
+}
+
+template<typename F>
+void ApplyQ
+( const ElementalMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const ElementalMatrix<F>& Y,
+        ElementalMatrix<F>& X )
+{
+    DEBUG_CSE
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int width = Y.Width();
+    if( Y.Height() != n )
+        LogicError("Y must have the same height as the width of A");
+    const mpi::Comm colComm = A.ColComm();
+    const Int p = mpi::Size( colComm );
+
+    DistMatrix<F,STAR,STAR> YFull( Y );
+    unique_ptr<ElementalMatrix<F>> XA( A.Construct(A.Grid(),A.Root()) );
+    XA->AlignWith( A );
+    XA->Resize( m, width );
+    if( p == 1 )
     {
-        const Int stage = (logp-1)-revStage;
-        // Skip this stage if the first stage bits of our rank are not zero
-        if( stage>0 && (Unsigned(rank) & ((Unsigned(1)<<stage)-1)) )
-            continue;
-
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
+        const Int localMinDim = Min(m,n);
+        auto& XLoc = XA->Matrix();
+        Zero( XLoc );
+        auto XLocTop = XLoc( IR(0,localMinDim), ALL );
+        XLocTop = YFull.Matrix()( IR(0,localMinDim), ALL );
+        qr::ApplyQ
+        ( LEFT, NORMAL,
+          treeData.QR0, treeData.phase0, treeData.signature0, XLoc );
+    }
+    else
+    {
+        // The root forms its stacked contribution, Q_root [Y; 0]
+        Matrix<F> ZRoot;
+        if( A.ColRank() == 0 )
         {
-            if( stage < logp-1 )
-            {
-                // Multiply by the current Q
-                ZTop = ZHalf;        
-                Zero( ZBot );
-
-                // TODO: Exploit sparsity?
-                ApplyQ
-                ( LEFT, NORMAL, 
-                  treeData.QRList[stage],
-                  treeData.phaseList[stage], 
-                  treeData.signatureList[stage],
-                  Z );
-            }
-            // Send bottom-half to partner and keep top half
-            ZHalf = ZBot;
-            mpi::Send( ZHalf.LockedBuffer(), n*n, partner, colComm );
-            ZHalf = ZTop; 
+            const auto& rootQR = RootQR( A, treeData );
+            Zeros( ZRoot, rootQR.Height(), width );
+            auto ZRootTop = ZRoot( IR(0,n), ALL );
+            ZRootTop = YFull.Matrix();
+            qr::ApplyQ
+            ( LEFT, NORMAL,
+              rootQR, RootPhases(A,treeData), RootSignature(A,treeData),
+              ZRoot );
         }
-        else
+        ScatterStacked( colComm, treeData, ZRoot, width, XA->Matrix() );
+    }
+    Copy( *XA, X );
+}
+
+// Requires that the root's stage was factored, as in qr::TS
+template<typename F>
+void ApplyQAdjoint
+( const ElementalMatrix<F>& A,
+  const TreeData<F>& treeData,
+  const ElementalMatrix<F>& X,
+        ElementalMatrix<F>& Y )
+{
+    DEBUG_CSE
+    if( A.RowDist() != STAR )
+        LogicError("Invalid row distribution for TSQR");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int width = X.Width();
+    if( X.Height() != m )
+        LogicError("X must have the same height as A");
+    const mpi::Comm colComm = A.ColComm();
+    const Int p = mpi::Size( colComm );
+
+    unique_ptr<ElementalMatrix<F>> XA( A.Construct(A.Grid(),A.Root()) );
+    XA->AlignWith( A );
+    Copy( X, *XA );
+
+    // Apply the local Q^H and keep the (zero-padded) leading n rows
+    Matrix<F> W( XA->LockedMatrix() );
+    qr::ApplyQ
+    ( LEFT, ADJOINT, treeData.QR0, treeData.phase0, treeData.signature0, W );
+    const Int localMinDim = Min(W.Height(),n);
+    Matrix<F> ZHalf;
+    Zeros( ZHalf, n, width );
+    auto ZHalfTop = ZHalf( IR(0,localMinDim), ALL );
+    ZHalfTop = W( IR(0,localMinDim), ALL );
+
+    // Run up the tree, mirroring ts::Reduce
+    Matrix<F> Z, ZChild(n,width,n);
+    const Int numStages = ( p == 1 ? 0 : treeData.childrenList.size() );
+    for( Int stage=0; stage<numStages; ++stage )
+    {
+        const auto& children = treeData.childrenList[stage];
+        const Int numChildren = children.size();
+        Zeros( Z, (numChildren+1)*n, width );
+        auto ZTop = Z( IR(0,n), ALL );
+        ZTop = ZHalf;
+        for( Int c=0; c<numChildren; ++c )
         {
-            // Recv top half from partner
-            mpi::Recv( ZHalf.Buffer(), n*n, partner, colComm );
+            mpi::Recv( ZChild.Buffer(), n*width, children[c], colComm );
+            auto ZBlock = Z( IR((c+1)*n,(c+2)*n), ALL );
+            ZBlock = ZChild;
         }
+        qr::ApplyQ
+        ( LEFT, ADJOINT,
+          treeData.QRList[stage],
+          treeData.phaseList[stage],
+          treeData.signatureList[stage],
+          Z );
+        ZHalf = Z( IR(0,n), ALL );
+    }
+    if( p > 1 && treeData.parent != -1 )
+    {
+        ZChild = ZHalf;
+        mpi::Send( ZChild.LockedBuffer(), n*width, treeData.parent, colComm );
     }
 
-    // Apply the initial Q
-    Zero( A );
-    auto ATop = A.Matrix()( IR(0,n), IR(0,n) );
-    ATop = ZHalf;
-
-    // TODO: Exploit sparsity
-    ApplyQ
-    ( LEFT, NORMAL,
-      treeData.QR0, treeData.phase0, treeData.signature0, A.Matrix() );
+    DistMatrix<F,CIRC,CIRC> YRoot(A.Grid());
+    if( A.ColRank() == 0 )
+        CopyFromRoot( ZHalf, YRoot );
+    else
+        CopyFromNonRoot( YRoot );
+    Copy( YRoot, Y );
 }
 
 template<typename F>
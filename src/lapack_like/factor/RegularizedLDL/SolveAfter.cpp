@@ -651,7 +651,8 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<F> relTolRefine,
   Int maxRefineIts,
-  bool progress )
+  bool progress,
+  GramSchmidtAlg orthog )
 {
     DEBUG_CSE
 
@@ -668,7 +669,9 @@ Int LGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog );
 }
 
 template<typename F>
@@ -685,7 +688,8 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<F> relTolRefine,
   Int maxRefineIts,
-  bool progress )
+  bool progress,
+  GramSchmidtAlg orthog )
 {
     DEBUG_CSE
 
@@ -702,7 +706,9 @@ Int LGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog );
 }
 
 template<typename F>
@@ -719,7 +725,9 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<F> relTolRefine,
   Int maxRefineIts,
-  bool progress )
+  bool progress,
+  GramSchmidtAlg orthog,
+  bool pipeline )
 {
     DEBUG_CSE
 
@@ -736,7 +744,9 @@ Int LGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog, pipeline );
 }
 
 template<typename F>
@@ -752,13 +762,16 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<F> relTolRefine,
   Int maxRefineIts,
-  bool progress )
+  bool progress,
+  GramSchmidtAlg orthog,
+  bool pipeline )
 {
     DEBUG_CSE
     ldl::DistMultiVecNodeMeta meta;
     return LGMRESSolveAfter
            ( A, reg, invMap, info, front, B, meta,
-             relTol, restart, maxIts, relTolRefine, maxRefineIts, progress );
+             relTol, restart, maxIts, relTolRefine, maxRefineIts, progress,
+             orthog, pipeline );
 }
 
 template<typename F>
@@ -776,7 +789,9 @@ Int LGMRESSolveAfter
         Int maxIts,
         Base<F> relTolRefine,
         Int maxRefineIts,
-        bool progress )
+        bool progress,
+        GramSchmidtAlg orthog,
+        bool pipeline )
 {
     DEBUG_CSE
 
@@ -793,7 +808,9 @@ Int LGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return LGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog, pipeline );
 }
 
 template<typename F>
@@ -810,13 +827,16 @@ Int LGMRESSolveAfter
   Int maxIts,
   Base<F> relTolRefine,
   Int maxRefineIts,
-  bool progress )
+  bool progress,
+  GramSchmidtAlg orthog,
+  bool pipeline )
 {
     DEBUG_CSE
     ldl::DistMultiVecNodeMeta meta;
     return LGMRESSolveAfter
            ( A, reg, d, invMap, info, front, B, meta,
-             relTol, restart, maxIts, relTolRefine, maxRefineIts, progress );
+             relTol, restart, maxIts, relTolRefine, maxRefineIts, progress,
+             orthog, pipeline );
 }
 
 template<typename F>
@@ -833,7 +853,8 @@ Int FGMRESSolveAfter
         Base<F> relTolRefine,
         Int maxRefineIts, 
         bool progress,
-        bool time )
+        bool time,
+        GramSchmidtAlg orthog )
 {
     DEBUG_CSE
 
@@ -850,7 +871,9 @@ Int FGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog );
 }
 
 template<typename F>
@@ -868,7 +891,8 @@ Int FGMRESSolveAfter
         Base<F> relTolRefine,
         Int maxRefineIts, 
         bool progress,
-        bool time )
+        bool time,
+        GramSchmidtAlg orthog )
 {
     DEBUG_CSE
 
@@ -885,7 +909,9 @@ Int FGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog );
 }
 
 template<typename F>
@@ -903,7 +929,9 @@ Int FGMRESSolveAfter
         Base<F> relTolRefine,
         Int maxRefineIts, 
         bool progress,
-        bool time )
+        bool time,
+        GramSchmidtAlg orthog,
+        bool pipeline )
 {
     DEBUG_CSE
 
@@ -920,7 +948,9 @@ Int FGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog, pipeline );
 }
 
 template<typename F>
@@ -937,14 +967,16 @@ Int FGMRESSolveAfter
         Base<F> relTolRefine,
         Int maxRefineIts, 
         bool progress,
-        bool time )
+        bool time,
+        GramSchmidtAlg orthog,
+        bool pipeline )
 {
     DEBUG_CSE
     ldl::DistMultiVecNodeMeta meta;
     return FGMRESSolveAfter
            ( A, reg, invMap, info, front, B, meta,
              relTol, restart, maxIts, relTolRefine, maxRefineIts,
-             progress, time );
+             progress, time, orthog, pipeline );
 }
 
 template<typename F>
@@ -963,7 +995,9 @@ Int FGMRESSolveAfter
         Base<F> relTolRefine,
         Int maxRefineIts, 
         bool progress,
-        bool time )
+        bool time,
+        GramSchmidtAlg orthog,
+        bool pipeline )
 {
     DEBUG_CSE
 
@@ -980,7 +1014,9 @@ Int FGMRESSolveAfter
           relTolRefine, maxRefineIts, progress );
       };
 
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+    return FGMRES
+           ( applyA, precond, B, relTol, restart, maxIts, progress,
+             orthog, pipeline );
 }
 
 template<typename F>
@@ -998,14 +1034,16 @@ Int FGMRESSolveAfter
         Base<F> relTolRefine,
         Int maxRefineIts, 
         bool progress,
-        bool time )
+        bool time,
+        GramSchmidtAlg orthog,
+        bool pipeline )
 {
     DEBUG_CSE
     ldl::DistMultiVecNodeMeta meta;
     return FGMRESSolveAfter
            ( A, reg, d, invMap, info, front, B, meta,
              relTol, restart, maxIts, relTolRefine, maxRefineIts,
-             progress, time );
+             progress, time, orthog, pipeline );
 }
 
 // TODO: Add RGMRES
@@ -1028,13 +1066,13 @@ Int SolveAfter
         ( A, reg, invMap, info, front, B, 
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
+          ctrl.progress, ctrl.time, ctrl.orthog );
     case REG_SOLVE_LGMRES:
         return LGMRESSolveAfter
         ( A, reg, invMap, info, front, B, 
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
+          ctrl.progress, ctrl.orthog );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -1060,13 +1098,13 @@ Int SolveAfter
         ( A, reg, d, invMap, info, front, B, 
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
+          ctrl.progress, ctrl.time, ctrl.orthog );
     case REG_SOLVE_LGMRES:
         return LGMRESSolveAfter
         ( A, reg, d, invMap, info, front, B, 
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
+          ctrl.progress, ctrl.orthog );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -1092,13 +1130,13 @@ Int SolveAfter
         ( A, reg, invMap, info, front, B, meta,
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
+          ctrl.progress, ctrl.time, ctrl.orthog, ctrl.pipeline );
     case REG_SOLVE_LGMRES:
         return LGMRESSolveAfter
         ( A, reg, invMap, info, front, B, meta,
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
+          ctrl.progress, ctrl.orthog, ctrl.pipeline );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -1140,13 +1178,13 @@ Int SolveAfter
         ( A, reg, d, invMap, info, front, B, meta,
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
+          ctrl.progress, ctrl.time, ctrl.orthog, ctrl.pipeline );
     case REG_SOLVE_LGMRES:
         return LGMRESSolveAfter
         ( A, reg, d, invMap, info, front, B, meta,
           ctrl.relTol, ctrl.restart, ctrl.maxIts,
           ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
+          ctrl.progress, ctrl.orthog, ctrl.pipeline );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
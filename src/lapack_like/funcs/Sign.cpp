@@ -16,6 +16,49 @@ namespace El {
 
 namespace sign {
 
+// Given XNew = inv(X) and, for determinantal scaling, the log of the geometric
+// mean of the magnitudes of the eigenvalues of X, overwrite XNew with the
+// scaled Newton iterate (mu X + inv(mu X))/2
+template<typename F>
+void NewtonUpdate
+( const Matrix<F>& X,
+        Matrix<F>& XNew,
+  SignScaling scaling,
+  Base<F> kappa=Base<F>(0) )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Real mu=1;
+    if( scaling == SIGN_SCALE_DET )
+        mu = Real(1)/Exp(kappa);
+    else if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
+    const Real halfMu = mu/Real(2);
+    const Real halfMuInv = Real(1)/(2*mu); 
+    XNew *= halfMuInv;
+    Axpy( halfMu, X, XNew );
+}
+
+template<typename F>
+void NewtonUpdate
+( const DistMatrix<F>& X,
+        DistMatrix<F>& XNew,
+  SignScaling scaling,
+  Base<F> kappa=Base<F>(0) )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Real mu=1;
+    if( scaling == SIGN_SCALE_DET )
+        mu = Real(1)/Exp(kappa);
+    else if( scaling == SIGN_SCALE_FROB )
+        mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
+    const Real halfMu = mu/Real(2);
+    const Real halfMuInv = Real(1)/(2*mu); 
+    XNew *= halfMuInv;
+    Axpy( halfMu, X, XNew );
+}
+
 template<typename F>
 void
 NewtonStep
@@ -26,25 +69,17 @@ NewtonStep
     DEBUG_CSE
     typedef Base<F> Real;
 
-    // Calculate mu while forming XNew := inv(X)
-    Real mu=1;
+    // Calculate kappa while forming XNew := inv(X)
+    Real kappa=0;
     Permutation P;
     XNew = X;
     LU( XNew, P );
     if( scaling == SIGN_SCALE_DET )
-    {
-        SafeProduct<F> det = det::AfterLUPartialPiv( XNew, P );
-        mu = Real(1)/Exp(det.kappa);
-    }
+        kappa = det::AfterLUPartialPiv( XNew, P ).kappa;
     inverse::AfterLUPartialPiv( XNew, P );
-    if( scaling == SIGN_SCALE_FROB )
-        mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
 
     // Overwrite XNew with the new iterate
-    const Real halfMu = mu/Real(2);
-    const Real halfMuInv = Real(1)/(2*mu); 
-    XNew *= halfMuInv;
-    Axpy( halfMu, X, XNew );
+    NewtonUpdate( X, XNew, scaling, kappa );
 }
 
 template<typename F>
@@ -57,29 +92,26 @@ NewtonStep
     DEBUG_CSE
     typedef Base<F> Real;
 
-    // Calculate mu while forming B := inv(X)
-    Real mu=1;
+    // Calculate kappa while forming XNew := inv(X)
+    Real kappa=0;
     DistPermutation P( X.Grid() );
     XNew = X;
     LU( XNew, P );
     if( scaling == SIGN_SCALE_DET )
-    {
-        SafeProduct<F> det = det::AfterLUPartialPiv( XNew, P );
-        mu = Real(1)/Exp(det.kappa);
-    }
+        kappa = det::AfterLUPartialPiv( XNew, P ).kappa;
     inverse::AfterLUPartialPiv( XNew, P );
-    if( scaling == SIGN_SCALE_FROB )
-        mu = Sqrt( FrobeniusNorm(XNew)/FrobeniusNorm(X) );
 
     // Overwrite XNew with the new iterate
-    const Real halfMu = mu/Real(2);
-    const Real halfMuInv = Real(1)/(2*mu); 
-    XNew *= halfMuInv;
-    Axpy( halfMu, X, XNew );
+    NewtonUpdate( X, XNew, scaling, kappa );
 }
 
+// The Newton-Schulz iteration, X := X (3I - X^2) / 2, only requires matrix
+// multiplication, but it is only guaranteed to converge when
+// || I - X^2 || < 1. In that case, the residual satisfies
+// I - XNew^2 = (3 R^2 + R^3)/4, where R = I - X^2, and the step is taken;
+// otherwise, false is returned and XNew is left untouched.
 template<typename F>
-void
+bool
 NewtonSchulzStep
 ( const Matrix<F>& X,
         Matrix<F>& XTmp,
@@ -89,16 +121,20 @@ NewtonSchulzStep
     typedef Base<F> Real;
     const Int n = X.Height();
  
-    // XTmp := 3I - X^2
+    // XTmp := I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(1), XTmp );
+    if( OneNorm(XTmp) >= Real(1) )
+        return false;
+
+    // XNew := 1/2 X (3I - X^2)
+    ShiftDiagonal( XTmp, F(2) );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, F(0), XNew );
+    return true;
 }
 
 template<typename F>
-void
+bool
 NewtonSchulzStep
 ( const DistMatrix<F>& X,
         DistMatrix<F>& XTmp,
@@ -108,59 +144,292 @@ NewtonSchulzStep
     typedef Base<F> Real;
     const Int n = X.Height();
 
-    // XTmp := 3I - X^2
+    // XTmp := I - X^2
     Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    Gemm( NORMAL, NORMAL, F(-1), X, X, F(1), XTmp );
+    if( OneNorm(XTmp) >= Real(1) )
+        return false;
+
+    // XNew := 1/2 X (3I - X^2)
+    ShiftDiagonal( XTmp, F(2) );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), X, XTmp, F(0), XNew );
+    return true;
 }
 
-// Please see Chapter 5 of Higham's 
-// "Functions of Matrices: Theory and Computation" for motivation behind
-// the different choices of p, which are usually in {0,1,2}
+// For X = | XTL XTR |, inv(X) = | inv(XTL) -inv(XTL) XTR inv(XBR) |, so that
+//         | 0   XBR |           | 0         inv(XBR)               |
+// only the diagonal blocks need to be inverted
 template<typename F>
-Int
-Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+void
+BlockTriangularNewtonStep
+( Int m,
+  const Matrix<F>& X,
+        Matrix<F>& XNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
 {
     DEBUG_CSE
     typedef Base<F> Real;
-    Real tol = ctrl.tol;
-    if( tol == Real(0) )
-        tol = A.Height()*limits::Epsilon<Real>();
-
-    Int numIts=0;
-    Matrix<F> B;
-    Matrix<F> *X=&A, *XNew=&B;
-    while( numIts < ctrl.maxIts )
+    const Int n = X.Height();
+    const Range<Int> indT(0,m), indB(m,n);
+    auto XTL = X( indT, indT );
+    auto XTR = X( indT, indB );
+    auto XBR = X( indB, indB );
+
+    XNew.Resize( n, n );
+    auto XNewTL = XNew( indT, indT );
+    auto XNewTR = XNew( indT, indB );
+    auto XNewBL = XNew( indB, indT );
+    auto XNewBR = XNew( indB, indB );
+    Zero( XNewBL );
+
+    Real kappa=0;
+    Permutation PT, PB;
+    XNewTL = XTL;
+    LU( XNewTL, PT );
+    XNewBR = XBR;
+    LU( XNewBR, PB );
+    if( scaling == SIGN_SCALE_DET )
     {
-        // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        // log|det(X)| = log|det(XTL)| + log|det(XBR)|
+        kappa = ( m*det::AfterLUPartialPiv(XNewTL,PT).kappa +
+                  (n-m)*det::AfterLUPartialPiv(XNewBR,PB).kappa ) / n;
+    }
+    inverse::AfterLUPartialPiv( XNewTL, PT );
+    inverse::AfterLUPartialPiv( XNewBR, PB );
 
-        // Use the difference in the iterates to test for convergence
-        Axpy( Real(-1), *XNew, *X );
-        const Real oneDiff = OneNorm( *X );
-        const Real oneNew = OneNorm( *XNew );
+    // XNewTR := -inv(XTL) XTR inv(XBR)
+    Matrix<F> Z;
+    Gemm( NORMAL, NORMAL, F(-1), XNewTL, XTR, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, XNewBR, F(0), XNewTR );
 
-        // Ensure that X holds the current iterate and break if possible
-        ++numIts;
-        std::swap( X, XNew );
-        if( ctrl.progress )
-            cout << "after " << numIts << " Newton iter's: " 
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew 
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
-                 << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
-            break;
+    NewtonUpdate( X, XNew, scaling, kappa );
+}
+
+template<typename F>
+void
+BlockTriangularNewtonStep
+( Int m,
+  const DistMatrix<F>& X,
+        DistMatrix<F>& XNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = X.Grid();
+    const Int n = X.Height();
+    const Range<Int> indT(0,m), indB(m,n);
+    auto XTL = X( indT, indT );
+    auto XTR = X( indT, indB );
+    auto XBR = X( indB, indB );
+
+    XNew.Resize( n, n );
+    auto XNewTL = XNew( indT, indT );
+    auto XNewTR = XNew( indT, indB );
+    auto XNewBL = XNew( indB, indT );
+    auto XNewBR = XNew( indB, indB );
+    Zero( XNewBL );
+
+    Real kappa=0;
+    DistPermutation PT(g), PB(g);
+    XNewTL = XTL;
+    LU( XNewTL, PT );
+    XNewBR = XBR;
+    LU( XNewBR, PB );
+    if( scaling == SIGN_SCALE_DET )
+    {
+        // log|det(X)| = log|det(XTL)| + log|det(XBR)|
+        kappa = ( m*det::AfterLUPartialPiv(XNewTL,PT).kappa +
+                  (n-m)*det::AfterLUPartialPiv(XNewBR,PB).kappa ) / n;
     }
-    if( X != &A )
-        A = *X;
-    return numIts;
+    inverse::AfterLUPartialPiv( XNewTL, PT );
+    inverse::AfterLUPartialPiv( XNewBR, PB );
+
+    // XNewTR := -inv(XTL) XTR inv(XBR)
+    DistMatrix<F> Z(g);
+    Gemm( NORMAL, NORMAL, F(-1), XNewTL, XTR, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, XNewBR, F(0), XNewTR );
+
+    NewtonUpdate( X, XNew, scaling, kappa );
 }
 
+// Since X^2 = | XTL^2  XTL XTR + XTR XBR |, the block-triangular Newton-Schulz
+//             | 0      XBR^2             |
+// step requires half of the flops of the unstructured one
 template<typename F>
+bool
+BlockTriangularNewtonSchulzStep
+( Int m,
+  const Matrix<F>& X,
+        Matrix<F>& XTmp,
+        Matrix<F>& XNew )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = X.Height();
+    const Range<Int> indT(0,m), indB(m,n);
+    auto XTL = X( indT, indT );
+    auto XTR = X( indT, indB );
+    auto XBR = X( indB, indB );
+
+    // XTmp := I - X^2
+    XTmp.Resize( n, n );
+    auto XTmpTL = XTmp( indT, indT );
+    auto XTmpTR = XTmp( indT, indB );
+    auto XTmpBL = XTmp( indB, indT );
+    auto XTmpBR = XTmp( indB, indB );
+    Zero( XTmpBL );
+    Gemm( NORMAL, NORMAL, F(-1), XTL, XTL, F(0), XTmpTL );
+    Gemm( NORMAL, NORMAL, F(-1), XTL, XTR, F(0), XTmpTR );
+    Gemm( NORMAL, NORMAL, F(-1), XTR, XBR, F(1), XTmpTR );
+    Gemm( NORMAL, NORMAL, F(-1), XBR, XBR, F(0), XTmpBR );
+    ShiftDiagonal( XTmp, F(1) );
+    if( OneNorm(XTmp) >= Real(1) )
+        return false;
+
+    // XNew := 1/2 X (3I - X^2)
+    ShiftDiagonal( XTmp, F(2) );
+    XNew.Resize( n, n );
+    auto XNewTL = XNew( indT, indT );
+    auto XNewTR = XNew( indT, indB );
+    auto XNewBL = XNew( indB, indT );
+    auto XNewBR = XNew( indB, indB );
+    Zero( XNewBL );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XTL, XTmpTL, F(0), XNewTL );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XTL, XTmpTR, F(0), XNewTR );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XTR, XTmpBR, F(1), XNewTR );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XBR, XTmpBR, F(0), XNewBR );
+    return true;
+}
+
+template<typename F>
+bool
+BlockTriangularNewtonSchulzStep
+( Int m,
+  const DistMatrix<F>& X,
+        DistMatrix<F>& XTmp,
+        DistMatrix<F>& XNew )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = X.Height();
+    const Range<Int> indT(0,m), indB(m,n);
+    auto XTL = X( indT, indT );
+    auto XTR = X( indT, indB );
+    auto XBR = X( indB, indB );
+
+    // XTmp := I - X^2
+    XTmp.Resize( n, n );
+    auto XTmpTL = XTmp( indT, indT );
+    auto XTmpTR = XTmp( indT, indB );
+    auto XTmpBL = XTmp( indB, indT );
+    auto XTmpBR = XTmp( indB, indB );
+    Zero( XTmpBL );
+    Gemm( NORMAL, NORMAL, F(-1), XTL, XTL, F(0), XTmpTL );
+    Gemm( NORMAL, NORMAL, F(-1), XTL, XTR, F(0), XTmpTR );
+    Gemm( NORMAL, NORMAL, F(-1), XTR, XBR, F(1), XTmpTR );
+    Gemm( NORMAL, NORMAL, F(-1), XBR, XBR, F(0), XTmpBR );
+    ShiftDiagonal( XTmp, F(1) );
+    if( OneNorm(XTmp) >= Real(1) )
+        return false;
+
+    // XNew := 1/2 X (3I - X^2)
+    ShiftDiagonal( XTmp, F(2) );
+    XNew.Resize( n, n );
+    auto XNewTL = XNew( indT, indT );
+    auto XNewTR = XNew( indT, indB );
+    auto XNewBL = XNew( indB, indT );
+    auto XNewBR = XNew( indB, indB );
+    Zero( XNewBL );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XTL, XTmpTL, F(0), XNewTL );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XTL, XTmpTR, F(0), XNewTR );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XTR, XTmpBR, F(1), XNewTR );
+    Gemm( NORMAL, NORMAL, F(1)/F(2), XBR, XTmpBR, F(0), XNewBR );
+    return true;
+}
+
+// If X is Hamiltonian, i.e., Y = J X is Hermitian for J = | 0  I |, then
+//                                                          | -I 0 |
+// inv(X) = inv(Y) J, where inv(Y) can be computed from a pivoted LDL^H
+// factorization with half of the work of an LU-based inverse. Both
+// Y = J X = | XB  | and M J = | -MR ML | are simple block permutations.
+//           | -XT |
+template<typename F>
+void
+HamiltonianNewtonStep
+( const Matrix<F>& X,
+        Matrix<F>& XNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
+{
+    DEBUG_CSE
+    const Int n = X.Height()/2;
+    const Range<Int> indT(0,n), indB(n,2*n);
+
+    // Y := J X
+    Matrix<F> Y( 2*n, 2*n );
+    auto YT = Y( indT, ALL );
+    auto YB = Y( indB, ALL );
+    YT = X( indB, ALL );
+    YB = X( indT, ALL );
+    YB *= -1;
+
+    // XNew := inv(Y) J
+    HermitianInverse( LOWER, Y );
+    XNew.Resize( 2*n, 2*n );
+    auto XNewL = XNew( ALL, indT );
+    auto XNewR = XNew( ALL, indB );
+    XNewL = Y( ALL, indB );
+    XNewL *= -1;
+    XNewR = Y( ALL, indT );
+
+    NewtonUpdate( X, XNew, scaling );
+}
+
+template<typename F>
+void
+HamiltonianNewtonStep
+( const DistMatrix<F>& X,
+        DistMatrix<F>& XNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
+{
+    DEBUG_CSE
+    const Int n = X.Height()/2;
+    const Range<Int> indT(0,n), indB(n,2*n);
+
+    // Y := J X
+    DistMatrix<F> Y( 2*n, 2*n, X.Grid() );
+    auto YT = Y( indT, ALL );
+    auto YB = Y( indB, ALL );
+    YT = X( indB, ALL );
+    YB = X( indT, ALL );
+    YB *= -1;
+
+    // XNew := inv(Y) J
+    HermitianInverse( LOWER, Y );
+    XNew.Resize( 2*n, 2*n );
+    auto XNewL = XNew( ALL, indT );
+    auto XNewR = XNew( ALL, indB );
+    XNewL = Y( ALL, indB );
+    XNewL *= -1;
+    XNewR = Y( ALL, indT );
+
+    NewtonUpdate( X, XNew, scaling );
+}
+
+// Please see Chapter 5 of Higham's 
+// "Functions of Matrices: Theory and Computation" for motivation behind
+// the different choices of p, which are usually in {0,1,2}.
+//
+// Scaled Newton iterations are run until the relative change in the iterates
+// drops below ctrl.newtonSchulzTol, after which Newton-Schulz steps are
+// attempted (each falls back to a Newton step if || I - X^2 ||_1 >= 1).
+template<typename F,typename MatType,typename NewtonType,typename SchulzType>
 Int
-Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+Hybrid
+( MatType& A,
+  const NewtonType& newtonStep,
+  const SchulzType& schulzStep,
+  const SignCtrl<Base<F>>& ctrl,
+  bool progress )
 {
     DEBUG_CSE
     typedef Base<F> Real;
@@ -169,12 +438,17 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
         tol = A.Height()*limits::Epsilon<Real>();
 
     Int numIts=0;
-    DistMatrix<F> B( A.Grid() );
-    DistMatrix<F> *X=&A, *XNew=&B;
+    bool trySchulz=false;
+    MatType B( A ), XTmp( A );
+    MatType *X=&A, *XNew=&B;
     while( numIts < ctrl.maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        bool tookSchulz = false;
+        if( trySchulz )
+            tookSchulz = schulzStep( *X, XTmp, *XNew );
+        if( !tookSchulz )
+            newtonStep( *X, *XNew );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -184,20 +458,50 @@ Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
-        if( ctrl.progress && A.Grid().Rank() == 0 )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
+        if( progress )
+            cout << "after " << numIts << " iter's ("
+                 << ( tookSchulz ? "Newton-Schulz" : "Newton" ) << "): "
+                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew 
                  << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
                  << tol << endl;
         if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
             break;
+        trySchulz = ctrl.newtonSchulz &&
+          ( tookSchulz || oneDiff/oneNew <= ctrl.newtonSchulzTol );
     }
     if( X != &A )
         A = *X;
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
+template<typename F>
+Int
+Newton( Matrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    auto newtonStep =
+      [&]( const Matrix<F>& X, Matrix<F>& XNew )
+      { NewtonStep( X, XNew, ctrl.scaling ); };
+    auto schulzStep =
+      [&]( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
+      { return NewtonSchulzStep( X, XTmp, XNew ); };
+    return Hybrid<F>( A, newtonStep, schulzStep, ctrl, ctrl.progress );
+}
+
+template<typename F>
+Int
+Newton( DistMatrix<F>& A, const SignCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    auto newtonStep =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& XNew )
+      { NewtonStep( X, XNew, ctrl.scaling ); };
+    auto schulzStep =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& XTmp, DistMatrix<F>& XNew )
+      { return NewtonSchulzStep( X, XTmp, XNew ); };
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+    return Hybrid<F>( A, newtonStep, schulzStep, ctrl, progress );
+}
 
 } // namespace sign
 
@@ -246,6 +550,86 @@ void Sign
     Gemm( NORMAL, NORMAL, F(1), A, ACopy, N );
 }
 
+template<typename F>
+void BlockTriangularSign
+( Int m, Matrix<F>& A, const SignCtrl<Base<F>> ctrl )
+{
+    DEBUG_CSE
+    auto newtonStep =
+      [&]( const Matrix<F>& X, Matrix<F>& XNew )
+      { sign::BlockTriangularNewtonStep( m, X, XNew, ctrl.scaling ); };
+    auto schulzStep =
+      [&]( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
+      { return sign::BlockTriangularNewtonSchulzStep( m, X, XTmp, XNew ); };
+    sign::Hybrid<F>( A, newtonStep, schulzStep, ctrl, ctrl.progress );
+}
+
+template<typename F>
+void BlockTriangularSign
+( Int m, ElementalMatrix<F>& APre, const SignCtrl<Base<F>> ctrl )
+{
+    DEBUG_CSE
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    auto newtonStep =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& XNew )
+      { sign::BlockTriangularNewtonStep( m, X, XNew, ctrl.scaling ); };
+    auto schulzStep =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& XTmp, DistMatrix<F>& XNew )
+      { return sign::BlockTriangularNewtonSchulzStep( m, X, XTmp, XNew ); };
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+    sign::Hybrid<F>( A, newtonStep, schulzStep, ctrl, progress );
+}
+
+// NOTE: Determinantal scaling requires an LU factorization, and so it falls
+//       back to the unstructured Newton step
+template<typename F>
+void HamiltonianSign( Matrix<F>& A, const SignCtrl<Base<F>> ctrl )
+{
+    DEBUG_CSE
+    if( A.Height() != A.Width() || A.Height() % 2 != 0 )
+        LogicError("Hamiltonian matrices must be square with even order");
+    auto newtonStep =
+      [&]( const Matrix<F>& X, Matrix<F>& XNew )
+      {
+        if( ctrl.scaling == SIGN_SCALE_DET )
+            sign::NewtonStep( X, XNew, ctrl.scaling );
+        else
+            sign::HamiltonianNewtonStep( X, XNew, ctrl.scaling );
+      };
+    auto schulzStep =
+      [&]( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
+      { return sign::NewtonSchulzStep( X, XTmp, XNew ); };
+    sign::Hybrid<F>( A, newtonStep, schulzStep, ctrl, ctrl.progress );
+}
+
+template<typename F>
+void HamiltonianSign( ElementalMatrix<F>& APre, const SignCtrl<Base<F>> ctrl )
+{
+    DEBUG_CSE
+    if( APre.Height() != APre.Width() || APre.Height() % 2 != 0 )
+        LogicError("Hamiltonian matrices must be square with even order");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    auto newtonStep =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& XNew )
+      {
+        if( ctrl.scaling == SIGN_SCALE_DET )
+            sign::NewtonStep( X, XNew, ctrl.scaling );
+        else
+            sign::HamiltonianNewtonStep( X, XNew, ctrl.scaling );
+      };
+    auto schulzStep =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& XTmp, DistMatrix<F>& XNew )
+      { return sign::NewtonSchulzStep( X, XTmp, XNew ); };
+    const bool progress = ctrl.progress && A.Grid().Rank() == 0;
+    sign::Hybrid<F>( A, newtonStep, schulzStep, ctrl, progress );
+}
+
 // The Hermitian sign decomposition is equivalent to the Hermitian polar
 // decomposition... A = (U sgn(Lambda) U') (U sgn(Lambda)Lambda U')
 //                    = (U sgn(Lambda) U') (U |Lambda| U')
@@ -410,7 +794,15 @@ void HermitianSign
   ( Matrix<F>& A, Matrix<F>& N, const SignCtrl<Base<F>> ctrl ); \
   template void Sign \
   ( ElementalMatrix<F>& A, ElementalMatrix<F>& N, \
-    const SignCtrl<Base<F>> ctrl );
+    const SignCtrl<Base<F>> ctrl ); \
+  template void BlockTriangularSign \
+  ( Int m, Matrix<F>& A, const SignCtrl<Base<F>> ctrl ); \
+  template void BlockTriangularSign \
+  ( Int m, ElementalMatrix<F>& A, const SignCtrl<Base<F>> ctrl ); \
+  template void HamiltonianSign \
+  ( Matrix<F>& A, const SignCtrl<Base<F>> ctrl ); \
+  template void HamiltonianSign \
+  ( ElementalMatrix<F>& A, const SignCtrl<Base<F>> ctrl );
 
 #define PROTO(F) \
   PROTO_BASE(F) \
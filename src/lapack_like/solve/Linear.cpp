@@ -202,12 +202,173 @@ void Overwrite
     }
 }
 
+// Factor A in the next lower precision and refine each solution using
+// residuals formed in the working precision. If the demoted factorization
+// breaks down or any solution does not meet the requested backward error,
+// then B is left untouched and false is returned.
+template<typename F>
+bool MixedPrecision
+( const Matrix<F>& A, Matrix<F>& B, const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+    typedef Base<FLow> RealLow;
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    const Int numRHS = B.Width();
+
+    // Entries outside of the demoted range cannot be represented
+    if( MaxNorm(A) > Real(limits::Max<RealLow>()) )
+        return false;
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    Permutation P;
+    try { LU( ALow, P ); }
+    catch( SingularMatrixException& ) { return false; }
+
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, F(0), Y ); };
+    // Normalize the (residual) vectors so that they remain representable
+    // in the demoted precision
+    auto applyAInv =
+      [&]( Matrix<F>& X )
+      {
+        const Real scale = MaxNorm( X );
+        if( scale == Real(0) )
+            return;
+        Scale( Real(1)/scale, X );
+        Matrix<FLow> XLow;
+        Copy( X, XLow );
+        lu::SolveAfter( NORMAL, ALow, P, XLow );
+        Copy( XLow, X );
+        Scale( scale, X );
+      };
+
+    // Refine each solution separately so that stagnation is detected per
+    // right-hand side
+    Matrix<F> X( B ), x;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        x = X( ALL, IR(j) );
+        const Int numIts =
+          RefinedSolve
+          ( applyA, applyAInv, x, ctrl.relTol, ctrl.maxRefineIts,
+            ctrl.progress );
+        ctrl.numRefineIts = Max( ctrl.numRefineIts, numIts );
+        auto xj = X( ALL, IR(j) );
+        xj = x;
+    }
+
+    // Test the normwise backward errors (NaN's fail the test)
+    Matrix<F> R( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real tol = ctrl.relTol*Sqrt(Real(n))*InfinityNorm(A);
+    for( Int j=0; j<numRHS; ++j )
+        if( !(MaxNorm(R(ALL,IR(j))) <= tol*MaxNorm(X(ALL,IR(j)))) )
+            return false;
+    B = X;
+    return true;
+}
+
+template<typename F>
+bool MixedPrecision
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& BPre,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+    typedef Base<FLow> RealLow;
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int numRHS = BPre.Width();
+
+    // Entries outside of the demoted range cannot be represented
+    if( MaxNorm(A) > Real(limits::Max<RealLow>()) )
+        return false;
+    DistMatrix<FLow> ALow(g);
+    Copy( A, ALow );
+    DistPermutation P(g);
+    try { LU( ALow, P ); }
+    catch( SingularMatrixException& ) { return false; }
+
+    auto applyA =
+      [&]( const DistMatrix<F>& X, DistMatrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, F(0), Y ); };
+    // Normalize the (residual) vectors so that they remain representable
+    // in the demoted precision
+    auto applyAInv =
+      [&]( DistMatrix<F>& X )
+      {
+        const Real scale = MaxNorm( X );
+        if( scale == Real(0) )
+            return;
+        Scale( Real(1)/scale, X );
+        DistMatrix<FLow> XLow(g);
+        Copy( X, XLow );
+        lu::SolveAfter( NORMAL, ALow, P, XLow );
+        Copy( XLow, X );
+        Scale( scale, X );
+      };
+
+    // Refine each solution separately so that stagnation is detected per
+    // right-hand side
+    DistMatrix<F> X(g), x(g);
+    Copy( BPre, X );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        x = X( ALL, IR(j) );
+        const Int numIts =
+          RefinedSolve
+          ( applyA, applyAInv, x, ctrl.relTol, ctrl.maxRefineIts,
+            ctrl.progress );
+        ctrl.numRefineIts = Max( ctrl.numRefineIts, numIts );
+        auto xj = X( ALL, IR(j) );
+        xj = x;
+    }
+
+    // Test the normwise backward errors (NaN's fail the test)
+    DistMatrix<F> R(g);
+    Copy( BPre, R );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real tol = ctrl.relTol*Sqrt(Real(n))*InfinityNorm(A);
+    for( Int j=0; j<numRHS; ++j )
+        if( !(MaxNorm(R(ALL,IR(j))) <= tol*MaxNorm(X(ALL,IR(j)))) )
+            return false;
+    Copy( X, BPre );
+    return true;
+}
+
 } // namespace lin_solve
 
 template<typename F> 
-void LinearSolve( const Matrix<F>& A, Matrix<F>& B )
+void LinearSolve
+( const Matrix<F>& A, Matrix<F>& B, const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    ctrl.fellBack = false;
+    ctrl.numRefineIts = 0;
+    if( ctrl.mixedPrecision )
+    {
+        ctrl.fellBack = true;
+        if( !IsSame<F,Demote<F>>::value &&
+            lin_solve::MixedPrecision( A, B, ctrl ) )
+        {
+            ctrl.fellBack = false;
+            return;
+        }
+        if( ctrl.progress )
+            Output("Falling back to a solve in the working precision");
+    }
     Matrix<F> ACopy( A );
     lin_solve::Overwrite( ACopy, B );
 }
@@ -215,9 +376,24 @@ void LinearSolve( const Matrix<F>& A, Matrix<F>& B )
 template<typename F> 
 void LinearSolve
 ( const ElementalMatrix<F>& A,
-        ElementalMatrix<F>& B )
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    ctrl.fellBack = false;
+    ctrl.numRefineIts = 0;
+    if( ctrl.mixedPrecision )
+    {
+        ctrl.fellBack = true;
+        if( !IsSame<F,Demote<F>>::value &&
+            lin_solve::MixedPrecision( A, B, ctrl ) )
+        {
+            ctrl.fellBack = false;
+            return;
+        }
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            Output("Falling back to a solve in the working precision");
+    }
     DistMatrix<F> ACopy( A );
     lin_solve::Overwrite( ACopy, B );
 }
@@ -302,10 +478,13 @@ void LinearSolve
   template void lin_solve::Overwrite( Matrix<F>& A, Matrix<F>& B ); \
   template void lin_solve::Overwrite \
   ( ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
-  template void LinearSolve( const Matrix<F>& A, Matrix<F>& B ); \
+  template void LinearSolve \
+  ( const Matrix<F>& A, Matrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const ElementalMatrix<F>& A, \
-          ElementalMatrix<F>& B ); \
+          ElementalMatrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const DistMatrix<F,MC,MR,BLOCK>& A, \
           DistMatrix<F,MC,MR,BLOCK>& B ); \
@@ -14,6 +14,7 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Adaptive.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -763,45 +764,25 @@ DistMatrix<Int,VR,STAR> Helper
     }
 }
 
-} // namespace pspec
-
-template<typename F>
-Matrix<Int> SpectralCloud
-( const Matrix<F>& A,
-  const Matrix<Complex<Base<F>>>& shifts,
-        Matrix<Base<F>>& invNorms,
-        PseudospecCtrl<Base<F>> psCtrl )
-{
-    DEBUG_CSE
-    return pspec::Helper( A, shifts, invNorms, psCtrl );
-}
-
-template<typename F>
-DistMatrix<Int,VR,STAR> SpectralCloud
-( const ElementalMatrix<F>& A, 
-  const ElementalMatrix<Complex<Base<F>>>& shifts,
-        ElementalMatrix<Base<F>>& invNorms,
-        PseudospecCtrl<Base<F>> psCtrl )
-{
-    DEBUG_CSE
-    return pspec::Helper( A, shifts, invNorms, psCtrl );
-}
-
 // Treat each pixel as being located a cell center and tesselate a box with
-// said square cells
-template<typename F>
-Matrix<Int> TriangularSpectralWindow
-( const Matrix<F>& U,
-        Matrix<Base<F>>& invNormMap, 
-  Complex<Base<F>> center,
-  Base<F> realWidth,
-  Base<F> imagWidth,
+// said square cells. Every pixel is evaluated unless adaptive refinement was
+// requested, in which case 'eigs' is called for the known eigenvalues.
+template<typename Real,typename EigFunctor>
+Matrix<Int> Window
+( function<Matrix<Int>
+           (const Matrix<Complex<Real>>&,
+                  Matrix<Real>&,
+            const PseudospecCtrl<Real>&)> cloud,
+  EigFunctor eigs,
+        Matrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
   Int realSize,
   Int imagSize,
-  PseudospecCtrl<Base<F>> psCtrl )
+  PseudospecCtrl<Real> psCtrl )
 {
     DEBUG_CSE
-    typedef Base<F> Real;
     typedef Complex<Real> C;
 
     psCtrl.snapCtrl.realSize = realSize;
@@ -811,6 +792,12 @@ Matrix<Int> TriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    // Adaptively refine about the contours and known eigenvalues
+    if( psCtrl.adaptive )
+        return AdaptiveWindow<Real>
+        ( cloud, eigs(), invNormMap,
+          center, realWidth, imagWidth, realSize, imagSize, psCtrl );
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -824,29 +811,32 @@ Matrix<Int> TriangularSpectralWindow
 
     // Form the vector of invNorms
     Matrix<Real> invNorms;
-    auto itCounts = TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+    auto itCounts = cloud( shifts, invNorms, psCtrl );
 
     // Rearrange the vectors into grids
     Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
     return itCountMap;
 }
 
-template<typename F>
-Matrix<Int> TriangularSpectralWindow
-( const Matrix<F>& U,
-  const Matrix<F>& Q,
-        Matrix<Base<F>>& invNormMap, 
-  Complex<Base<F>> center,
-  Base<F> realWidth,
-  Base<F> imagWidth,
+template<typename Real,typename EigFunctor>
+DistMatrix<Int> Window
+( function<DistMatrix<Int,VR,STAR>
+           (const DistMatrix<Complex<Real>,VR,STAR>&,
+                  DistMatrix<Real,VR,STAR>&,
+            const PseudospecCtrl<Real>&)> cloud,
+  const Grid& g,
+  EigFunctor eigs,
+        ElementalMatrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
   Int realSize,
   Int imagSize,
-  PseudospecCtrl<Base<F>> psCtrl )
+  PseudospecCtrl<Real> psCtrl )
 {
     DEBUG_CSE
-    typedef Base<F> Real;
     typedef Complex<Real> C;
 
     psCtrl.snapCtrl.realSize = realSize;
@@ -856,28 +846,112 @@ Matrix<Int> TriangularSpectralWindow
     psCtrl.realWidth = realWidth;
     psCtrl.imagWidth = imagWidth;
 
+    // Adaptively refine about the contours and known eigenvalues
+    if( psCtrl.adaptive )
+        return AdaptiveWindow<Real>
+        ( cloud, g, eigs(), invNormMap,
+          center, realWidth, imagWidth, realSize, imagSize, psCtrl );
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
+    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
+    const Int numLocShifts = shifts.LocalHeight();
+    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
     {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+        const Int i = shifts.GlobalRow(iLoc);
+        const Int x = i / imagSize;
+        const Int y = i % imagSize;
+        shifts.SetLocal
+        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
     }
 
     // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+    DistMatrix<Real,VR,STAR> invNorms(g);
+    auto itCounts = cloud( shifts, invNorms, psCtrl );
 
     // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    DistMatrix<Int> itCountMap(g); 
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
     return itCountMap;
 }
 
+} // namespace pspec
+
+template<typename F>
+Matrix<Int> SpectralCloud
+( const Matrix<F>& A,
+  const Matrix<Complex<Base<F>>>& shifts,
+        Matrix<Base<F>>& invNorms,
+        PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_CSE
+    return pspec::Helper( A, shifts, invNorms, psCtrl );
+}
+
+template<typename F>
+DistMatrix<Int,VR,STAR> SpectralCloud
+( const ElementalMatrix<F>& A, 
+  const ElementalMatrix<Complex<Base<F>>>& shifts,
+        ElementalMatrix<Base<F>>& invNorms,
+        PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_CSE
+    return pspec::Helper( A, shifts, invNorms, psCtrl );
+}
+
+template<typename F>
+Matrix<Int> TriangularSpectralWindow
+( const Matrix<F>& U,
+        Matrix<Base<F>>& invNormMap, 
+  Complex<Base<F>> center,
+  Base<F> realWidth,
+  Base<F> imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return pspec::TriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
+}
+
+template<typename F>
+Matrix<Int> TriangularSpectralWindow
+( const Matrix<F>& U,
+  const Matrix<F>& Q,
+        Matrix<Base<F>>& invNormMap, 
+  Complex<Base<F>> center,
+  Base<F> realWidth,
+  Base<F> imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return pspec::TriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
+}
+
 template<typename Real>
 Matrix<Int> QuasiTriangularSpectralWindow
 ( const Matrix<Real>& U,
@@ -891,34 +965,15 @@ Matrix<Int> QuasiTriangularSpectralWindow
 {
     DEBUG_CSE
     typedef Complex<Real> C;
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return schur::QuasiTriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename Real>
@@ -935,35 +990,15 @@ Matrix<Int> QuasiTriangularSpectralWindow
 {
     DEBUG_CSE
     typedef Complex<Real> C;
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = 
-        QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return schur::QuasiTriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -980,34 +1015,15 @@ Matrix<Int> HessenbergSpectralWindow
     DEBUG_CSE
     typedef Base<F> Real;
     typedef Complex<Real> C;
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = HessenbergSpectralCloud( H, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return Matrix<C>(); };
+    return pspec::Window<Real>
+    ( cloud, eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -1025,34 +1041,15 @@ Matrix<Int> HessenbergSpectralWindow
     DEBUG_CSE
     typedef Base<F> Real;
     typedef Complex<Real> C;
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
-    {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = HessenbergSpectralCloud( H, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const Matrix<C>& shifts,
+                 Matrix<Real>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return Matrix<C>(); };
+    return pspec::Window<Real>
+    ( cloud, eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -1069,38 +1066,15 @@ DistMatrix<Int> TriangularSpectralWindow
     DEBUG_CSE
     typedef Base<F> Real;
     typedef Complex<Real> C;
-    const Grid& g = U.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return pspec::TriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, U.Grid(), eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -1118,38 +1092,15 @@ DistMatrix<Int> TriangularSpectralWindow
     DEBUG_CSE
     typedef Base<F> Real;
     typedef Complex<Real> C;
-    const Grid& g = U.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return TriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return pspec::TriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, U.Grid(), eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename Real>
@@ -1165,38 +1116,15 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
 {
     DEBUG_CSE
     typedef Complex<Real> C;
-    const Grid& g = U.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = QuasiTriangularSpectralCloud( U, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return schur::QuasiTriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, U.Grid(), eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename Real>
@@ -1213,39 +1141,15 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
 {
     DEBUG_CSE
     typedef Complex<Real> C;
-    const Grid& g = U.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = 
-        QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return QuasiTriangularSpectralCloud( U, Q, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return schur::QuasiTriangEig( U ); };
+    return pspec::Window<Real>
+    ( cloud, U.Grid(), eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -1262,38 +1166,15 @@ DistMatrix<Int> HessenbergSpectralWindow
     DEBUG_CSE
     typedef Base<F> Real;
     typedef Complex<Real> C;
-    const Grid& g = H.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = HessenbergSpectralCloud( H, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return DistMatrix<C,STAR,STAR>( H.Grid() ); };
+    return pspec::Window<Real>
+    ( cloud, H.Grid(), eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -1311,38 +1192,15 @@ DistMatrix<Int> HessenbergSpectralWindow
     DEBUG_CSE
     typedef Base<F> Real;
     typedef Complex<Real> C;
-    const Grid& g = H.Grid();
-
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
-
-    psCtrl.center = center;
-    psCtrl.realWidth = realWidth;
-    psCtrl.imagWidth = imagWidth;
-
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
-    {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
-    }
-
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = HessenbergSpectralCloud( H, Q, shifts, invNorms, psCtrl );
-
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    auto cloud =
+      [&]( const DistMatrix<C,VR,STAR>& shifts,
+                 DistMatrix<Real,VR,STAR>& invNorms,
+           const PseudospecCtrl<Real>& ctrl )
+      { return HessenbergSpectralCloud( H, Q, shifts, invNorms, ctrl ); };
+    auto eigs = [&]() { return DistMatrix<C,STAR,STAR>( H.Grid() ); };
+    return pspec::Window<Real>
+    ( cloud, H.Grid(), eigs, invNormMap,
+      center, realWidth, imagWidth, realSize, imagSize, psCtrl );
 }
 
 template<typename F>
@@ -0,0 +1,429 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+#define EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+
+namespace El {
+namespace pspec {
+
+// A cell of the quadtree, [x0,x1] x [y0,y1], in terms of pixel indices
+struct AdaptiveCell
+{
+    Int x0, x1, y0, y1;
+};
+
+template<typename Real>
+inline bool Straddles
+( Real minEst, Real maxEst, const vector<Real>& levels )
+{
+    if( levels.size() == 0 )
+        return Floor(Log10(minEst)) != Floor(Log10(maxEst));
+    for( const Real level : levels )
+        if( minEst < level && level <= maxEst )
+            return true;
+    return false;
+}
+
+// Every process redundantly runs the following, where 'evaluate' computes
+// the estimates and iteration counts for a list of pixels (with pixel (x,y)
+// having index x*imagSize+y, following ReshapeIntoGrid) and 'eigs' lists the
+// (fractional) pixel coordinates of any known eigenvalues
+template<typename Real>
+void AdaptiveRefinement
+( Int realSize,
+  Int imagSize,
+  const vector<pair<Real,Real>>& eigs,
+  function<void(const vector<Int>&,vector<Real>&,vector<Int>&)> evaluate,
+  vector<Real>& invNorms,
+  vector<Int>& itCounts,
+  const PseudospecCtrl<Real>& psCtrl,
+  bool progress )
+{
+    DEBUG_CSE
+    const Int numPixels = realSize*imagSize;
+    invNorms.assign( numPixels, Real(0) );
+    itCounts.assign( numPixels, 0 );
+    vector<byte> evaluated( numPixels, false );
+
+    // Express the contours in terms of the norm of the resolvent
+    vector<Real> levels;
+    for( const Real eps : psCtrl.epsilons )
+        levels.push_back( Real(1)/eps );
+
+    Int spacing = 1;
+    while( 2*spacing <= psCtrl.coarseSpacing )
+        spacing *= 2;
+    auto lattice = [&]( Int size )
+      {
+        vector<Int> points;
+        for( Int i=0; i<size; i+=spacing )
+            points.push_back( i );
+        if( points.back() != size-1 )
+            points.push_back( size-1 );
+        return points;
+      };
+    const vector<Int> xs = lattice( realSize );
+    const vector<Int> ys = lattice( imagSize );
+
+    vector<Int> pending;
+    auto request = [&]( Int x, Int y )
+      {
+        const Int j = x*imagSize + y;
+        if( !evaluated[j] )
+        {
+            evaluated[j] = true;
+            pending.push_back( j );
+        }
+      };
+
+    // Form the coarse cells
+    vector<AdaptiveCell> cells, leaves;
+    const Int numXCells = Max( Int(xs.size())-1, Int(1) );
+    const Int numYCells = Max( Int(ys.size())-1, Int(1) );
+    for( Int a=0; a<numXCells; ++a )
+    {
+        for( Int b=0; b<numYCells; ++b )
+        {
+            AdaptiveCell cell;
+            cell.x0 = xs[a];
+            cell.x1 = xs[Min(a+1,Int(xs.size())-1)];
+            cell.y0 = ys[b];
+            cell.y1 = ys[Min(b+1,Int(ys.size())-1)];
+            cells.push_back( cell );
+        }
+    }
+    for( const Int x : xs )
+        for( const Int y : ys )
+            request( x, y );
+
+    Int level=0, numEvaluated=0;
+    vector<Real> ests;
+    vector<Int> its;
+    while( true )
+    {
+        // Evaluate the newly requested pixels as a single cloud
+        if( pending.size() != 0 )
+        {
+            evaluate( pending, ests, its );
+            for( size_t k=0; k<pending.size(); ++k )
+            {
+                invNorms[pending[k]] = ests[k];
+                itCounts[pending[k]] = its[k];
+            }
+            numEvaluated += pending.size();
+            if( progress )
+                cout << "Adaptive level " << level << ": evaluated "
+                     << pending.size() << " shifts (" << numEvaluated
+                     << " of " << numPixels << " total)" << endl;
+            pending.clear();
+        }
+        if( cells.size() == 0 )
+            break;
+
+        // Bisect each cell which straddles a contour or contains an
+        // eigenvalue
+        vector<AdaptiveCell> children;
+        for( const auto& cell : cells )
+        {
+            const bool splitX = ( cell.x1-cell.x0 > 1 );
+            const bool splitY = ( cell.y1-cell.y0 > 1 );
+            if( !splitX && !splitY )
+            {
+                leaves.push_back( cell );
+                continue;
+            }
+            const Real e00 = invNorms[cell.x0*imagSize+cell.y0];
+            const Real e01 = invNorms[cell.x0*imagSize+cell.y1];
+            const Real e10 = invNorms[cell.x1*imagSize+cell.y0];
+            const Real e11 = invNorms[cell.x1*imagSize+cell.y1];
+            const Real minEst = Min(Min(e00,e01),Min(e10,e11));
+            const Real maxEst = Max(Max(e00,e01),Max(e10,e11));
+            bool refine = Straddles( minEst, maxEst, levels );
+            for( const auto& eig : eigs )
+                if( eig.first >= cell.x0 && eig.first <= cell.x1 &&
+                    eig.second >= cell.y0 && eig.second <= cell.y1 )
+                    refine = true;
+            if( !refine )
+            {
+                leaves.push_back( cell );
+                continue;
+            }
+
+            vector<Int> cellXs, cellYs;
+            cellXs.push_back( cell.x0 );
+            if( splitX )
+                cellXs.push_back( (cell.x0+cell.x1)/2 );
+            cellXs.push_back( cell.x1 );
+            cellYs.push_back( cell.y0 );
+            if( splitY )
+                cellYs.push_back( (cell.y0+cell.y1)/2 );
+            cellYs.push_back( cell.y1 );
+            for( const Int x : cellXs )
+                for( const Int y : cellYs )
+                    request( x, y );
+            for( size_t a=0; a+1<cellXs.size(); ++a )
+            {
+                for( size_t b=0; b+1<cellYs.size(); ++b )
+                {
+                    AdaptiveCell child;
+                    child.x0 = cellXs[a];
+                    child.x1 = cellXs[a+1];
+                    child.y0 = cellYs[b];
+                    child.y1 = cellYs[b+1];
+                    children.push_back( child );
+                }
+            }
+        }
+        cells.swap( children );
+        ++level;
+    }
+
+    // Bilinearly interpolate the logarithms of the estimates over the
+    // unevaluated pixels of each leaf. Since the leaves are ordered from
+    // coarse to fine, the finer leaves take precedence along shared edges.
+    for( const auto& cell : leaves )
+    {
+        const Real l00 = Log(invNorms[cell.x0*imagSize+cell.y0]);
+        const Real l01 = Log(invNorms[cell.x0*imagSize+cell.y1]);
+        const Real l10 = Log(invNorms[cell.x1*imagSize+cell.y0]);
+        const Real l11 = Log(invNorms[cell.x1*imagSize+cell.y1]);
+        for( Int x=cell.x0; x<=cell.x1; ++x )
+        {
+            const Real s = ( cell.x1 == cell.x0 ? Real(0) :
+                             Real(x-cell.x0)/Real(cell.x1-cell.x0) );
+            for( Int y=cell.y0; y<=cell.y1; ++y )
+            {
+                const Int j = x*imagSize + y;
+                if( evaluated[j] )
+                    continue;
+                const Real t = ( cell.y1 == cell.y0 ? Real(0) :
+                                 Real(y-cell.y0)/Real(cell.y1-cell.y0) );
+                invNorms[j] =
+                  Exp( (1-s)*((1-t)*l00 + t*l01) + s*((1-t)*l10 + t*l11) );
+                itCounts[j] = 0;
+            }
+        }
+    }
+}
+
+// Convert eigenvalues into fractional pixel coordinates
+template<typename Real>
+vector<pair<Real,Real>> EigPixels
+( const Matrix<Complex<Real>>& w,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize )
+{
+    DEBUG_CSE
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const Complex<Real> corner =
+      center + Complex<Real>(-realWidth/2,imagWidth/2);
+    vector<pair<Real,Real>> eigs;
+    for( Int i=0; i<w.Height(); ++i )
+    {
+        const Real x = (RealPart(w(i))-RealPart(corner))/realStep - Real(0.5);
+        const Real y = (ImagPart(corner)-ImagPart(w(i)))/imagStep - Real(0.5);
+        eigs.push_back( pair<Real,Real>(x,y) );
+    }
+    return eigs;
+}
+
+// The eigenvalues of a triangular matrix lie along its diagonal
+template<typename F>
+Matrix<Complex<Base<F>>> TriangEig( const Matrix<F>& U )
+{
+    DEBUG_CSE
+    const Int n = U.Height();
+    Matrix<Complex<Base<F>>> w( n, 1 );
+    for( Int i=0; i<n; ++i )
+        w(i) = U(i,i);
+    return w;
+}
+
+template<typename F>
+DistMatrix<Complex<Base<F>>,STAR,STAR>
+TriangEig( const ElementalMatrix<F>& U )
+{
+    DEBUG_CSE
+    DistMatrix<F,STAR,STAR> d( U.Grid() );
+    GetDiagonal( U, d );
+    const Int n = d.Height();
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w( n, 1, U.Grid() );
+    for( Int i=0; i<n; ++i )
+        w.SetLocal( i, 0, d.GetLocal(i,0) );
+    return w;
+}
+
+template<typename Real>
+Matrix<Int> AdaptiveWindow
+( function<Matrix<Int>
+           (const Matrix<Complex<Real>>&,
+                  Matrix<Real>&,
+            const PseudospecCtrl<Real>&)> cloud,
+  const Matrix<Complex<Real>>& w,
+        Matrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const C corner = center + C(-realWidth/2,imagWidth/2);
+
+    // The intermediate clouds do not correspond to the full grid
+    SnapshotCtrl snapCtrl = psCtrl.snapCtrl;
+    psCtrl.snapCtrl.realSize = 0;
+    psCtrl.snapCtrl.imagSize = 0;
+
+    auto evaluate =
+      [&]( const vector<Int>& pixels, vector<Real>& ests, vector<Int>& its )
+      {
+        const Int numShifts = pixels.size();
+        Matrix<C> shifts( numShifts, 1 );
+        for( Int k=0; k<numShifts; ++k )
+        {
+            const Int x = pixels[k] / imagSize;
+            const Int y = pixels[k] % imagSize;
+            shifts(k) = corner+C((x+0.5)*realStep,-(y+0.5)*imagStep);
+        }
+        Matrix<Real> invNorms;
+        auto itCounts = cloud( shifts, invNorms, psCtrl );
+        ests.resize( numShifts );
+        its.resize( numShifts );
+        for( Int k=0; k<numShifts; ++k )
+        {
+            ests[k] = invNorms(k);
+            its[k] = itCounts(k);
+        }
+      };
+
+    auto eigs =
+      EigPixels( w, center, realWidth, imagWidth, realSize, imagSize );
+    vector<Real> invNormsFull;
+    vector<Int> itCountsFull;
+    AdaptiveRefinement
+    ( realSize, imagSize, eigs,
+      function<void(const vector<Int>&,vector<Real>&,vector<Int>&)>(evaluate),
+      invNormsFull, itCountsFull, psCtrl, psCtrl.progress );
+
+    const Int numPixels = realSize*imagSize;
+    Matrix<Real> invNorms( numPixels, 1 );
+    Matrix<Int> itCounts( numPixels, 1 );
+    for( Int j=0; j<numPixels; ++j )
+    {
+        invNorms(j) = invNormsFull[j];
+        itCounts(j) = itCountsFull[j];
+    }
+    FinalSnapshot( invNorms, itCounts, snapCtrl );
+
+    Matrix<Int> itCountMap;
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+template<typename Real>
+DistMatrix<Int> AdaptiveWindow
+( function<DistMatrix<Int,VR,STAR>
+           (const DistMatrix<Complex<Real>,VR,STAR>&,
+                  DistMatrix<Real,VR,STAR>&,
+            const PseudospecCtrl<Real>&)> cloud,
+  const Grid& g,
+  const ElementalMatrix<Complex<Real>>& w,
+        ElementalMatrix<Real>& invNormMap,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  PseudospecCtrl<Real> psCtrl )
+{
+    DEBUG_CSE
+    typedef Complex<Real> C;
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const C corner = center + C(-realWidth/2,imagWidth/2);
+
+    // The intermediate clouds do not correspond to the full grid
+    SnapshotCtrl snapCtrl = psCtrl.snapCtrl;
+    psCtrl.snapCtrl.realSize = 0;
+    psCtrl.snapCtrl.imagSize = 0;
+
+    auto evaluate =
+      [&]( const vector<Int>& pixels, vector<Real>& ests, vector<Int>& its )
+      {
+        const Int numShifts = pixels.size();
+        DistMatrix<C,VR,STAR> shifts( numShifts, 1, g );
+        const Int numLocShifts = shifts.LocalHeight();
+        for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+        {
+            const Int k = shifts.GlobalRow(iLoc);
+            const Int x = pixels[k] / imagSize;
+            const Int y = pixels[k] % imagSize;
+            shifts.SetLocal
+            ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+        }
+        DistMatrix<Real,VR,STAR> invNorms(g);
+        auto itCounts = cloud( shifts, invNorms, psCtrl );
+
+        // Every process makes the same refinement decisions
+        DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNorms );
+        DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( itCounts );
+        ests.resize( numShifts );
+        its.resize( numShifts );
+        for( Int k=0; k<numShifts; ++k )
+        {
+            ests[k] = invNorms_STAR_STAR.GetLocal(k,0);
+            its[k] = itCounts_STAR_STAR.GetLocal(k,0);
+        }
+      };
+
+    DistMatrix<C,STAR,STAR> w_STAR_STAR( w );
+    auto eigs =
+      EigPixels
+      ( w_STAR_STAR.Matrix(), center, realWidth, imagWidth,
+        realSize, imagSize );
+    vector<Real> invNormsFull;
+    vector<Int> itCountsFull;
+    AdaptiveRefinement
+    ( realSize, imagSize, eigs,
+      function<void(const vector<Int>&,vector<Real>&,vector<Int>&)>(evaluate),
+      invNormsFull, itCountsFull, psCtrl,
+      psCtrl.progress && g.Rank() == 0 );
+
+    const Int numPixels = realSize*imagSize;
+    DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( numPixels, 1, g );
+    DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( numPixels, 1, g );
+    for( Int j=0; j<numPixels; ++j )
+    {
+        invNorms_STAR_STAR.SetLocal( j, 0, invNormsFull[j] );
+        itCounts_STAR_STAR.SetLocal( j, 0, itCountsFull[j] );
+    }
+    DistMatrix<Real,VR,STAR> invNorms( invNorms_STAR_STAR );
+    DistMatrix<Int,VR,STAR> itCounts( itCounts_STAR_STAR );
+    FinalSnapshot( invNorms, itCounts, snapCtrl );
+
+    DistMatrix<Int> itCountMap(g);
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
+    return itCountMap;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
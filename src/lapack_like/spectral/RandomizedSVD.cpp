@@ -0,0 +1,259 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace rand_svd {
+
+// Draw the random signs and column subset defining an n x l SRHT sketch,
+// Omega(i,j) = signs[i] H(i,cols[j]) sqrt(N/l), where H is the N x N
+// normalized Walsh-Hadamard matrix, so that H(i,k) = (-1)^{popcount(i & k)}
+// / sqrt(N)
+inline void SRHTParameters
+( Int n, Int l, vector<Int>& signs, vector<Int>& cols )
+{
+    DEBUG_CSE
+    Int N = 1;
+    while( N < n )
+        N *= 2;
+    signs.resize( n );
+    for( Int i=0; i<n; ++i )
+        signs[i] = ( BooleanCoinFlip() ? 1 : -1 );
+
+    // Choose l distinct columns (l <= n <= N)
+    std::set<Int> chosen;
+    while( Int(chosen.size()) < l )
+        chosen.insert( SampleUniform<Int>(0,N) );
+    cols.assign( chosen.begin(), chosen.end() );
+}
+
+inline Int HadamardSign( Int i, Int k )
+{
+    Int parity = 0;
+    for( Int bits=i&k; bits!=0; bits&=bits-1 )
+        parity ^= 1;
+    return ( parity ? -1 : 1 );
+}
+
+template<typename F>
+void Sketch( Int n, Int l, SketchType sketch, Matrix<F>& Omega )
+{
+    DEBUG_CSE
+    if( sketch == GAUSSIAN_SKETCH )
+    {
+        Gaussian( Omega, n, l );
+        return;
+    }
+    typedef Base<F> Real;
+    vector<Int> signs, cols;
+    SRHTParameters( n, l, signs, cols );
+    const Real scale = Real(1) / Sqrt(Real(l));
+    Omega.Resize( n, l );
+    auto srht =
+      [&]( Int i, Int j )
+      { return F(scale*signs[i]*HadamardSign(i,cols[j])); };
+    IndexDependentFill( Omega, function<F(Int,Int)>(srht) );
+}
+
+template<typename F>
+void Sketch( Int n, Int l, SketchType sketch, DistMatrix<F>& Omega )
+{
+    DEBUG_CSE
+    if( sketch == GAUSSIAN_SKETCH )
+    {
+        Gaussian( Omega, n, l );
+        return;
+    }
+    // Every process must agree upon the signs and columns
+    typedef Base<F> Real;
+    mpi::Comm comm = Omega.Grid().Comm();
+    vector<Int> signs( n ), cols( l );
+    if( mpi::Rank(comm) == 0 )
+        SRHTParameters( n, l, signs, cols );
+    mpi::Broadcast( signs.data(), n, 0, comm );
+    mpi::Broadcast( cols.data(), l, 0, comm );
+    const Real scale = Real(1) / Sqrt(Real(l));
+    Omega.Resize( n, l );
+    auto srht =
+      [&]( Int i, Int j )
+      { return F(scale*signs[i]*HadamardSign(i,cols[j])); };
+    IndexDependentFill( Omega, function<F(Int,Int)>(srht) );
+}
+
+} // namespace rand_svd
+
+template<typename F>
+void RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.rank < 0 || ctrl.oversample < 0 || ctrl.numPowerIts < 0 )
+        LogicError("Invalid randomized SVD parameters");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        U.Resize( m, 0 );
+        s.Resize( 0, 1 );
+        V.Resize( n, 0 );
+        return;
+    }
+
+    Matrix<F> UInit;
+    if( ctrl.warmStart && U.Height() == m && U.Width() > 0 )
+        UInit = U;
+
+    Int rank = Min( Max(ctrl.rank,Int(1)), minDim );
+    Matrix<F> Omega, Q, Z, B, UB, UFull, VFull;
+    Matrix<Real> sFull;
+    while( true )
+    {
+        const Int sketchSize = Min( rank+ctrl.oversample, minDim );
+        rand_svd::Sketch( n, sketchSize, ctrl.sketch, Omega );
+        const Int numWarm = Min( UInit.Width(), sketchSize );
+        if( numWarm > 0 )
+        {
+            auto OmegaWarm = Omega( ALL, IR(0,numWarm) );
+            auto UWarm = UInit( ALL, IR(0,numWarm) );
+            Gemm( ADJOINT, NORMAL, F(1), A, UWarm, F(0), OmegaWarm );
+        }
+
+        // Form an orthonormal basis for the range of A Omega
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        qr::ExplicitUnitary( Q );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+            qr::ExplicitUnitary( Q );
+        }
+
+        // Q^H A = UB diag(s) V^H
+        Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+        SVD( B, UB, sFull, VFull );
+        Gemm( NORMAL, NORMAL, F(1), Q, UB, UFull );
+
+        if( !ctrl.adaptive || rank >= minDim )
+            break;
+        const Real thresh =
+          ( ctrl.relative ? ctrl.tol*sFull.Get(0,0) : ctrl.tol );
+        if( sFull.Get(rank-1,0) <= thresh )
+            break;
+        // Grow the rank while warm-starting from the current subspace
+        rank = Min( 2*rank, minDim );
+        UInit = UFull;
+    }
+    U = UFull( ALL, IR(0,rank) );
+    s = sFull( IR(0,rank), ALL );
+    V = VFull( ALL, IR(0,rank) );
+}
+
+template<typename F>
+void RandomizedSVD
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& UPre,
+        ElementalMatrix<Base<F>>& s,
+        ElementalMatrix<F>& VPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.rank < 0 || ctrl.oversample < 0 || ctrl.numPowerIts < 0 )
+        LogicError("Invalid randomized SVD parameters");
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        UPre.Resize( m, 0 );
+        s.Resize( 0, 1 );
+        VPre.Resize( n, 0 );
+        return;
+    }
+
+    DistMatrix<F> UInit(g);
+    if( ctrl.warmStart && UPre.Height() == m && UPre.Width() > 0 )
+        Copy( UPre, UInit );
+
+    Int rank = Min( Max(ctrl.rank,Int(1)), minDim );
+    DistMatrix<F> Omega(g), Q(g), Z(g), B(g), UB(g), UFull(g), VFull(g);
+    DistMatrix<Real,STAR,STAR> sFull(g);
+    while( true )
+    {
+        const Int sketchSize = Min( rank+ctrl.oversample, minDim );
+        rand_svd::Sketch( n, sketchSize, ctrl.sketch, Omega );
+        const Int numWarm = Min( UInit.Width(), sketchSize );
+        if( numWarm > 0 )
+        {
+            auto OmegaWarm = Omega( ALL, IR(0,numWarm) );
+            auto UWarm = UInit( ALL, IR(0,numWarm) );
+            Gemm( ADJOINT, NORMAL, F(1), A, UWarm, F(0), OmegaWarm );
+        }
+
+        // Form an orthonormal basis for the range of A Omega
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+        qr::ExplicitUnitary( Q );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+            qr::ExplicitUnitary( Z );
+            Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+            qr::ExplicitUnitary( Q );
+        }
+
+        // Q^H A = UB diag(s) V^H
+        Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+        SVD( B, UB, sFull, VFull );
+        Gemm( NORMAL, NORMAL, F(1), Q, UB, UFull );
+
+        if( !ctrl.adaptive || rank >= minDim )
+            break;
+        const Real thresh =
+          ( ctrl.relative ? ctrl.tol*sFull.GetLocal(0,0) : ctrl.tol );
+        if( sFull.GetLocal(rank-1,0) <= thresh )
+            break;
+        // Grow the rank while warm-starting from the current subspace
+        rank = Min( 2*rank, minDim );
+        UInit = UFull;
+    }
+    Copy( UFull( ALL, IR(0,rank) ), UPre );
+    Copy( sFull( IR(0,rank), ALL ), s );
+    Copy( VFull( ALL, IR(0,rank) ), VPre );
+}
+
+#define PROTO(F) \
+  template void RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template void RandomizedSVD \
+  ( const ElementalMatrix<F>& A, \
+          ElementalMatrix<F>& U, \
+          ElementalMatrix<Base<F>>& s, \
+          ElementalMatrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
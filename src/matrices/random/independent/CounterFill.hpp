@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_RANDOM_COUNTERFILL_HPP
+#define EL_MATRICES_RANDOM_COUNTERFILL_HPP
+
+namespace El {
+namespace counter_random {
+
+// Avoid spawning threads for small local matrices
+const Int minEntriesPerThread = 4096;
+
+// Overwrite entry (iLoc,jLoc) of the local matrix ALoc with
+// sample(rowInds[iLoc],colInds[jLoc]). Since each sample only depends upon
+// its global indices, the entries can be filled in any order, and they are
+// split evenly between OpenMP threads in hybrid builds.
+template<typename T,class SampleType>
+void Fill
+(       Matrix<T>& ALoc,
+  const vector<Int>& rowInds,
+  const vector<Int>& colInds,
+  const SampleType& sample )
+{
+    DEBUG_CSE
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+    const Int numEntries = localHeight*localWidth;
+    T* ABuf = ALoc.Buffer();
+    const Int ALDim = ALoc.LDim();
+#ifdef EL_HYBRID
+    const bool threaded = !omp_in_parallel() &&
+      numEntries >= 2*minEntriesPerThread && omp_get_max_threads() > 1;
+    #pragma omp parallel for schedule(static) if(threaded)
+#endif
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int iLoc = k % localHeight;
+        const Int jLoc = k / localHeight;
+        ABuf[iLoc+jLoc*ALDim] = sample( rowInds[iLoc], colInds[jLoc] );
+    }
+}
+
+template<typename T,class SampleType>
+void Fill( Matrix<T>& A, const SampleType& sample )
+{
+    DEBUG_CSE
+    vector<Int> rowInds( A.Height() ), colInds( A.Width() );
+    for( Int i=0; i<A.Height(); ++i )
+        rowInds[i] = i;
+    for( Int j=0; j<A.Width(); ++j )
+        colInds[j] = j;
+    Fill( A, rowInds, colInds, sample );
+}
+
+template<typename T,class SampleType>
+void Fill( AbstractDistMatrix<T>& A, const SampleType& sample )
+{
+    DEBUG_CSE
+    vector<Int> rowInds( A.LocalHeight() ), colInds( A.LocalWidth() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        rowInds[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        colInds[jLoc] = A.GlobalCol(jLoc);
+    Fill( A.Matrix(), rowInds, colInds, sample );
+}
+
+template<typename T,class SampleType>
+void Fill( DistMultiVec<T>& X, const SampleType& sample )
+{
+    DEBUG_CSE
+    vector<Int> rowInds( X.LocalHeight() ), colInds( X.Width() );
+    for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+        rowInds[iLoc] = X.GlobalRow(iLoc);
+    for( Int j=0; j<X.Width(); ++j )
+        colInds[j] = j;
+    Fill( X.Matrix(), rowInds, colInds, sample );
+}
+
+} // namespace counter_random
+} // namespace El
+
+#endif // ifndef EL_MATRICES_RANDOM_COUNTERFILL_HPP
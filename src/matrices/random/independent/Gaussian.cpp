@@ -9,35 +9,96 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./CounterFill.hpp"
 
 namespace El {
 
 // Draw each entry from a normal PDF
-template<typename F>
-void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
+//
+// As for Uniform, the types natively supported by the STL use a
+// counter-based generator so that distributed matrices are independent of
+// their distribution.
+
+namespace gaussian {
+
+template<typename F,typename=EnableIf<IsStdScalar<F>>>
+void Fill( Matrix<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_CSE
+    const std::uint64_t key = LocalCounterKey();
+    counter_random::Fill
+    ( A, [&]( Int i, Int j )
+         { return CounterSampleNormal( key, i, j, mean, stddev ); } );
+}
+
+template<typename F,typename=DisableIf<IsStdScalar<F>>,typename=void>
+void Fill( Matrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
 
-template<typename F>
-void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+template<typename F,typename=EnableIf<IsStdScalar<F>>>
+void Fill( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_CSE
+    const std::uint64_t key = NextCounterKey( A.Grid().ViewingComm() );
+    counter_random::Fill
+    ( A, [&]( Int i, Int j )
+         { return CounterSampleNormal( key, i, j, mean, stddev ); } );
+}
+
+template<typename F,typename=DisableIf<IsStdScalar<F>>,typename=void>
+void Fill( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
     if( A.RedundantRank() == 0 )
-        MakeGaussian( A.Matrix(), mean, stddev );
+        Fill( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
-template<typename F>
-void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
+template<typename F,typename=EnableIf<IsStdScalar<F>>>
+void Fill( DistMultiVec<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_CSE
+    const std::uint64_t key = NextCounterKey( A.Comm() );
+    counter_random::Fill
+    ( A, [&]( Int i, Int j )
+         { return CounterSampleNormal( key, i, j, mean, stddev ); } );
+}
+
+template<typename F,typename=DisableIf<IsStdScalar<F>>,typename=void>
+void Fill( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_CSE
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
 
+} // namespace gaussian
+
+template<typename F>
+void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_CSE
+    gaussian::Fill( A, mean, stddev );
+}
+
+template<typename F>
+void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_CSE
+    gaussian::Fill( A, mean, stddev );
+}
+
+template<typename F>
+void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_CSE
+    gaussian::Fill( A, mean, stddev );
+}
+
 template<typename F>
 void Gaussian( Matrix<F>& A, Int m, Int n, F mean, Base<F> stddev )
 {
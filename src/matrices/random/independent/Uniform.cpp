@@ -9,19 +9,86 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
+#include "./CounterFill.hpp"
 
 namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
+//
+// For the types natively supported by the STL, the samples are drawn from a
+// counter-based generator keyed by the global indices of each entry so that
+// distributed matrices are independent of their distribution and need not
+// be broadcast to redundant copies.
 
-template<typename T>
-void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
+namespace uniform {
+
+template<typename T,typename=EnableIf<IsStdScalar<T>>>
+void Fill( Matrix<T>& A, T center, Base<T> radius )
+{
+    DEBUG_CSE
+    const std::uint64_t key = LocalCounterKey();
+    counter_random::Fill
+    ( A, [&]( Int i, Int j )
+         { return CounterSampleBall( key, i, j, center, radius ); } );
+}
+
+template<typename T,typename=DisableIf<IsStdScalar<T>>,typename=void>
+void Fill( Matrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
 
+template<typename T,typename=EnableIf<IsStdScalar<T>>>
+void Fill( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    DEBUG_CSE
+    const std::uint64_t key = NextCounterKey( A.Grid().ViewingComm() );
+    counter_random::Fill
+    ( A, [&]( Int i, Int j )
+         { return CounterSampleBall( key, i, j, center, radius ); } );
+}
+
+template<typename T,typename=DisableIf<IsStdScalar<T>>,typename=void>
+void Fill( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    DEBUG_CSE
+    if( A.RedundantRank() == 0 )
+        Fill( A.Matrix(), center, radius );
+    Broadcast( A, A.RedundantComm(), 0 );
+}
+
+template<typename T,typename=EnableIf<IsStdScalar<T>>>
+void Fill( DistMultiVec<T>& X, T center, Base<T> radius )
+{
+    DEBUG_CSE
+    const std::uint64_t key = NextCounterKey( X.Comm() );
+    counter_random::Fill
+    ( X, [&]( Int i, Int j )
+         { return CounterSampleBall( key, i, j, center, radius ); } );
+}
+
+template<typename T,typename=DisableIf<IsStdScalar<T>>,typename=void>
+void Fill( DistMultiVec<T>& X, T center, Base<T> radius )
+{
+    DEBUG_CSE
+    const int localHeight = X.LocalHeight();
+    const int width = X.Width();
+    for( int j=0; j<width; ++j )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            X.SetLocal( iLocal, j, SampleBall(center,radius) );
+}
+
+} // namespace uniform
+
+template<typename T>
+void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
+{
+    DEBUG_CSE
+    uniform::Fill( A, center, radius );
+}
+
 template<typename T>
 void Uniform( Matrix<T>& A, Int m, Int n, T center, Base<T> radius )
 {
@@ -34,9 +101,7 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeUniform( A.Matrix(), center, radius );
-    Broadcast( A, A.RedundantComm(), 0 );
+    uniform::Fill( A, center, radius );
 }
 
 template<typename T>
@@ -51,11 +116,7 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     DEBUG_CSE
-    const int localHeight = X.LocalHeight();
-    const int width = X.Width();
-    for( int j=0; j<width; ++j )
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-            X.SetLocal( iLocal, j, SampleBall(center,radius) );
+    uniform::Fill( X, center, radius );
 }
 
 template<typename T>
@@ -303,6 +303,11 @@ Base<F> ShortVectorEnumeration
         auto RNew( R );
         Matrix<F> BNew, U;
 
+        // Each process randomizes its own trials, so the parallel
+        // enumerations cannot be distributed
+        auto trialCtrl( ctrl );
+        trialCtrl.parallelComm = mpi::COMM_SELF;
+
         for( Int trial=0; trial<ctrl.numTrials; ++trial )
         {
             BNew = B;
@@ -354,7 +359,10 @@ Base<F> ShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              ( ctrl.parallel ?
+                svp::ParallelEnumeration
+                ( dNew, NNew, upperBounds, v, trialCtrl ) :
+                svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl ) );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -431,7 +439,10 @@ Base<F> ShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result =
+          ( ctrl.parallel ?
+            svp::ParallelEnumeration( d, N, upperBounds, v, ctrl ) :
+            svp::GNREnumeration( d, N, upperBounds, v, ctrl ) );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
         return result;
@@ -519,6 +530,11 @@ MultiShortVectorEnumeration
         auto RNew( R );
         Matrix<F> BNew, U;
 
+        // Each process randomizes its own trials, so the parallel
+        // enumerations cannot be distributed
+        auto trialCtrl( ctrl );
+        trialCtrl.parallelComm = mpi::COMM_SELF;
+
         for( Int trial=0; trial<ctrl.numTrials; ++trial )
         {
             BNew = B;
@@ -570,7 +586,10 @@ MultiShortVectorEnumeration
             if( ctrl.time )
                 timer.Start();
             Real result =
-              svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
+              ( ctrl.parallel ?
+                svp::ParallelEnumeration
+                ( dNew, NNew, upperBounds, v, trialCtrl ) :
+                svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl ) );
             if( ctrl.time )
                 Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
             if( result < normUpperBound )
@@ -659,7 +678,10 @@ MultiShortVectorEnumeration
             Output("Starting FULL_ENUM(",n,")");
         if( ctrl.time )
             timer.Start();
-        Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
+        Real result =
+          ( ctrl.parallel ?
+            svp::ParallelEnumeration( d, N, upperBounds, v, ctrl ) :
+            svp::GNREnumeration( d, N, upperBounds, v, ctrl ) );
         if( ctrl.time )
             Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
 
@@ -801,8 +823,10 @@ Base<F> ShortestVectorEnumeration
             v = vCand;
             targetNorm = result;
             satisfiedBound = true;
-            // Y-sparse enumeration does not benefit from repetition
-            if( ctrl.enumType == YSPARSE_ENUM ) 
+            // Y-sparse enumeration does not benefit from repetition, and
+            // parallel full enumeration already returns the shortest vector
+            if( ctrl.enumType == YSPARSE_ENUM ||
+                (ctrl.parallel && ctrl.enumType == FULL_ENUM) )
                 return result;
         }
         else if( satisfiedBound )
@@ -895,8 +919,10 @@ MultiShortestVectorEnumeration
             targetNorms(indexCand) = normCand;
             satisfiedBound = true;
             satisfiedIndex = indexCand;
-            // Y-sparse enumeration does not benefit from repetition
-            if( ctrl.enumType == YSPARSE_ENUM ) 
+            // Y-sparse enumeration does not benefit from repetition, and
+            // parallel full enumeration already returns the shortest vector
+            if( ctrl.enumType == YSPARSE_ENUM ||
+                (ctrl.parallel && ctrl.enumType == FULL_ENUM) )
                 return result;
         }
         else if( satisfiedBound )
@@ -0,0 +1,396 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace svp {
+
+// The search tree of GNR enumeration (see GNR.cpp) is split by enumerating
+// the (projected) lattice members defined by the last 'depth' coordinates,
+// each of which is the root of an independent subtree. The subtree rooted
+// at the zero prefix, which contains all of the members whose last nonzero
+// coordinate lies above the split, is searched as well. Since the subtrees
+// are searched for the shortest member, rather than the first member found,
+// the search radius is shared between the workers so that the discovery of
+// a short vector prunes every subtree.
+//
+// See, for example,
+//
+//   Ozgur Dagdelen and Michael Schneider,
+//   "Parallel enumeration of shortest lattice vectors", Euro-Par 2010.
+
+namespace par_enum {
+
+// Refresh the local copy of the shared radius after this many steps
+const Int refreshInterval = 1<<12;
+
+template<typename F>
+struct SharedBest
+{
+    Base<F> radius;
+    Base<F> norm;
+    Matrix<F> v;
+    bool found=false;
+};
+
+// The upper bounds scaled by the (possibly stale) shared radius
+template<typename F>
+class Bounds
+{
+public:
+    typedef Base<F> Real;
+
+    Bounds( const Matrix<Real>& upperBounds, SharedBest<F>& best )
+    : upperBounds_(upperBounds), best_(best), n_(upperBounds.Height())
+    { Refresh(); }
+
+    Real operator()( Int k ) const
+    { return scale_*upperBounds_((n_-1)-k); }
+
+    void Refresh()
+    {
+        Real radius;
+#ifdef EL_HYBRID
+        #pragma omp critical(ElParallelEnumeration)
+#endif
+        radius = best_.radius;
+        scale_ = radius / upperBounds_(n_-1);
+    }
+
+    void Record( Real norm, const Matrix<F>& v )
+    {
+        Real radius;
+#ifdef EL_HYBRID
+        #pragma omp critical(ElParallelEnumeration)
+#endif
+        {
+            if( norm < best_.radius )
+            {
+                best_.radius = norm;
+                best_.norm = norm;
+                best_.v = v;
+                best_.found = true;
+            }
+            radius = best_.radius;
+        }
+        scale_ = radius / upperBounds_(n_-1);
+    }
+
+private:
+    const Matrix<Real>& upperBounds_;
+    SharedBest<F>& best_;
+    const Int n_;
+    Real scale_;
+};
+
+template<typename F>
+struct Walker
+{
+    Matrix<F> v, partialSums, centers;
+    Matrix<Int> sumIndices;
+    Matrix<Base<F>> partialNorms;
+    vector<SpiralState<F>> spiralStates;
+
+    void Reset( Int n )
+    {
+        Zeros( v, n, 1 );
+        Zeros( partialSums, n+1, n );
+        Zeros( centers, n, 1 );
+        Zeros( sumIndices, n+1, 1 );
+        Zeros( partialNorms, n+1, 1 );
+        spiralStates.resize( n );
+    }
+};
+
+template<typename F>
+struct Subtree
+{
+    Matrix<F> prefix;
+    Base<F> norm;
+};
+
+// Run a GNR-style depth-first search over levels [bottom,top) of the tree,
+// where the coordinates v(top:n-1) are fixed. If 'zeroPrefix' is true, then
+// they are zero and the sign symmetry is removed by constraining the last
+// nonzero coordinate to be positive; otherwise, partialNorms(top) must hold
+// the norm of their contribution. The walker must have been reset (other
+// than the prefix), and 'visit(norm)' is called on each admissible node at
+// level 'bottom'.
+template<typename F,class VisitType>
+void Traverse
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+        Int bottom,
+        Int top,
+        bool zeroPrefix,
+        Bounds<F>& bounds,
+        Walker<F>& w,
+        VisitType visit )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    F* vBuf = w.v.Buffer();
+
+    Int k=top;
+    auto moveDown = [&]()
+      {
+          --k;
+          w.sumIndices(k) = Max(w.sumIndices(k),w.sumIndices(k+1));
+                F* s = &w.partialSums(0,k);
+          const F* nBuf = &NTrans(0,k);
+          for( Int i=w.sumIndices(k+1); i>=k+1; --i )
+              s[i] = s[i+1] + nBuf[i]*vBuf[i];
+          w.centers(k) = -s[k+1];
+          vBuf[k] = Round(w.centers(k));
+          w.spiralStates[k].Initialize( w.centers(k) );
+      };
+
+    Int lastNonzero;
+    if( zeroPrefix )
+    {
+        for( Int j=0; j<=n; ++j )
+            w.sumIndices(j) = j-1;
+        k = bottom;
+        w.spiralStates[k].Initialize( true );
+        vBuf[k] = w.spiralStates[k].Step();
+        lastNonzero = k;
+    }
+    else
+    {
+        // Every partial sum must be formed from scratch
+        for( Int j=0; j<=n; ++j )
+            w.sumIndices(j) = n-1;
+        lastNonzero = n;
+        moveDown();
+    }
+
+    Int numSteps=0;
+    while( true )
+    {
+        if( ++numSteps == refreshInterval )
+        {
+            bounds.Refresh();
+            numSteps = 0;
+        }
+        const F entry = d(k)*(vBuf[k] - w.centers(k));
+        const Real partialNorm = SafeNorm( w.partialNorms(k+1), entry );
+        w.partialNorms(k) = partialNorm;
+        if( partialNorm < bounds(k) )
+        {
+            if( k == bottom )
+            {
+                visit( partialNorm );
+                vBuf[k] = w.spiralStates[k].Step();
+            }
+            else
+                moveDown();
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == top )
+                return;
+            w.sumIndices(k) = k; // indicate that (i,j) are not synchronized
+            if( k > lastNonzero )
+            {
+                // Seed a constrained spiral out from zero
+                w.spiralStates[k].Initialize( true );
+                vBuf[k] = w.spiralStates[k].Step();
+                lastNonzero = k;
+            }
+            else
+            {
+                vBuf[k] = w.spiralStates[k].Step();
+            }
+        }
+    }
+}
+
+// Enumerate the nonzero prefixes v(n-depth:n-1) beneath the bounds
+template<typename F>
+vector<Subtree<F>> SplitTree
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+        Int depth,
+        Bounds<F>& bounds,
+        Walker<F>& w )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Int top = n-depth;
+    vector<Subtree<F>> subtrees;
+    w.Reset( n );
+    Traverse
+    ( d, NTrans, top, n, true, bounds, w,
+      [&]( const Real& norm )
+      {
+          Subtree<F> subtree;
+          subtree.prefix = w.v( IR(top,n), ALL );
+          subtree.norm = norm;
+          subtrees.push_back( subtree );
+      } );
+    // Search the subtrees with the smallest prefixes first, as they are the
+    // most likely to shrink the search radius
+    std::sort
+    ( subtrees.begin(), subtrees.end(),
+      []( const Subtree<F>& a, const Subtree<F>& b )
+      { return a.norm < b.norm; } );
+    return subtrees;
+}
+
+} // namespace par_enum
+
+template<typename F>
+Base<F> ParallelEnumeration
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+
+    Matrix<F> NTrans;
+    Transpose( N, NTrans );
+
+    const mpi::Comm comm = ctrl.parallelComm;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    // MPFR's default precision is thread-local, so BigFloat searches are not
+    // threaded
+    if( IsThreadSafe<Real>::value && !omp_in_parallel() )
+        numThreads = omp_get_max_threads();
+#endif
+
+    par_enum::SharedBest<F> best;
+    best.radius = upperBounds(n-1);
+
+    // Split the tree (the top level is left to the subtrees when n == 1)
+    vector<par_enum::Subtree<F>> subtrees;
+    Int top = n;
+    {
+        par_enum::Bounds<F> bounds( upperBounds, best );
+        par_enum::Walker<F> w;
+        const Int maxDepth = n-1;
+        if( ctrl.parallelDepth > 0 )
+        {
+            const Int depth = Min(ctrl.parallelDepth,maxDepth);
+            subtrees = par_enum::SplitTree( d, NTrans, depth, bounds, w );
+            top = n-depth;
+        }
+        else
+        {
+            const Int minNumSubtrees =
+              Max(ctrl.subtreesPerWorker,Int(1))*numThreads*commSize;
+            for( Int depth=1; depth<=maxDepth; ++depth )
+            {
+                subtrees = par_enum::SplitTree( d, NTrans, depth, bounds, w );
+                top = n-depth;
+                if( Int(subtrees.size()) >= minNumSubtrees )
+                    break;
+            }
+        }
+    }
+
+    // Subtree 0 is rooted at the zero prefix
+    const Int numSubtrees = subtrees.size()+1;
+    const Int batchSize = Max(ctrl.syncBatchSize,Int(1))*commSize;
+    for( Int batchBeg=0; batchBeg<numSubtrees; batchBeg+=batchSize )
+    {
+        const Int batchEnd = Min(batchBeg+batchSize,numSubtrees);
+#ifdef EL_HYBRID
+        #pragma omp parallel num_threads(numThreads) if(numThreads>1)
+#endif
+        {
+            par_enum::Bounds<F> bounds( upperBounds, best );
+            par_enum::Walker<F> w;
+            auto record =
+              [&]( const Real& norm ) { bounds.Record( norm, w.v ); };
+#ifdef EL_HYBRID
+            #pragma omp for schedule(dynamic,1)
+#endif
+            for( Int i=batchBeg+commRank; i<batchEnd; i+=commSize )
+            {
+                bounds.Refresh();
+                w.Reset( n );
+                if( i == 0 )
+                {
+                    par_enum::Traverse
+                    ( d, NTrans, 0, top, true, bounds, w, record );
+                }
+                else
+                {
+                    const auto& subtree = subtrees[i-1];
+                    if( subtree.norm >= bounds(top) )
+                        continue;
+                    auto vTop = w.v( IR(top,n), ALL );
+                    vTop = subtree.prefix;
+                    w.partialNorms(top) = subtree.norm;
+                    par_enum::Traverse
+                    ( d, NTrans, 0, top, false, bounds, w, record );
+                }
+            }
+        }
+        if( commSize > 1 )
+            best.radius = mpi::AllReduce( best.radius, mpi::MIN, comm );
+    }
+
+    if( commSize > 1 )
+    {
+        // The lowest rank holding a member of the minimal norm shares it
+        const int owner =
+          mpi::AllReduce
+          ( int(best.found && best.norm == best.radius ? commRank : commSize),
+            mpi::MIN, comm );
+        if( owner == commSize )
+            return 2*upperBounds(n-1)+1;
+        if( commRank != owner )
+            Zeros( best.v, n, 1 );
+        mpi::Broadcast( best.v.Buffer(), n, owner, comm );
+        best.found = true;
+        best.norm = best.radius;
+    }
+    if( !best.found )
+        return 2*upperBounds(n-1)+1;
+    v = best.v;
+    return best.norm;
+}
+
+} // namespace svp
+
+#define PROTO(F) \
+  template Base<F> svp::ParallelEnumeration \
+  ( const Matrix<Base<F>>& d, \
+    const Matrix<F>& N, \
+    const Matrix<Base<F>>& u, \
+          Matrix<F>& v, \
+    const EnumCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -12,6 +12,7 @@
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
 #include "./SVT/TSQR.hpp"
+#include "./SVT/Randomized.hpp"
 
 namespace El {
 
@@ -76,6 +77,12 @@ Int SVT( DistMatrix<F,U,STAR>& A, Base<F> tau, bool relative )
   ( ElementalMatrix<F>& A, Base<F> tau, Int numSteps, bool relative ); \
   template Int svt::TSQR \
   ( ElementalMatrix<F>& A, Base<F> tau, bool relative ); \
+  template Int svt::Randomized \
+  ( Matrix<F>& A, Base<F> tau, Matrix<F>& U, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl, bool relative ); \
+  template Int svt::Randomized \
+  ( ElementalMatrix<F>& A, Base<F> tau, ElementalMatrix<F>& U, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl, bool relative ); \
   PROTO_DIST(F,MC  ) \
   PROTO_DIST(F,MD  ) \
   PROTO_DIST(F,MR  ) \
@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+
+namespace svt {
+
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> tau, Matrix<F>& U,
+  const RandomizedSVDCtrl<Base<F>>& ctrl, bool relative )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    // Only the singular values above the threshold are of interest
+    RandomizedSVDCtrl<Real> rsvdCtrl( ctrl );
+    rsvdCtrl.adaptive = true;
+    rsvdCtrl.tol = tau;
+    rsvdCtrl.relative = relative;
+    rsvdCtrl.warmStart = ( U.Height() == A.Height() && U.Width() > 0 );
+    if( rsvdCtrl.warmStart )
+        rsvdCtrl.rank = U.Width();
+
+    Matrix<F> V;
+    Matrix<Real> s;
+    RandomizedSVD( A, U, s, V, rsvdCtrl );
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+
+    auto UL = U( ALL, IR(0,rank) );
+    auto VL = V( ALL, IR(0,rank) );
+    auto sT = s( IR(0,rank), ALL );
+    Matrix<F> UScaled( UL );
+    DiagonalScale( RIGHT, NORMAL, sT, UScaled );
+    Gemm( NORMAL, ADJOINT, F(1), UScaled, VL, F(0), A );
+
+    // Keep one extra direction so that the next rank can grow
+    Matrix<F> UNext( U( ALL, IR(0,Min(rank+1,U.Width())) ) );
+    U = UNext;
+    return rank;
+}
+
+template<typename F>
+Int Randomized
+( ElementalMatrix<F>& APre, Base<F> tau, ElementalMatrix<F>& UPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl, bool relative )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> UProx( UPre );
+    auto& A = AProx.Get();
+    auto& U = UProx.Get();
+    const Grid& g = A.Grid();
+
+    RandomizedSVDCtrl<Real> rsvdCtrl( ctrl );
+    rsvdCtrl.adaptive = true;
+    rsvdCtrl.tol = tau;
+    rsvdCtrl.relative = relative;
+    rsvdCtrl.warmStart = ( U.Height() == A.Height() && U.Width() > 0 );
+    if( rsvdCtrl.warmStart )
+        rsvdCtrl.rank = U.Width();
+
+    DistMatrix<F> V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    RandomizedSVD( A, U, s, V, rsvdCtrl );
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+
+    auto UL = U( ALL, IR(0,rank) );
+    auto VL = V( ALL, IR(0,rank) );
+    auto sT = s( IR(0,rank), ALL );
+    DistMatrix<F> UScaled( UL );
+    DiagonalScale( RIGHT, NORMAL, sT, UScaled );
+    Gemm( NORMAL, ADJOINT, F(1), UScaled, VL, F(0), A );
+
+    DistMatrix<F> UNext( U( ALL, IR(0,Min(rank+1,U.Width())) ) );
+    U = UNext;
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
@@ -0,0 +1,325 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Each component of the iterate is written under a temporary name and only
+// renamed into place once every component has been written so that an
+// interruption during a write cannot corrupt the previous checkpoint.
+//
+// The BINARY format stores the raw bytes of each entry, so the MPFR-based
+// types (whose entries point to their limbs) are not instantiated.
+
+namespace El {
+namespace ipm {
+
+namespace {
+
+const char* iterateNames[] = { "x", "y", "z", "s" };
+
+string FinalName( const string& basename, const string& name )
+{ return basename + "-" + name; }
+
+string TempName( const string& basename, const string& name )
+{ return basename + "-" + name + ".tmp"; }
+
+template<typename Real>
+void AssertPacked()
+{
+    static_assert
+    ( IsPacked<Real>::value,
+      "The BINARY format only supports fixed-size (packed) entries" );
+}
+
+template<typename Real>
+mpi::Comm IterateComm( const Matrix<Real>& x )
+{ return mpi::COMM_SELF; }
+
+template<typename Real>
+mpi::Comm IterateComm( const AbstractDistMatrix<Real>& x )
+{ return x.Grid().ViewingComm(); }
+
+template<typename Real>
+mpi::Comm IterateComm( const DistMultiVec<Real>& x )
+{ return x.Comm(); }
+
+template<typename Real>
+void WriteIterate( const Matrix<Real>& x, const string& basename )
+{
+    AssertPacked<Real>();
+    Write( x, basename, BINARY );
+}
+
+template<typename Real>
+void WriteIterate( const AbstractDistMatrix<Real>& x, const string& basename )
+{
+    AssertPacked<Real>();
+    Write( x, basename, BINARY );
+}
+
+template<typename Real>
+void WriteIterate( const DistMultiVec<Real>& x, const string& basename )
+{
+    AssertPacked<Real>();
+    Grid grid( x.Comm() );
+    DistMatrix<Real,VC,STAR> x_VC_STAR(grid);
+    Copy( x, x_VC_STAR );
+    Write( x_VC_STAR, basename, BINARY );
+}
+
+template<typename Real>
+void ReadIterate( Matrix<Real>& x, const string& basename )
+{
+    AssertPacked<Real>();
+    Read( x, basename+"."+FileExtension(BINARY), BINARY );
+}
+
+template<typename Real>
+void ReadIterate( AbstractDistMatrix<Real>& x, const string& basename )
+{
+    AssertPacked<Real>();
+    Read( x, basename+"."+FileExtension(BINARY), BINARY );
+}
+
+template<typename Real>
+void ReadIterate( DistMultiVec<Real>& x, const string& basename )
+{
+    AssertPacked<Real>();
+    Grid grid( x.Comm() );
+    DistMatrix<Real,VC,STAR> x_VC_STAR(grid);
+    Read( x_VC_STAR, basename+"."+FileExtension(BINARY), BINARY );
+    Copy( x_VC_STAR, x );
+}
+
+template<class VectorType>
+void WriteIterates
+( const string& basename, Int numIts,
+  const vector<const VectorType*>& iterates )
+{
+    DEBUG_CSE
+    mpi::Comm comm = IterateComm( *iterates[0] );
+    const int commRank = mpi::Rank( comm );
+    const Int numIterates = iterates.size();
+    for( Int k=0; k<numIterates; ++k )
+        WriteIterate( *iterates[k], TempName(basename,iterateNames[k]) );
+    if( commRank == 0 )
+    {
+        Matrix<Int> state(1,1);
+        state.Set( 0, 0, numIts );
+        Write( state, TempName(basename,"state"), BINARY );
+    }
+
+    // Every component must be complete before any of them is renamed
+    mpi::Barrier( comm );
+    if( commRank == 0 )
+    {
+        const string ext = "." + FileExtension(BINARY);
+        for( Int k=0; k<=numIterates; ++k )
+        {
+            const string name = ( k < numIterates ? iterateNames[k] : "state" );
+            const string oldName = TempName(basename,name) + ext;
+            const string newName = FinalName(basename,name) + ext;
+            if( std::rename( oldName.c_str(), newName.c_str() ) != 0 )
+                RuntimeError("Could not rename ",oldName," to ",newName);
+        }
+    }
+    mpi::Barrier( comm );
+}
+
+template<class VectorType>
+Int ReadIterates
+( const string& basename, const vector<VectorType*>& iterates )
+{
+    DEBUG_CSE
+    const Int numIterates = iterates.size();
+    for( Int k=0; k<numIterates; ++k )
+        ReadIterate( *iterates[k], FinalName(basename,iterateNames[k]) );
+
+    Matrix<Int> state;
+    const string stateName =
+      FinalName(basename,"state") + "." + FileExtension(BINARY);
+    Read( state, stateName, BINARY );
+    if( state.Height() != 1 || state.Width() != 1 )
+        RuntimeError("Invalid checkpoint state for ",basename);
+    return state.Get(0,0);
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const Matrix<Real>& x, const Matrix<Real>& y, const Matrix<Real>& z )
+{
+    DEBUG_CSE
+    WriteIterates<Matrix<Real>>( basename, numIts, {&x,&y,&z} );
+}
+
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const Matrix<Real>& x, const Matrix<Real>& y,
+  const Matrix<Real>& z, const Matrix<Real>& s )
+{
+    DEBUG_CSE
+    WriteIterates<Matrix<Real>>( basename, numIts, {&x,&y,&z,&s} );
+}
+
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const AbstractDistMatrix<Real>& x, const AbstractDistMatrix<Real>& y,
+  const AbstractDistMatrix<Real>& z )
+{
+    DEBUG_CSE
+    WriteIterates<AbstractDistMatrix<Real>>( basename, numIts, {&x,&y,&z} );
+}
+
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const AbstractDistMatrix<Real>& x, const AbstractDistMatrix<Real>& y,
+  const AbstractDistMatrix<Real>& z, const AbstractDistMatrix<Real>& s )
+{
+    DEBUG_CSE
+    WriteIterates<AbstractDistMatrix<Real>>
+    ( basename, numIts, {&x,&y,&z,&s} );
+}
+
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z )
+{
+    DEBUG_CSE
+    WriteIterates<DistMultiVec<Real>>( basename, numIts, {&x,&y,&z} );
+}
+
+template<typename Real>
+void WriteCheckpoint
+( const string basename, Int numIts,
+  const DistMultiVec<Real>& x, const DistMultiVec<Real>& y,
+  const DistMultiVec<Real>& z, const DistMultiVec<Real>& s )
+{
+    DEBUG_CSE
+    WriteIterates<DistMultiVec<Real>>( basename, numIts, {&x,&y,&z,&s} );
+}
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z )
+{
+    DEBUG_CSE
+    return ReadIterates<Matrix<Real>>( basename, {&x,&y,&z} );
+}
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z, Matrix<Real>& s )
+{
+    DEBUG_CSE
+    return ReadIterates<Matrix<Real>>( basename, {&x,&y,&z,&s} );
+}
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  AbstractDistMatrix<Real>& x, AbstractDistMatrix<Real>& y,
+  AbstractDistMatrix<Real>& z )
+{
+    DEBUG_CSE
+    return ReadIterates<AbstractDistMatrix<Real>>( basename, {&x,&y,&z} );
+}
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  AbstractDistMatrix<Real>& x, AbstractDistMatrix<Real>& y,
+  AbstractDistMatrix<Real>& z, AbstractDistMatrix<Real>& s )
+{
+    DEBUG_CSE
+    return ReadIterates<AbstractDistMatrix<Real>>( basename, {&x,&y,&z,&s} );
+}
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z )
+{
+    DEBUG_CSE
+    return ReadIterates<DistMultiVec<Real>>( basename, {&x,&y,&z} );
+}
+
+template<typename Real>
+Int ReadCheckpoint
+( const string basename,
+  DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+  DistMultiVec<Real>& z, DistMultiVec<Real>& s )
+{
+    DEBUG_CSE
+    return ReadIterates<DistMultiVec<Real>>( basename, {&x,&y,&z,&s} );
+}
+
+#define PROTO(Real) \
+  template void WriteCheckpoint \
+  ( const string basename, Int numIts, \
+    const Matrix<Real>& x, const Matrix<Real>& y, const Matrix<Real>& z ); \
+  template void WriteCheckpoint \
+  ( const string basename, Int numIts, \
+    const Matrix<Real>& x, const Matrix<Real>& y, \
+    const Matrix<Real>& z, const Matrix<Real>& s ); \
+  template void WriteCheckpoint \
+  ( const string basename, Int numIts, \
+    const AbstractDistMatrix<Real>& x, const AbstractDistMatrix<Real>& y, \
+    const AbstractDistMatrix<Real>& z ); \
+  template void WriteCheckpoint \
+  ( const string basename, Int numIts, \
+    const AbstractDistMatrix<Real>& x, const AbstractDistMatrix<Real>& y, \
+    const AbstractDistMatrix<Real>& z, const AbstractDistMatrix<Real>& s ); \
+  template void WriteCheckpoint \
+  ( const string basename, Int numIts, \
+    const DistMultiVec<Real>& x, const DistMultiVec<Real>& y, \
+    const DistMultiVec<Real>& z ); \
+  template void WriteCheckpoint \
+  ( const string basename, Int numIts, \
+    const DistMultiVec<Real>& x, const DistMultiVec<Real>& y, \
+    const DistMultiVec<Real>& z, const DistMultiVec<Real>& s ); \
+  template Int ReadCheckpoint \
+  ( const string basename, \
+    Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z ); \
+  template Int ReadCheckpoint \
+  ( const string basename, \
+    Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z, Matrix<Real>& s ); \
+  template Int ReadCheckpoint \
+  ( const string basename, \
+    AbstractDistMatrix<Real>& x, AbstractDistMatrix<Real>& y, \
+    AbstractDistMatrix<Real>& z ); \
+  template Int ReadCheckpoint \
+  ( const string basename, \
+    AbstractDistMatrix<Real>& x, AbstractDistMatrix<Real>& y, \
+    AbstractDistMatrix<Real>& z, AbstractDistMatrix<Real>& s ); \
+  template Int ReadCheckpoint \
+  ( const string basename, \
+    DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z ); \
+  template Int ReadCheckpoint \
+  ( const string basename, \
+    DistMultiVec<Real>& x, DistMultiVec<Real>& y, \
+    DistMultiVec<Real>& z, DistMultiVec<Real>& s );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace ipm
+} // namespace El
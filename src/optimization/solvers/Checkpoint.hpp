@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_CHECKPOINT_HPP
+#define EL_OPTIMIZATION_SOLVERS_CHECKPOINT_HPP
+
+namespace El {
+namespace ipm {
+
+// The checkpoints are stored in the BINARY format, which cannot represent the
+// MPFR-based types, so the checkpoint routines are not instantiated for them
+template<typename Real,typename=EnableIf<IsPacked<Real>>,class... VectorTypes>
+Int LoadCheckpoint( const string& basename, VectorTypes&... iterates )
+{ return ReadCheckpoint( basename, iterates... ); }
+
+template<typename Real,typename=DisableIf<IsPacked<Real>>,typename=void,
+         class... VectorTypes>
+Int LoadCheckpoint( const string& basename, VectorTypes&... iterates )
+{
+    LogicError("IPM checkpoints are not supported for ",TypeName<Real>());
+    return 0;
+}
+
+template<typename Real,typename=EnableIf<IsPacked<Real>>,class... VectorTypes>
+void StoreCheckpoint
+( const string& basename, Int numIts, const VectorTypes&... iterates )
+{ WriteCheckpoint( basename, numIts, iterates... ); }
+
+template<typename Real,typename=DisableIf<IsPacked<Real>>,typename=void,
+         class... VectorTypes>
+void StoreCheckpoint
+( const string& basename, Int numIts, const VectorTypes&... iterates )
+{ LogicError("IPM checkpoints are not supported for ",TypeName<Real>()); }
+
+// Load the checkpointed iterate and return the controls for continuing the
+// IPM from it as if it were a user-provided initial guess
+template<typename Real,class... VectorTypes>
+MehrotraCtrl<Real>
+ResumeCtrl( const MehrotraCtrl<Real>& ctrl, VectorTypes&... iterates )
+{
+    DEBUG_CSE
+    const Int numPriorIts =
+      LoadCheckpoint<Real>( ctrl.checkpoint.basename, iterates... );
+    auto resumeCtrl = ctrl;
+    resumeCtrl.primalInit = true;
+    resumeCtrl.dualInit = true;
+    resumeCtrl.checkpoint.resume = false;
+    resumeCtrl.checkpoint.numPriorIts = numPriorIts;
+    resumeCtrl.maxIts = Max( ctrl.maxIts-numPriorIts, Int(0) );
+    return resumeCtrl;
+}
+
+inline bool CheckpointDue( const IPMCheckpointCtrl& ctrl, Int numIts )
+{
+    return ctrl.frequency > 0 && numIts > 0 &&
+           (ctrl.numPriorIts+numIts) % ctrl.frequency == 0;
+}
+
+// Periodically write the iterate of a 'direct' IPM after mapping it back to
+// the original scaling of the problem
+template<typename Real,class UnequilType,class VectorType>
+void MaybeCheckpoint
+( const MehrotraCtrl<Real>& ctrl, Int numIts, UnequilType& unequilibrate,
+  const VectorType& x, const VectorType& y, const VectorType& z )
+{
+    DEBUG_CSE
+    if( !CheckpointDue( ctrl.checkpoint, numIts ) )
+        return;
+    VectorType xOrig(x), yOrig(y), zOrig(z);
+    unequilibrate( xOrig, yOrig, zOrig );
+    StoreCheckpoint<Real>
+    ( ctrl.checkpoint.basename, ctrl.checkpoint.numPriorIts+numIts,
+      xOrig, yOrig, zOrig );
+}
+
+// Periodically write the iterate of an 'affine' IPM after mapping it back to
+// the original scaling of the problem
+template<typename Real,class UnequilType,class VectorType>
+void MaybeCheckpoint
+( const MehrotraCtrl<Real>& ctrl, Int numIts, UnequilType& unequilibrate,
+  const VectorType& x, const VectorType& y,
+  const VectorType& z, const VectorType& s )
+{
+    DEBUG_CSE
+    if( !CheckpointDue( ctrl.checkpoint, numIts ) )
+        return;
+    VectorType xOrig(x), yOrig(y), zOrig(z), sOrig(s);
+    unequilibrate( xOrig, yOrig, zOrig, sOrig );
+    StoreCheckpoint<Real>
+    ( ctrl.checkpoint.basename, ctrl.checkpoint.numPriorIts+numIts,
+      xOrig, yOrig, zOrig, sOrig );
+}
+
+} // namespace ipm
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_CHECKPOINT_HPP
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace lp {
@@ -48,6 +49,13 @@ void Mehrotra
 {
     DEBUG_CSE
 
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra( APre, GPre, bPre, cPre, hPre, x, y, z, s, resumeCtrl );
+        return;
+    }
+
     // TODO: Move these into the control structure
     const bool stepLengthSigma = true;
     function<Real(Real,Real,Real,Real)> centralityRule;
@@ -119,6 +127,20 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y,
+           Matrix<Real>& z, Matrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -191,6 +213,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -332,13 +355,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -356,6 +373,14 @@ void Mehrotra
 {
     DEBUG_CSE
 
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, xPre, yPre, zPre, sPre );
+        Mehrotra
+        ( APre, GPre, bPre, cPre, hPre, xPre, yPre, zPre, sPre, resumeCtrl );
+        return;
+    }
+
     // TODO: Move these into the control structure
     const bool stepLengthSigma = true;
     function<Real(Real,Real,Real,Real)> centralityRule;
@@ -466,6 +491,20 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMatrix<Real>& x, DistMatrix<Real>& y,
+           DistMatrix<Real>& z, DistMatrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -539,6 +578,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -678,13 +718,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    } 
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -701,6 +735,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra( APre, GPre, bPre, cPre, hPre, x, y, z, s, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -805,6 +847,20 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y,
+           Matrix<Real>& z, Matrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -881,6 +937,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1056,13 +1113,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -1079,6 +1130,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra( APre, GPre, bPre, cPre, hPre, x, y, z, s, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -1221,6 +1280,20 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+           DistMultiVec<Real>& z, DistMultiVec<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1298,6 +1371,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1494,13 +1568,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 #define PROTO(Real) \
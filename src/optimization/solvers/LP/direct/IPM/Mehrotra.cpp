@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace lp {
@@ -43,6 +44,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z );
+        Mehrotra( APre, bPre, cPre, x, y, z, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -131,6 +140,21 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          x *= bScale;
+          y *= cScale;
+          z *= cScale;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -195,6 +219,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -433,35 +458,27 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
+    unequilibrate( x, y, z );
+    if( ctrl.outerEquil && ctrl.print )
     {
-        x *= bScale;
-        y *= cScale;
-        z *= cScale;
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-        if( ctrl.print )
-        {
-            b *= bScale;
-            c *= cScale;
-            DiagonalScale( LEFT, NORMAL, dRow, b );
-            DiagonalScale( LEFT, NORMAL, dCol, c );
-            const Real primObj = Dot(c,x);
-            const Real dualObj = -Dot(b,y);
-            const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
-            const Real xNrm2 = Nrm2( x );
-            const Real yNrm2 = Nrm2( y );
-            const Real zNrm2 = Nrm2( z );
-            Output
-            ("Exiting with:\n",Indent(),
-             "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
-             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
-             "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
-             "  primal = ",primObj,"\n",Indent(),
-             "  dual   = ",dualObj,"\n",Indent(),
-             "  |primal - dual| / (1 + |primal|) = ",objConv);
-        }
+        b *= bScale;
+        c *= cScale;
+        DiagonalScale( LEFT, NORMAL, dRow, b );
+        DiagonalScale( LEFT, NORMAL, dCol, c );
+        const Real primObj = Dot(c,x);
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real xNrm2 = Nrm2( x );
+        const Real yNrm2 = Nrm2( y );
+        const Real zNrm2 = Nrm2( z );
+        Output
+        ("Exiting with:\n",Indent(),
+         "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+         "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+         "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+         "  primal = ",primObj,"\n",Indent(),
+         "  dual   = ",dualObj,"\n",Indent(),
+         "  |primal - dual| / (1 + |primal|) = ",objConv);
     }
 }
 
@@ -476,6 +493,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, xPre, yPre, zPre );
+        Mehrotra( APre, bPre, cPre, xPre, yPre, zPre, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -600,6 +625,21 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMatrix<Real>& x, DistMatrix<Real>& y, DistMatrix<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          x *= bScale;
+          y *= cScale;
+          z *= cScale;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -665,6 +705,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -904,36 +945,28 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
+    unequilibrate( x, y, z );
+    if( ctrl.outerEquil && ctrl.print )
     {
-        x *= bScale;
-        y *= cScale;
-        z *= cScale;
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-        if( ctrl.print )
-        {
-            b *= bScale;
-            c *= cScale;
-            DiagonalScale( LEFT, NORMAL, dRow, b );
-            DiagonalScale( LEFT, NORMAL, dCol, c );
-            const Real primObj = Dot(c,x);
-            const Real dualObj = -Dot(b,y);
-            const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
-            const Real xNrm2 = Nrm2( x );
-            const Real yNrm2 = Nrm2( y );
-            const Real zNrm2 = Nrm2( z );
-            if( commRank == 0 )
-                Output
-                ("Exiting with:\n",Indent(),
-                 "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
-                 "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
-                 "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
-                 "  primal = ",primObj,"\n",Indent(),
-                 "  dual   = ",dualObj,"\n",Indent(),
-                 "  |primal - dual| / (1 + |primal|) = ",objConv);
-        }
+        b *= bScale;
+        c *= cScale;
+        DiagonalScale( LEFT, NORMAL, dRow, b );
+        DiagonalScale( LEFT, NORMAL, dCol, c );
+        const Real primObj = Dot(c,x);
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real xNrm2 = Nrm2( x );
+        const Real yNrm2 = Nrm2( y );
+        const Real zNrm2 = Nrm2( z );
+        if( commRank == 0 )
+            Output
+            ("Exiting with:\n",Indent(),
+             "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+             "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+             "  primal = ",primObj,"\n",Indent(),
+             "  dual   = ",dualObj,"\n",Indent(),
+             "  |primal - dual| / (1 + |primal|) = ",objConv);
     }
 }
 
@@ -948,6 +981,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z );
+        Mehrotra( APre, bPre, cPre, x, y, z, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -1036,25 +1077,27 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    // Reuse the caller's factorization plan (if one was provided) so that the
+    // analysis of the KKT sparsity pattern persists across solves
+    ldl::FactorizationPlan<Real> localPlan;
+    auto& plan = ( ctrl.plan == nullptr ? localPlan : *ctrl.plan );
+    const auto& invMap = plan.invMap;
+    const auto& info = plan.info;
+    auto& JFront = plan.front;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( A, b, c, x, y, z, map, invMap, rootSep, info,
+        ( A, b, c, x, y, z, plan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
-        vector<Int> augMap, augInvMap;
-        ldl::NodeInfo augInfo;
-        ldl::Separator augRootSep;
+        ldl::FactorizationPlan<Real> augPlan;
         Initialize
-        ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
+        ( A, b, c, x, y, z, augPlan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
 
@@ -1086,7 +1129,6 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     SparseMatrix<Real> J, JOrig;
-    ldl::Front<Real> JFront;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
@@ -1097,6 +1139,21 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          x *= bScale;
+          y *= cScale;
+          z *= cScale;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1169,6 +1226,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1220,14 +1278,7 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 )
-                {
-                    NestedDissection( J.LockedGraph(), map, rootSep, info );
-                    InvertMap( map, invMap );
-                }
-                JFront.Pull( J, map, info );
-
-                LDL( info, JFront, LDL_2D );
+                plan.Factor( J );
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d,
@@ -1264,14 +1315,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
-                {
-                    NestedDissection( J.LockedGraph(), map, rootSep, info );
-                    InvertMap( map, invMap );
-                }
-                JFront.Pull( J, map, info );
-
-                LDL( info, JFront, LDL_2D );
+                plan.Factor( J );
                 // NOTE: regTmp should be all zeros; replace with unregularized
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, invMap, info, JFront, dyAff, 
@@ -1458,35 +1502,27 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
+    unequilibrate( x, y, z );
+    if( ctrl.outerEquil && ctrl.print )
     {
-        x *= bScale;
-        y *= cScale;
-        z *= cScale;
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-        if( ctrl.print )
-        {
-            b *= bScale;
-            c *= cScale;
-            DiagonalScale( LEFT, NORMAL, dRow, b );
-            DiagonalScale( LEFT, NORMAL, dCol, c );
-            const Real primObj = Dot(c,x);
-            const Real dualObj = -Dot(b,y);
-            const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
-            const Real xNrm2 = Nrm2( x );
-            const Real yNrm2 = Nrm2( y );
-            const Real zNrm2 = Nrm2( z );
-            Output
-            ("Exiting with:\n",Indent(),
-             "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
-             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
-             "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
-             "  primal = ",primObj,"\n",Indent(),
-             "  dual   = ",dualObj,"\n",Indent(),
-             "  |primal - dual| / (1 + |primal|) = ",objConv);
-        }
+        b *= bScale;
+        c *= cScale;
+        DiagonalScale( LEFT, NORMAL, dRow, b );
+        DiagonalScale( LEFT, NORMAL, dCol, c );
+        const Real primObj = Dot(c,x);
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real xNrm2 = Nrm2( x );
+        const Real yNrm2 = Nrm2( y );
+        const Real zNrm2 = Nrm2( z );
+        Output
+        ("Exiting with:\n",Indent(),
+         "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+         "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+         "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+         "  primal = ",primObj,"\n",Indent(),
+         "  dual   = ",dualObj,"\n",Indent(),
+         "  |primal - dual| / (1 + |primal|) = ",objConv);
     }
 }
 
@@ -1502,6 +1538,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z );
+        Mehrotra( APre, bPre, cPre, x, y, z, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -1603,10 +1647,13 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    vector<Int> mappedSources, mappedTargets, colOffs;
+    // Reuse the caller's factorization plan (if one was provided) so that the
+    // analysis of the KKT sparsity pattern persists across solves
+    ldl::DistFactorizationPlan<Real> localPlan;
+    auto& plan = ( ctrl.distPlan == nullptr ? localPlan : *ctrl.distPlan );
+    const auto& invMap = plan.invMap;
+    const auto& info = plan.info;
+    auto& JFront = plan.front;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1615,19 +1662,14 @@ void Mehrotra
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( A, b, c, x, y, z, map, invMap, rootSep, info, 
-          mappedSources, mappedTargets, colOffs,
+        ( A, b, c, x, y, z, plan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
-        DistMap augMap, augInvMap;
-        ldl::DistNodeInfo augInfo;
-        ldl::DistSeparator augRootSep;
-        vector<Int> augMappedSources, augMappedTargets, augColOffs;
+        ldl::DistFactorizationPlan<Real> augPlan;
         Initialize
-        ( A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
-          augMappedSources, augMappedTargets, augColOffs,
+        ( A, b, c, x, y, z, augPlan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
     if( commRank == 0 && ctrl.time )
@@ -1664,7 +1706,6 @@ void Mehrotra
 
     DistSparseMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
-    ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
@@ -1676,6 +1717,21 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          x *= bScale;
+          y *= cScale;
+          z *= cScale;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1745,6 +1801,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1796,16 +1853,18 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
-                    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-                    if( commRank == 0 && ctrl.time )
-                        Output("ND: ",timer.Stop()," secs");
-                    InvertMap( map, invMap );
                 }
                 else
                     J.multMeta = meta;
 
+                // Only analyze J if its sparsity pattern is new to the plan
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( plan.Analyze( J ) )
+                    dmvMeta = ldl::DistMultiVecNodeMeta();
+                if( commRank == 0 && ctrl.time )
+                    Output("Analysis: ",timer.Stop()," secs");
+
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
                 if( wMaxNorm >= ctrl.ruizEquilTol )
@@ -1827,8 +1886,8 @@ void Mehrotra
                     Output("Equilibration: ",timer.Stop()," secs");
 
                 JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                ( J, plan.map, plan.rootSep, info,
+                  plan.mappedSources, plan.mappedTargets, plan.colOffs );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1887,18 +1946,20 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
-                    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-                    if( commRank == 0 && ctrl.time )
-                        Output("ND: ",timer.Stop()," secs");
-                    InvertMap( map, invMap );
                 }
                 else
                     J.multMeta = meta;
+
+                // Only analyze J if its sparsity pattern is new to the plan
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( plan.Analyze( J ) )
+                    dmvMeta = ldl::DistMultiVecNodeMeta();
+                if( commRank == 0 && ctrl.time )
+                    Output("Analysis: ",timer.Stop()," secs");
                 JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                ( J, plan.map, plan.rootSep, info,
+                  plan.mappedSources, plan.mappedTargets, plan.colOffs );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -2104,36 +2165,28 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
+    unequilibrate( x, y, z );
+    if( ctrl.outerEquil && ctrl.print )
     {
-        x *= bScale;
-        y *= cScale;
-        z *= cScale;
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-        if( ctrl.print )
-        {
-            b *= bScale;
-            c *= cScale;
-            DiagonalScale( LEFT, NORMAL, dRow, b );
-            DiagonalScale( LEFT, NORMAL, dCol, c );
-            const Real primObj = Dot(c,x);
-            const Real dualObj = -Dot(b,y);
-            const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
-            const Real xNrm2 = Nrm2( x );
-            const Real yNrm2 = Nrm2( y );
-            const Real zNrm2 = Nrm2( z );
-            if( commRank == 0 )
-                Output
-                ("Exiting with:\n",Indent(),
-                 "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
-                 "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
-                 "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
-                 "  primal = ",primObj,"\n",Indent(),
-                 "  dual   = ",dualObj,"\n",Indent(),
-                 "  |primal - dual| / (1 + |primal|) = ",objConv);
-        }
+        b *= bScale;
+        c *= cScale;
+        DiagonalScale( LEFT, NORMAL, dRow, b );
+        DiagonalScale( LEFT, NORMAL, dCol, c );
+        const Real primObj = Dot(c,x);
+        const Real dualObj = -Dot(b,y);
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        const Real xNrm2 = Nrm2( x );
+        const Real yNrm2 = Nrm2( y );
+        const Real zNrm2 = Nrm2( z );
+        if( commRank == 0 )
+            Output
+            ("Exiting with:\n",Indent(),
+             "  ||  x  ||_2 = ",xNrm2,"\n",Indent(),
+             "  ||  y  ||_2 = ",yNrm2,"\n",Indent(),
+             "  ||  z  ||_2 = ",zNrm2,"\n",Indent(),
+             "  primal = ",primObj,"\n",Indent(),
+             "  dual   = ",dualObj,"\n",Indent(),
+             "  |primal - dual| / (1 + |primal|) = ",objConv);
     }
 }
 
@@ -41,10 +41,7 @@ void Initialize
         Matrix<Real>& x,
         Matrix<Real>& y, 
         Matrix<Real>& z,
-        vector<Int>& map,
-        vector<Int>& invMap,
-        ldl::Separator& rootSep,
-        ldl::NodeInfo& info,
+        ldl::FactorizationPlan<Real>& plan,
   bool primalInit, bool dualInit, bool standardShift, 
   const RegSolveCtrl<Real>& solveCtrl );
 template<typename Real>
@@ -55,13 +52,7 @@ void Initialize
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y, 
         DistMultiVec<Real>& z, 
-        DistMap& map,
-        DistMap& invMap,
-        ldl::DistSeparator& rootSep,
-        ldl::DistNodeInfo& info,
-        vector<Int>& mappedSources, 
-        vector<Int>& mappedTargets,
-        vector<Int>& colOffs,
+        ldl::DistFactorizationPlan<Real>& plan,
   bool primalInit, bool dualInit, bool standardShift,
   const RegSolveCtrl<Real>& solveCtrl );
 
@@ -296,10 +296,7 @@ void Initialize
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
-        vector<Int>& map,
-        vector<Int>& invMap, 
-        ldl::Separator& rootSep,
-        ldl::NodeInfo& info,
+        ldl::FactorizationPlan<Real>& plan,
   bool primalInit,
   bool dualInit,
   bool standardShift,  
@@ -310,7 +307,7 @@ void Initialize
     SparseMatrix<Real> Q;
     Q.Resize( n, n );
     qp::direct::Initialize
-    ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
+    ( Q, A, b, c, x, y, z, plan,
       primalInit, dualInit, standardShift, solveCtrl );
 }
 
@@ -322,13 +319,7 @@ void Initialize
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
-        DistMap& map,
-        DistMap& invMap, 
-        ldl::DistSeparator& rootSep,
-        ldl::DistNodeInfo& info,
-        vector<Int>& mappedSources,
-        vector<Int>& mappedTargets,
-        vector<Int>& colOffs,
+        ldl::DistFactorizationPlan<Real>& plan,
   bool primalInit,
   bool dualInit,
   bool standardShift, 
@@ -340,8 +331,7 @@ void Initialize
     DistSparseMatrix<Real> Q(comm);
     Q.Resize( n, n );
     qp::direct::Initialize
-    ( Q, A, b, c, x, y, z, map, invMap, rootSep, info, 
-      mappedSources, mappedTargets, colOffs,
+    ( Q, A, b, c, x, y, z, plan,
       primalInit, dualInit, standardShift, solveCtrl );
 }
 
@@ -373,10 +363,7 @@ void Initialize
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
-          vector<Int>& map, \
-          vector<Int>& invMap, \
-          ldl::Separator& rootSep, \
-          ldl::NodeInfo& info, \
+          ldl::FactorizationPlan<Real>& plan, \
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
@@ -388,13 +375,7 @@ void Initialize
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
-          DistMap& map, \
-          DistMap& invMap, \
-          ldl::DistSeparator& rootSep, \
-          ldl::DistNodeInfo& info, \
-          vector<Int>& mappedSources, \
-          vector<Int>& mappedTargets, \
-          vector<Int>& colOffs, \
+          ldl::DistFactorizationPlan<Real>& plan, \
     bool primalInit, \
     bool dualInit, \
     bool standardShift, \
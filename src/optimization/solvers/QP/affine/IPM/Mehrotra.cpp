@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace qp {
@@ -49,6 +50,13 @@ void Mehrotra
 {
     DEBUG_CSE
 
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra( QPre, APre, GPre, bPre, cPre, hPre, x, y, z, s, resumeCtrl );
+        return;
+    }
+
     // TODO: Move these into the control structure
     const bool stepLengthSigma = true;
     function<Real(Real,Real,Real,Real)> centralityRule;
@@ -127,6 +135,20 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y,
+           Matrix<Real>& z, Matrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -201,6 +223,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -333,13 +356,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -358,6 +375,15 @@ void Mehrotra
 {
     DEBUG_CSE
 
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, xPre, yPre, zPre, sPre );
+        Mehrotra
+        ( QPre, APre, GPre, bPre, cPre, hPre, xPre, yPre, zPre, sPre,
+          resumeCtrl );
+        return;
+    }
+
     // TODO: Move these into the control structure
     const bool stepLengthSigma = true;
     function<Real(Real,Real,Real,Real)> centralityRule;
@@ -485,6 +511,20 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid);
     dzError.AlignWith( s );
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMatrix<Real>& x, DistMatrix<Real>& y,
+           DistMatrix<Real>& z, DistMatrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -560,6 +600,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -719,13 +760,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -743,6 +778,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra( QPre, APre, GPre, bPre, cPre, hPre, x, y, z, s, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -854,6 +897,20 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y,
+           Matrix<Real>& z, Matrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -933,6 +990,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1109,13 +1167,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -1133,6 +1185,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra( QPre, APre, GPre, bPre, cPre, hPre, x, y, z, s, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -1286,6 +1346,20 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+           DistMultiVec<Real>& z, DistMultiVec<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1369,6 +1443,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without "
@@ -1571,13 +1646,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+    unequilibrate( x, y, z, s );
 }
 
 #define PROTO(Real) \
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace qp {
@@ -45,6 +46,13 @@ void Mehrotra
 {
     DEBUG_CSE
 
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z );
+        Mehrotra( QPre, APre, bPre, cPre, x, y, z, resumeCtrl );
+        return;
+    }
+
     const bool stepLengthSigma = true;
     const bool standardShift = true;
     function<Real(Real,Real,Real,Real)> centralityRule;
@@ -110,6 +118,18 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -174,6 +194,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -371,12 +392,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-    }
+    unequilibrate( x, y, z );
 }
 
 template<typename Real>
@@ -392,6 +408,13 @@ void Mehrotra
 {
     DEBUG_CSE
 
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, xPre, yPre, zPre );
+        Mehrotra( QPre, APre, bPre, cPre, xPre, yPre, zPre, resumeCtrl );
+        return;
+    }
+
     const bool stepLengthSigma = true;
     const bool standardShift = true;
     function<Real(Real,Real,Real,Real)> centralityRule;
@@ -494,6 +517,18 @@ void Mehrotra
     DistPermutation p(grid);
     DistMatrix<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
     dzError.AlignWith( dz );
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMatrix<Real>& x, DistMatrix<Real>& y, DistMatrix<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -559,6 +594,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -757,12 +793,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-    }
+    unequilibrate( x, y, z );
 }
 
 template<typename Real>
@@ -777,6 +808,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z );
+        Mehrotra( QPre, APre, bPre, cPre, x, y, z, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     const bool stepLengthSigma = true;
@@ -840,9 +879,13 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    // Reuse the caller's factorization plan (if one was provided) so that the
+    // analysis of the KKT sparsity pattern persists across solves
+    ldl::FactorizationPlan<Real> localPlan;
+    auto& plan = ( ctrl.plan == nullptr ? localPlan : *ctrl.plan );
+    const auto& invMap = plan.invMap;
+    const auto& info = plan.info;
+    auto& JFront = plan.front;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -850,16 +893,14 @@ void Mehrotra
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
+        ( Q, A, b, c, x, y, z, plan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }  
     else
     {
-        vector<Int> augMap, augInvMap;
-        ldl::NodeInfo augInfo;
-        ldl::Separator augRootSep;
+        ldl::FactorizationPlan<Real> augPlan;
         Initialize
-        ( Q, A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
+        ( Q, A, b, c, x, y, z, augPlan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
 
@@ -886,7 +927,6 @@ void Mehrotra
     regTmp *= origTwoNormEst;
 
     SparseMatrix<Real> J, JOrig;
-    ldl::Front<Real> JFront;
     Matrix<Real> d, 
                  w,
                  rc,    rb,    rmu, 
@@ -896,6 +936,18 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y, Matrix<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -965,6 +1017,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1009,16 +1062,7 @@ void Mehrotra
                 else
                     Ones( dInner, J.Height(), 1 );
 
-                if( numIts == 0 && 
-                    (ctrl.system == FULL_KKT || 
-                     (ctrl.primalInit && ctrl.dualInit) ) )
-                {
-                    NestedDissection( J.LockedGraph(), map, rootSep, info );
-                    InvertMap( map, invMap );
-                }
-                JFront.Pull( J, map, info );
-
-                LDL( info, JFront, LDL_2D );
+                plan.Factor( J );
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, 
@@ -1199,12 +1243,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-    }
+    unequilibrate( x, y, z );
 }
 
 template<typename Real>
@@ -1219,6 +1258,14 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z );
+        Mehrotra( QPre, APre, bPre, cPre, x, y, z, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     const bool stepLengthSigma = true;
@@ -1297,10 +1344,13 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    vector<Int> mappedSources, mappedTargets, colOffs;
+    // Reuse the caller's factorization plan (if one was provided) so that the
+    // analysis of the KKT sparsity pattern persists across solves
+    ldl::DistFactorizationPlan<Real> localPlan;
+    auto& plan = ( ctrl.distPlan == nullptr ? localPlan : *ctrl.distPlan );
+    const auto& invMap = plan.invMap;
+    const auto& info = plan.info;
+    auto& JFront = plan.front;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
@@ -1310,19 +1360,14 @@ void Mehrotra
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
-        ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
-          mappedSources, mappedTargets, colOffs,
+        ( Q, A, b, c, x, y, z, plan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl ); 
     }  
     else
     {
-        DistMap augMap, augInvMap;
-        ldl::DistNodeInfo augInfo;
-        ldl::DistSeparator augRootSep;
-        vector<Int> augMappedSources, augMappedTargets, augColOffs;
+        ldl::DistFactorizationPlan<Real> augPlan;
         Initialize
-        ( Q, A, b, c, x, y, z, augMap, augInvMap, augRootSep, augInfo,
-          augMappedSources, augMappedTargets, augColOffs,
+        ( Q, A, b, c, x, y, z, augPlan,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
     if( commRank == 0 && ctrl.time )
@@ -1354,7 +1399,6 @@ void Mehrotra
 
     DistSparseMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
-    ldl::DistFront<Real> JFront;
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
@@ -1365,6 +1409,18 @@ void Mehrotra
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMultiVec<Real>& x, DistMultiVec<Real>& y, DistMultiVec<Real>& z )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol, x );
+          DiagonalSolve( LEFT, NORMAL, dRow, y );
+          DiagonalScale( LEFT, NORMAL, dCol, z );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1433,6 +1489,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1484,21 +1541,18 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( ctrl.system == FULL_KKT || 
-                        (ctrl.primalInit && ctrl.dualInit) )
-                    {
-                        if( commRank == 0 && ctrl.time )
-                            timer.Start();
-                        NestedDissection
-                        ( J.LockedDistGraph(), map, rootSep, info );
-                        if( commRank == 0 && ctrl.time )
-                            Output("ND: ",timer.Stop()," secs");
-                        InvertMap( map, invMap );
-                    }
                 }
                 else
                     J.multMeta = meta;
 
+                // Only analyze J if its sparsity pattern is new to the plan
+                if( commRank == 0 && ctrl.time )
+                    timer.Start();
+                if( plan.Analyze( J ) )
+                    dmvMeta = ldl::DistMultiVecNodeMeta();
+                if( commRank == 0 && ctrl.time )
+                    Output("Analysis: ",timer.Stop()," secs");
+
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
                 if( wMaxNorm >= ctrl.ruizEquilTol )
@@ -1512,8 +1566,8 @@ void Mehrotra
                     Output("Equilibration: ",timer.Stop()," secs");
 
                 JFront.Pull
-                ( J, map, rootSep, info, 
-                  mappedSources, mappedTargets, colOffs );
+                ( J, plan.map, plan.rootSep, info,
+                  plan.mappedSources, plan.mappedTargets, plan.colOffs );
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
@@ -1713,12 +1767,7 @@ void Mehrotra
     }
     SetIndent( indent );
 
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol, x );
-        DiagonalSolve( LEFT, NORMAL, dRow, y );
-        DiagonalScale( LEFT, NORMAL, dCol, z );
-    }
+    unequilibrate( x, y, z );
 }
 
 #define PROTO(Real) \
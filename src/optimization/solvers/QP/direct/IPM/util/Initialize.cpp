@@ -295,10 +295,7 @@ void Initialize
         Matrix<Real>& x,
         Matrix<Real>& y,
         Matrix<Real>& z,
-        vector<Int>& map,
-        vector<Int>& invMap, 
-        ldl::Separator& rootSep,
-        ldl::NodeInfo& info,
+        ldl::FactorizationPlan<Real>& plan,
   bool primalInit, bool dualInit, bool standardShift, 
   const RegSolveCtrl<Real>& solveCtrl )
 {
@@ -349,12 +346,7 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    NestedDissection( J.LockedGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
-
-    ldl::Front<Real> JFront;
-    JFront.Pull( J, map, info );
-    LDL( info, JFront, LDL_2D );
+    plan.Factor( J );
 
     // Compute the proposed step from the KKT system
     // ---------------------------------------------
@@ -375,7 +367,7 @@ void Initialize
         AugmentedKKTRHS( ones, rc, rb, rmu, d );
 
         reg_ldl::RegularizedSolveAfter
-        ( JOrig, reg, invMap, info, JFront, d,
+        ( JOrig, reg, plan.invMap, plan.info, plan.front, d,
           solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
 
         ExpandAugmentedSolution( ones, ones, rmu, d, x, u, v );
@@ -391,7 +383,7 @@ void Initialize
         AugmentedKKTRHS( ones, rc, rb, rmu, d );
 
         reg_ldl::RegularizedSolveAfter
-        ( JOrig, reg, invMap, info, JFront, d,
+        ( JOrig, reg, plan.invMap, plan.info, plan.front, d,
           solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
 
         ExpandAugmentedSolution( ones, ones, rmu, d, z, y, u );
@@ -440,13 +432,7 @@ void Initialize
         DistMultiVec<Real>& x,
         DistMultiVec<Real>& y,
         DistMultiVec<Real>& z,
-        DistMap& map,
-        DistMap& invMap, 
-        ldl::DistSeparator& rootSep,
-        ldl::DistNodeInfo& info,
-        vector<Int>& mappedSources,
-        vector<Int>& mappedTargets,
-        vector<Int>& colOffs,
+        ldl::DistFactorizationPlan<Real>& plan,
   bool primalInit, bool dualInit, bool standardShift, 
   const RegSolveCtrl<Real>& solveCtrl )
 {
@@ -499,12 +485,7 @@ void Initialize
     }
     UpdateRealPartOfDiagonal( J, Real(1), reg );
 
-    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
-
-    ldl::DistFront<Real> JFront;
-    JFront.Pull( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
-    LDL( info, JFront, LDL_2D );
+    plan.Factor( J );
 
     // Compute the proposed step from the KKT system
     // ---------------------------------------------
@@ -525,7 +506,7 @@ void Initialize
         AugmentedKKTRHS( ones, rc, rb, rmu, d );
 
         reg_ldl::RegularizedSolveAfter
-        ( JOrig, reg, invMap, info, JFront, d,
+        ( JOrig, reg, plan.invMap, plan.info, plan.front, d,
           solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
 
         ExpandAugmentedSolution( ones, ones, rmu, d, x, u, v );
@@ -541,7 +522,7 @@ void Initialize
         AugmentedKKTRHS( ones, rc, rb, rmu, d );
 
         reg_ldl::RegularizedSolveAfter
-        ( JOrig, reg, invMap, info, JFront, d,
+        ( JOrig, reg, plan.invMap, plan.info, plan.front, d,
           solveCtrl.relTol, solveCtrl.maxRefineIts, solveCtrl.progress );
 
         ExpandAugmentedSolution( ones, ones, rmu, d, z, y, u );
@@ -608,10 +589,7 @@ void Initialize
           Matrix<Real>& x, \
           Matrix<Real>& y, \
           Matrix<Real>& z, \
-          vector<Int>& map, \
-          vector<Int>& invMap, \
-          ldl::Separator& rootSep, \
-          ldl::NodeInfo& info, \
+          ldl::FactorizationPlan<Real>& plan, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl ); \
   template void Initialize \
@@ -622,13 +600,7 @@ void Initialize
           DistMultiVec<Real>& x, \
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
-          DistMap& map, \
-          DistMap& invMap, \
-          ldl::DistSeparator& rootSep, \
-          ldl::DistNodeInfo& info, \
-          vector<Int>& mappedSources, \
-          vector<Int>& mappedTargets, \
-          vector<Int>& colOffs, \
+          ldl::DistFactorizationPlan<Real>& plan, \
     bool primalInit, bool dualInit, bool standardShift, \
     const RegSolveCtrl<Real>& solveCtrl );
 
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../Checkpoint.hpp"
 
 namespace El {
 namespace socp {
@@ -49,6 +50,16 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra
+        ( APre, GPre, bPre, cPre, hPre, orders, firstInds, x, y, z, s,
+          resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
 
     // TODO: Move these into the control structure
@@ -124,6 +135,20 @@ void Mehrotra
     Matrix<Real> dSub;
     Permutation p;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y,
+           Matrix<Real>& z, Matrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -192,6 +217,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Reached maximum number of iterations, ",ctrl.maxIts,
@@ -366,13 +392,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -391,6 +412,16 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, xPre, yPre, zPre, sPre );
+        Mehrotra
+        ( APre, GPre, bPre, cPre, hPre, ordersPre, firstIndsPre, xPre, yPre,
+          zPre, sPre, resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
     const bool onlyLower = true;
 
@@ -499,6 +530,20 @@ void Mehrotra
     DistMatrix<Real> 
       dxError(grid), dyError(grid), dzError(grid), dmuError(grid);
     dzError.AlignWith( s );
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMatrix<Real>& x, DistMatrix<Real>& y,
+           DistMatrix<Real>& z, DistMatrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -567,6 +612,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Reached maximum number of iterations, ",ctrl.maxIts,
@@ -752,13 +798,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -777,6 +818,16 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra
+        ( APre, GPre, bPre, cPre, hPre, orders, firstInds, x, y, z, s,
+          resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
     const bool onlyLower = false;
 
@@ -922,6 +973,20 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( Matrix<Real>& x, Matrix<Real>& y,
+           Matrix<Real>& z, Matrix<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -989,6 +1054,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Reached maximum number of iterations, ",ctrl.maxIts,
@@ -1213,13 +1279,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+
+    unequilibrate( x, y, z, s );
 }
 
 template<typename Real>
@@ -1238,6 +1299,16 @@ void Mehrotra
   const MehrotraCtrl<Real>& ctrl )
 {
     DEBUG_CSE
+
+    if( ctrl.checkpoint.resume )
+    {
+        auto resumeCtrl = ipm::ResumeCtrl( ctrl, x, y, z, s );
+        Mehrotra
+        ( APre, GPre, bPre, cPre, hPre, orders, firstInds, x, y, z, s,
+          resumeCtrl );
+        return;
+    }
+
     const Real eps = limits::Epsilon<Real>();
     const bool onlyLower = false;
 
@@ -1431,6 +1502,20 @@ void Mehrotra
     DistMultiVec<Real> dxError(comm), dyError(comm), 
                        dzError(comm), dmuError(comm);
     ldl::DistMultiVecNodeMeta dmvMeta;
+
+    // Map an iterate back to the original scaling of the problem
+    auto unequilibrate =
+      [&]( DistMultiVec<Real>& x, DistMultiVec<Real>& y,
+           DistMultiVec<Real>& z, DistMultiVec<Real>& s )
+      {
+          if( !ctrl.outerEquil )
+              return;
+          DiagonalSolve( LEFT, NORMAL, dCol,  x );
+          DiagonalSolve( LEFT, NORMAL, dRowA, y );
+          DiagonalSolve( LEFT, NORMAL, dRowG, z );
+          DiagonalScale( LEFT, NORMAL, dRowG, s );
+      };
+
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1502,6 +1587,7 @@ void Mehrotra
         }
         if( relError <= ctrl.targetTol )
             break;
+        ipm::MaybeCheckpoint( ctrl, numIts, unequilibrate, x, y, z, s );
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Reached maximum number of iterations, ",ctrl.maxIts,
@@ -1805,13 +1891,8 @@ void Mehrotra
         }
     }
     SetIndent( indent );
-    if( ctrl.outerEquil )
-    {
-        DiagonalSolve( LEFT, NORMAL, dCol,  x );
-        DiagonalSolve( LEFT, NORMAL, dRowA, y );
-        DiagonalSolve( LEFT, NORMAL, dRowG, z );
-        DiagonalScale( LEFT, NORMAL, dRowG, s );
-    }
+
+    unequilibrate( x, y, z, s );
 }
 
 #define PROTO(Real) \
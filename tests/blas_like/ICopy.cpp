@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that a non-blocking redistribution of A matches the blocking one
+template<typename T,Dist U,Dist V,Dist UB,Dist VB>
+void TestRedist( const DistMatrix<T,U,V>& A, bool useTest )
+{
+    DistMatrix<T,UB,VB> B(A.Grid()), BRef(A.Grid());
+    CopyRequest<T> request;
+    ICopy( A, B, request );
+    if( useTest )
+    {
+        while( !request.Test() );
+    }
+    else
+        request.Wait();
+    if( request.Active() )
+        LogicError("Request was still active after completion");
+    BRef = A;
+
+    DistMatrix<T,STAR,STAR> B_STAR_STAR(B), BRef_STAR_STAR(BRef);
+    B_STAR_STAR.Matrix() -= BRef_STAR_STAR.Matrix();
+    const Base<T> error = MaxNorm( B_STAR_STAR.Matrix() );
+    if( error != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] -> [",DistToString(UB),
+         ",",DistToString(VB),"] had an error of ",error);
+}
+
+template<typename T>
+void TestICopy( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    // Gather within the row, column, and entire process grid
+    TestRedist<T,MC,MR,MC,STAR>( A, false );
+    TestRedist<T,MC,MR,STAR,MR>( A, true );
+    TestRedist<T,MC,MR,STAR,STAR>( A, false );
+    // Fall back to a blocking redistribution
+    TestRedist<T,MC,MR,VC,STAR>( A, true );
+
+    // Gather within partial communicators
+    DistMatrix<T,STAR,VR> A_STAR_VR(A);
+    TestRedist<T,STAR,VR,STAR,MR>( A_STAR_VR, false );
+    DistMatrix<T,VC,STAR> A_VC_STAR(A);
+    TestRedist<T,VC,STAR,MC,STAR>( A_VC_STAR, true );
+    TestRedist<T,VC,STAR,STAR,STAR>( A_VC_STAR, false );
+
+    // Gather a misaligned submatrix into a constrained target, which requires
+    // falling back to a blocking redistribution
+    auto ASub = A( IR(1,m), IR(1,n) );
+    DistMatrix<T,MC,STAR> ASub_MC_STAR(g);
+    ASub_MC_STAR.AlignCols( Mod(ASub.ColAlign()+1,g.Height()) );
+    DistMatrix<T,MC,STAR> ASubRef_MC_STAR(ASub);
+    CopyRequest<T> request;
+    ICopy( ASub, ASub_MC_STAR, request );
+    request.Wait();
+    DistMatrix<T,STAR,STAR> ASub_STAR_STAR(ASub_MC_STAR),
+                            ASubRef_STAR_STAR(ASubRef_MC_STAR);
+    ASub_STAR_STAR.Matrix() -= ASubRef_STAR_STAR.Matrix();
+    if( MaxNorm(ASub_STAR_STAR.Matrix()) != Base<T>(0) )
+        LogicError("Misaligned redistribution failed");
+
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",29);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestICopy<float>( g, m, n );
+        TestICopy<Complex<float>>( g, m, n );
+        TestICopy<double>( g, m, n );
+        TestICopy<Complex<double>>( g, m, n );
+#ifdef EL_HAVE_QD
+        TestICopy<DoubleDouble>( g, m, n );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Fill each local row with entries in the columns i, i+stride, i+2*stride, ...
+// (modulo the width) so that a large stride spreads the columns over every
+// process while a stride of one only couples neighboring processes
+template<typename F>
+void StridedPattern
+( DistSparseMatrix<F>& A, Int m, Int n, Int numPerRow, Int stride )
+{
+    A.Resize( m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( localHeight*numPerRow );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int k=0; k<numPerRow; ++k )
+            A.QueueLocalUpdate( iLoc, (i+k*stride) % n, SampleUniform<F>() );
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename F>
+void TestMultiply
+( const Grid& g, const DistSparseMatrix<F>& A, Orientation orientation,
+  Int numRHS, const string& msg )
+{
+    typedef Base<F> Real;
+    mpi::Comm comm = A.Comm();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int xHeight = ( orientation == NORMAL ? n : m );
+    const Int yHeight = ( orientation == NORMAL ? m : n );
+    const F alpha = SampleUniform<F>();
+    const F beta = SampleUniform<F>();
+
+    DistMultiVec<F> X(comm), Y(comm);
+    Uniform( X, xHeight, numRHS );
+    Uniform( Y, yHeight, numRHS );
+
+    DistMatrix<F> ADense(g), XDense(g), YDense(g);
+    Copy( A, ADense );
+    Copy( X, XDense );
+    Copy( Y, YDense );
+    Gemm( orientation, NORMAL, alpha, ADense, XDense, beta, YDense );
+
+    // The first product forms the communication metadata and the second
+    // reuses it
+    for( Int trial=0; trial<2; ++trial )
+    {
+        DistMultiVec<F> Z(comm);
+        Z = Y;
+        Multiply( orientation, alpha, A, X, beta, Z );
+
+        DistMatrix<F> E(g);
+        Copy( Z, E );
+        E -= YDense;
+        const Real relError = FrobeniusNorm(E) / FrobeniusNorm(YDense);
+        const Real tol = Real(10*Max(m,n))*limits::Epsilon<Real>();
+        OutputFromRoot
+        (comm,msg," trial ",trial,": || Y - YRef ||_F / || YRef ||_F = ",
+         relError);
+        if( !(relError <= tol) )
+            LogicError(msg," did not match the dense product");
+    }
+}
+
+template<typename F>
+void TestSparseMultiply
+( const Grid& g, Int m, Int n, Int numPerRow, Int numRHS )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    const Orientation orientations[] = { NORMAL, TRANSPOSE, ADJOINT };
+    DistSparseMatrix<F> A(g.Comm());
+
+    // Every process exchanges ghost entries with every other
+    StridedPattern( A, m, n, numPerRow, n/numPerRow+1 );
+    for( const Orientation orientation : orientations )
+        TestMultiply
+        ( g, A, orientation, numRHS,
+          "Spread "+string(1,OrientationToChar(orientation)) );
+
+    // Only neighboring processes exchange ghost entries, and some processes
+    // may own all of the columns that they require
+    StridedPattern( A, m, n, numPerRow, 1 );
+    for( const Orientation orientation : orientations )
+        TestMultiply
+        ( g, A, orientation, numRHS,
+          "Banded "+string(1,OrientationToChar(orientation)) );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",150);
+        const Int numPerRow = Input("--numPerRow","entries per row",5);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSparseMultiply<double>( g, m, n, numPerRow, numRHS );
+        TestSparseMultiply<Complex<double>>( g, m, n, numPerRow, numRHS );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_MPC
+void CheckEqual( const Matrix<BigFloat>& A, const Matrix<BigFloat>& B,
+                 const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": dimensions did not match");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                LogicError(msg,": entry (",i,",",j,") did not match");
+}
+
+void TestArena( Int m, Int n )
+{
+    Output("Testing arena-backed BigFloat matrices");
+    PushIndent();
+    const mpfr_prec_t prec = mpfr::Precision();
+
+    Matrix<BigFloat> AHeap;
+    Uniform( AHeap, m, n );
+
+    mpfr::SetContiguousLimbs( true );
+    Matrix<BigFloat> A( m, n );
+    A = AHeap;
+    CheckEqual( A, AHeap, "Copy into arena" );
+
+    // Every entry should use the arena, with the limbs of consecutive entries
+    // adjacent to one another
+    const size_t numLimbs = A(0,0).NumLimbs();
+    const mp_limb_t* limbs = A.LockedBuffer()->LockedPointer()->_mpfr_d;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            const BigFloat& alpha = A(i,j);
+            if( alpha.OwnsLimbs() )
+                LogicError("Entry (",i,",",j,") did not use the arena");
+            if( alpha.LockedPointer()->_mpfr_d !=
+                limbs+(i+j*A.LDim())*numLimbs )
+                LogicError("Limbs of entry (",i,",",j,") were not adjacent");
+        }
+    Output("Allocation passed");
+
+    // Arithmetic over the arena should match that over separate limbs
+    Matrix<BigFloat> C, CHeap;
+    Gemm( NORMAL, TRANSPOSE, BigFloat(1), A, A, C );
+    Gemm( NORMAL, TRANSPOSE, BigFloat(1), AHeap, AHeap, CHeap );
+    CheckEqual( C, CHeap, "Gemm" );
+
+    // Moving out of the arena copies the value into limbs of its own, and
+    // moving into the arena keeps the arena slot
+    const BigFloat a00 = AHeap(0,0);
+    BigFloat beta( std::move(A(0,0)) );
+    if( !beta.OwnsLimbs() || beta != a00 )
+        LogicError("Move construction out of the arena failed");
+    A(0,0) = BigFloat(3);
+    if( A(0,0).OwnsLimbs() || A(0,0) != BigFloat(3) )
+        LogicError("Move assignment into the arena failed");
+    BigFloat gamma( 7 );
+    gamma = std::move(A(0,0));
+    if( !gamma.OwnsLimbs() || gamma != BigFloat(3) ||
+        A(0,0).LockedPointer()->_mpfr_d != limbs )
+        LogicError("Move assignment out of the arena failed");
+    A(0,0) = a00;
+    Output("Moves passed");
+
+    // Lowering the precision reuses the slot, while raising it spills the
+    // entry into limbs of its own
+    BigFloat& alpha = A(1,0);
+    alpha.SetPrecision( prec/2 );
+    if( alpha.OwnsLimbs() )
+        LogicError("Lowering the precision left the arena");
+    alpha = AHeap(1,0);
+    alpha.SetPrecision( 2*prec );
+    if( !alpha.OwnsLimbs() || alpha.Precision() != 2*prec )
+        LogicError("Raising the precision did not spill from the arena");
+    alpha = AHeap(1,0);
+    if( alpha != AHeap(1,0) )
+        LogicError("Spilled entry did not hold its value");
+    alpha.SetPrecision( prec );
+    alpha = AHeap(1,0);
+    Output("Precision changes passed");
+
+    // Serialization round-trips between arena-backed and separate limbs
+    vector<byte> packed;
+    Serialize( m*n, A.LockedBuffer(), packed );
+    Matrix<BigFloat> B( m, n );
+    Deserialize( m*n, packed, B.Buffer() );
+    CheckEqual( B, AHeap, "Serialization within the arena" );
+    mpfr::SetContiguousLimbs( false );
+    Matrix<BigFloat> BHeap( m, n );
+    Deserialize( m*n, packed, BHeap.Buffer() );
+    CheckEqual( BHeap, AHeap, "Serialization out of the arena" );
+    Output("Serialization passed");
+
+    PopIndent();
+}
+#endif
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",20);
+        const Int n = Input("--width","width of matrix",10);
+#ifdef EL_HAVE_MPC
+        const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
+#endif
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MPC
+        mpfr::SetPrecision( prec );
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+            TestArena( m, n );
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": dimensions did not match");
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    B_STAR_STAR.Matrix() -= A_STAR_STAR.Matrix();
+    const Base<T> error = MaxNorm( B_STAR_STAR.Matrix() );
+    if( error != Base<T>(0) )
+        LogicError(msg,": round-trip had an error of ",error);
+}
+
+// Write A collectively and read it back into a matrix with distribution B
+template<typename T>
+void RoundTrip
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B,
+  FileFormat format, const string& basename, const string& msg )
+{
+    Write( A, basename, format );
+    const string filename = basename + "." + FileExtension(format);
+    // BINARY_FLAT files do not store their dimensions
+    if( format == BINARY_FLAT )
+        B.Resize( A.Height(), A.Width() );
+    else
+        B.Resize( 0, 0 );
+    Read( B, filename, format );
+    CheckEqual( A, B, msg );
+}
+
+template<typename T>
+void TestBinaryIO
+( const Grid& g, Int m, Int n, Int mb, Int nb, const string& basename )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,MC,MR,BLOCK> ABlock( g, mb, nb );
+    ABlock = A;
+
+    const FileFormat formats[] = { BINARY, BINARY_FLAT };
+    for( const FileFormat format : formats )
+    {
+        DistMatrix<T> B(g);
+        RoundTrip( A, B, format, basename, "[MC,MR] -> [MC,MR]" );
+
+        // The reader and writer need not use the same distribution
+        DistMatrix<T,VR,STAR> B_VR_STAR(g);
+        RoundTrip( A, B_VR_STAR, format, basename, "[MC,MR] -> [VR,STAR]" );
+        DistMatrix<T,STAR,VC> B_STAR_VC(g);
+        RoundTrip
+        ( B_VR_STAR, B_STAR_VC, format, basename, "[VR,STAR] -> [STAR,VC]" );
+
+        // Submatrices and misaligned matrices have non-trivial local layouts
+        auto ASub = A( IR(1,m), IR(2,n) );
+        DistMatrix<T,MR,MC> B_MR_MC(g);
+        B_MR_MC.Align( Min(1,g.Width()-1), Min(1,g.Height()-1) );
+        RoundTrip( ASub, B_MR_MC, format, basename, "Submatrix -> [MR,MC]" );
+
+        // Block distributions are described by runs of rows
+        DistMatrix<T,MC,MR,BLOCK> BBlock( g, mb, nb );
+        RoundTrip( ABlock, BBlock, format, basename, "Block -> Block" );
+        RoundTrip( ABlock, B, format, basename, "Block -> [MC,MR]" );
+    }
+
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",47);
+        const Int n = Input("--width","width of matrix",31);
+        const Int mb = Input("--mb","block height",3);
+        const Int nb = Input("--nb","block width",5);
+        const string basename =
+          Input("--basename","basename of scratch file","BinaryIO-test");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestBinaryIO<float>( g, m, n, mb, nb, basename );
+        TestBinaryIO<Complex<float>>( g, m, n, mb, nb, basename );
+        TestBinaryIO<double>( g, m, n, mb, nb, basename );
+        TestBinaryIO<Complex<double>>( g, m, n, mb, nb, basename );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
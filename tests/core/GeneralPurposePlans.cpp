@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+void CheckEqual
+( const AbstractDistMatrix<double>& A, const AbstractDistMatrix<double>& B,
+  const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": dimensions did not match");
+    DistMatrix<double,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    B_STAR_STAR.Matrix() -= A_STAR_STAR.Matrix();
+    const double error = MaxNorm( B_STAR_STAR.Matrix() );
+    if( error != 0. )
+        LogicError(msg,": redistribution had an error of ",error);
+}
+
+void CheckNumPlans( Int numPlans, const string& msg )
+{
+    if( copy::NumGeneralPurposePlans() != numPlans )
+        LogicError
+        (msg,": expected ",numPlans," cached plans but found ",
+         copy::NumGeneralPurposePlans());
+}
+
+bool IsCached
+( const AbstractDistMatrix<double>& A, const AbstractDistMatrix<double>& B )
+{
+    return copy::FindGeneralPurposePlan
+           ( A.Height(), A.Width(), DistData(A), DistData(B) ) != nullptr;
+}
+
+void TestPlanCache( mpi::Comm comm, Int m, Int n )
+{
+    OutputFromRoot(comm,"Testing the reuse and eviction of plans");
+    const Int cacheSize = copy::GeneralPurposePlanCacheSize();
+    copy::ClearGeneralPurposePlans();
+    copy::SetGeneralPurposePlanCacheSize( 2 );
+
+    const Grid g( comm );
+    DistMatrix<double> A(g), ASmall(g);
+    Uniform( A, m, n );
+    Uniform( ASmall, m/2, n/2 );
+
+    DistMatrix<double,VR,STAR> B_VR_STAR(g);
+    copy::GeneralPurpose( A, B_VR_STAR );
+    CheckNumPlans( 1, "First redistribution" );
+    CheckEqual( A, B_VR_STAR, "First redistribution" );
+
+    // Repeating the redistribution reuses the plan
+    A *= 2.;
+    copy::GeneralPurpose( A, B_VR_STAR );
+    CheckNumPlans( 1, "Repeated redistribution" );
+    CheckEqual( A, B_VR_STAR, "Repeated redistribution" );
+
+    DistMatrix<double,STAR,VC> B_STAR_VC(g);
+    copy::GeneralPurpose( A, B_STAR_VC );
+    CheckNumPlans( 2, "Second distribution" );
+    CheckEqual( A, B_STAR_VC, "Second distribution" );
+
+    // A third plan evicts the least recently used one
+    DistMatrix<double,VR,STAR> BSmall_VR_STAR(g);
+    copy::GeneralPurpose( ASmall, BSmall_VR_STAR );
+    CheckNumPlans( 2, "Third plan" );
+    CheckEqual( ASmall, BSmall_VR_STAR, "Third plan" );
+    if( IsCached( A, B_VR_STAR ) )
+        LogicError("The least recently used plan was not evicted");
+    if( !IsCached( A, B_STAR_VC ) )
+        LogicError("A recently used plan was evicted");
+
+    // Queries do not count as uses, since they need not be collective
+    DistMatrix<double,STAR,VC> BSmall_STAR_VC(g);
+    copy::GeneralPurpose( ASmall, BSmall_STAR_VC );
+    CheckNumPlans( 2, "Fourth plan" );
+    CheckEqual( ASmall, BSmall_STAR_VC, "Fourth plan" );
+    if( IsCached( A, B_STAR_VC ) )
+        LogicError("A query delayed the eviction of a plan");
+
+    // Plans between different grids are discarded along with either grid
+    {
+        const Grid gTrans( comm, g.Width(), ROW_MAJOR );
+        DistMatrix<double> BTrans(gTrans);
+        copy::GeneralPurpose( A, BTrans );
+        CheckNumPlans( 3, "Redistribution between grids" );
+        CheckEqual( A, BTrans, "Redistribution between grids" );
+    }
+    CheckNumPlans( 2, "Destroyed grid" );
+
+    copy::ClearGeneralPurposePlans();
+    CheckNumPlans( 0, "Cleared plans" );
+    copy::SetGeneralPurposePlanCacheSize( cacheSize );
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPlanCache( comm, m, n );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual( const Matrix<T>& A, const Matrix<T>& B, string msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": dimensions did not match");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                LogicError(msg,": entry (",i,",",j,") did not match");
+}
+
+template<typename T>
+void TestMappedFile( Int m, Int n, const string basename )
+{
+    Output("Testing with ",TypeName<T>());
+    const string filename = basename + "." + FileExtension(BINARY);
+
+    Matrix<T> A;
+    Uniform( A, m, n );
+    Write( A, basename, BINARY );
+
+    // The original contents should be visible through a read-only mapping
+    {
+        MappedFile<T> file( filename );
+        Matrix<T> AMapped;
+        file.LockedView( AMapped );
+        CheckEqual( A, AMapped, "Read-only mapping" );
+    }
+
+    // Modifications through a writable mapping should reach the file
+    {
+        MappedFile<T> file( filename, MAPPED_READ_WRITE );
+        Matrix<T> AMapped;
+        file.View( AMapped );
+        Scale( T(2), AMapped );
+        Scale( T(2), A );
+    }
+    Matrix<T> B;
+    Read( B, filename, BINARY );
+    CheckEqual( A, B, "Read-write mapping" );
+
+    // Newly-created files should be readable with Read
+    {
+        MappedFile<T> file( filename, MAPPED_CREATE, BINARY, n, m );
+        Matrix<T> AMapped;
+        file.View( AMapped );
+        Transpose( A, AMapped );
+    }
+    Read( B, filename, BINARY );
+    Matrix<T> ATrans;
+    Transpose( A, ATrans );
+    CheckEqual( ATrans, B, "Created mapping" );
+
+    // Original-revision files store their entries after a header of two
+    // Int's, which misaligns types such as Quad when Int is 32 bits, in which
+    // case the entries are copied rather than viewed in place
+    {
+        std::ofstream file( filename.c_str(), std::ios::binary );
+        const Int dims[2] = { m, n };
+        file.write( (const char*)dims, sizeof(dims) );
+        for( Int j=0; j<n; ++j )
+            file.write( (const char*)A.LockedBuffer(0,j), m*sizeof(T) );
+    }
+    {
+        MappedFile<T> file( filename, MAPPED_READ_WRITE );
+        Matrix<T> AMapped;
+        file.View( AMapped );
+        CheckEqual( A, AMapped, "Original-revision mapping" );
+        Scale( T(2), AMapped );
+        Scale( T(2), A );
+    }
+    Read( B, filename, BINARY );
+    CheckEqual( A, B, "Original-revision read-write mapping" );
+
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",50);
+        const string basename =
+          Input("--basename","basename of scratch file","MappedFile-test");
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestMappedFile<float>( m, n, basename );
+            TestMappedFile<Complex<float>>( m, n, basename );
+
+            TestMappedFile<double>( m, n, basename );
+            TestMappedFile<Complex<double>>( m, n, basename );
+
+#ifdef EL_HAVE_QUAD
+            TestMappedFile<Quad>( m, n, basename );
+            TestMappedFile<Complex<Quad>>( m, n, basename );
+#endif
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// An allocator which counts the buffers it has produced and freed
+struct CountingAllocator
+{
+    size_t numAllocs=0, numFrees=0;
+
+    AllocateFunction Allocate()
+    {
+        return [this]( size_t numBytes, size_t alignment )
+        {
+            void* buffer = nullptr;
+            if( posix_memalign( &buffer, alignment, numBytes ) != 0 )
+                throw std::bad_alloc();
+            ++numAllocs;
+            return buffer;
+        };
+    }
+
+    FreeFunction Free()
+    {
+        return [this]( void* buffer, size_t numBytes )
+        {
+            ++numFrees;
+            free( buffer );
+        };
+    }
+};
+
+void TestPooling( size_t n )
+{
+    Output("Testing pooling");
+    const size_t inUse = MemoryInUse();
+    {
+        Memory<double> mem( n );
+        if( size_t(mem.Buffer()) % MemoryAlignment() != 0 )
+            LogicError("Buffer was not aligned to ",MemoryAlignment());
+        if( MemoryInUse() < inUse+n*sizeof(double) )
+            LogicError("The buffer was not counted as in use");
+    }
+    if( MemoryInUse() != inUse )
+        LogicError("The freed buffer was still counted as in use");
+
+    // A request of the same size class should be served by the pool
+    const size_t numSystemAllocs = NumSystemAllocations();
+    {
+        Memory<double> mem( n-1 );
+    }
+    if( NumSystemAllocations() != numSystemAllocs )
+        LogicError("The pooled buffer was not reused");
+
+    ReleaseMemoryPool();
+    if( MemoryPooled() != 0 )
+        LogicError("The pool was not released");
+    Output("passed");
+}
+
+void TestAllocatorChange( size_t n )
+{
+    Output("Testing changes of the allocator");
+    CountingAllocator first, second;
+    SetAllocator( first.Allocate(), first.Free() );
+    {
+        Memory<double> live( n ), pooled( 2*n );
+        pooled.Empty();
+        if( first.numAllocs != 2 )
+            LogicError("The first allocator was not used");
+
+        // Both the live and the pooled buffer must be returned to the
+        // allocator which produced them
+        SetAllocator( second.Allocate(), second.Free() );
+        Memory<double> fresh( 2*n );
+        if( second.numAllocs != 1 )
+            LogicError("The pooled buffer outlived the change of allocator");
+    }
+    ReleaseMemoryPool();
+    if( first.numFrees != 2 || second.numFrees != 1 )
+        LogicError
+        ("Buffers were returned to the wrong allocator: ",first.numFrees,
+         " and ",second.numFrees," frees rather than 2 and 1");
+    ResetAllocator();
+    Output("passed");
+}
+
+void TestThreadPools( size_t n )
+{
+    Output("Testing the pools of worker threads");
+#ifdef EL_HYBRID
+    #pragma omp parallel
+    {
+        Memory<double> mem( n );
+    }
+#endif
+    ReleaseMemoryPools();
+    if( MemoryPooled() != 0 )
+        LogicError("The pools of the worker threads were not released");
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","number of entries per buffer",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        SetMemoryPooling( true );
+        TestPooling( n );
+        TestAllocatorChange( n );
+        TestThreadPools( n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Redistribute A into [U,V] and back into [STAR,STAR] and compare against
+// the (deterministic) entries of A
+template<typename T,Dist U,Dist V>
+void TestRedist( const DistMatrix<T>& A, const Matrix<T>& ARef )
+{
+    DistMatrix<T,U,V> B( A );
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B );
+    Matrix<T> E( B_STAR_STAR.Matrix() );
+    E -= ARef;
+    const Base<T> error = MaxNorm( E );
+    if( error != Base<T>(0) )
+        LogicError
+        ("[MC,MR] -> [",DistToString(U),",",DistToString(V),
+         "] -> [STAR,STAR] had an error of ",error);
+}
+
+template<typename T>
+void TestNodeAwareGrid( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+
+    auto fill = []( Int i, Int j ) { return T(i+2*j); };
+    Matrix<T> ARef;
+    ARef.Resize( m, n );
+    IndexDependentFill( ARef, function<T(Int,Int)>(fill) );
+    DistMatrix<T> A(g);
+    A.Resize( m, n );
+    IndexDependentFill( A, function<T(Int,Int)>(fill) );
+
+    // Gather within the process columns, rows, and the entire grid
+    TestRedist<T,MC,STAR>( A, ARef );
+    TestRedist<T,STAR,MR>( A, ARef );
+    TestRedist<T,STAR,STAR>( A, ARef );
+    // Gather within partial communicators and exchange via all-to-alls
+    TestRedist<T,VC,STAR>( A, ARef );
+    TestRedist<T,STAR,VC>( A, ARef );
+    TestRedist<T,VR,STAR>( A, ARef );
+    TestRedist<T,STAR,VR>( A, ARef );
+    TestRedist<T,MR,MC>( A, ARef );
+
+    OutputFromRoot(g.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",29);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order, true );
+        OutputFromRoot
+        (comm,"Node-aware ",g.Height()," x ",g.Width()," grid over ",
+         g.NumNodes()," node(s) of size ",g.NodeSize());
+
+        // The inner dimension of the grid must be compatible with the nodes
+        const int inner = ( colMajor ? g.Height() : g.Width() );
+        if( inner % g.NodeSize() != 0 && g.NodeSize() % inner != 0 )
+            LogicError("Grid dimensions were not node-aware");
+
+        TestNodeAwareGrid<float>( g, m, n );
+        TestNodeAwareGrid<Complex<float>>( g, m, n );
+        TestNodeAwareGrid<double>( g, m, n );
+        TestNodeAwareGrid<Complex<double>>( g, m, n );
+#ifdef EL_HAVE_QD
+        TestNodeAwareGrid<DoubleDouble>( g, m, n );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_PROFILE
+void CheckCounters
+( const string& name, Int calls, double flops, double bytesSent,
+  double bytesReceived )
+{
+    const profile::Counters counters = profile::LocalCounters( name );
+    if( counters.calls != calls )
+        LogicError
+        (name," was called ",counters.calls," times rather than ",calls);
+    if( counters.flops != flops )
+        LogicError
+        (name," recorded ",counters.flops," flops rather than ",flops);
+    if( counters.bytesSent != bytesSent ||
+        counters.bytesReceived != bytesReceived )
+        LogicError
+        (name," recorded ",counters.bytesSent," bytes sent and ",
+         counters.bytesReceived," received rather than ",bytesSent," and ",
+         bytesReceived);
+    if( counters.exclusiveTime > counters.time )
+        LogicError
+        (name," had an exclusive time of ",counters.exclusiveTime,
+         " which exceeded its inclusive time of ",counters.time);
+}
+
+void TestProfile( mpi::Comm comm, Int m, Int n, Int k )
+{
+    OutputFromRoot(comm,"Testing the profile of a known call sequence");
+    profile::Reset();
+
+    Matrix<double> A, B, C;
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Zeros( C, m, n );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+    Gemm( NORMAL, NORMAL, 1., A, B, 1., C );
+    CheckCounters( "Gemm", 2, 4.*m*n*k, 0, 0 );
+
+    Matrix<double> L, X;
+    Uniform( L, m, m );
+    ShiftDiagonal( L, double(m) );
+    Uniform( X, m, n );
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, 1., L, X );
+    CheckCounters( "Trsm", 1, double(m)*m*n, 0, 0 );
+
+    // Flops are attributed to the innermost routine, whereas the time of
+    // the enclosing routine includes that of the nested one
+    {
+        EL_PROFILE_REGION("test::Outer");
+        Gemm( NORMAL, NORMAL, 1., A, B, 1., C );
+    }
+    CheckCounters( "test::Outer", 1, 0, 0, 0 );
+    CheckCounters( "Gemm", 3, 6.*m*n*k, 0, 0 );
+    const profile::Counters outer = profile::LocalCounters( "test::Outer" );
+    if( !(outer.exclusiveTime < outer.time) )
+        LogicError("The nested Gemm was not included in the outer time");
+
+    // The MPI wrappers record their message volume
+    vector<double> sendBuf( n, 1. ), recvBuf( n );
+    mpi::AllReduce( sendBuf.data(), recvBuf.data(), n, mpi::SUM, comm );
+    CheckCounters
+    ( "mpi::AllReduce", 1, 0, n*sizeof(double), n*sizeof(double) );
+
+    // Nothing is recorded while the profile is disabled
+    profile::Disable();
+    Gemm( NORMAL, NORMAL, 1., A, B, 1., C );
+    profile::Enable();
+    CheckCounters( "Gemm", 3, 6.*m*n*k, 0, 0 );
+
+    profile::Reset();
+    CheckCounters( "Gemm", 0, 0, 0, 0 );
+    OutputFromRoot(comm,"passed");
+}
+#endif
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of C",30);
+        const Int n = Input("--n","width of C",20);
+        const Int k = Input("--k","inner dimension",10);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_PROFILE
+        TestProfile( comm, m, n, k );
+#else
+        OutputFromRoot(comm,"Elemental was not configured with EL_PROFILE");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that the counter-based random matrices are independent of the
+// distribution and of the process grid by comparing the local entries of
+// matrices drawn from the same seed against a fully-replicated copy
+
+template<typename T>
+Int CountMismatches
+( const DistMatrix<T,STAR,STAR>& AFull, const AbstractDistMatrix<T>& A )
+{
+    Int numMismatches = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( A.GetLocal(iLoc,jLoc) != AFull.GetLocal(i,j) )
+                ++numMismatches;
+        }
+    }
+    return numMismatches;
+}
+
+template<typename T>
+Int CountMismatches
+( const DistMatrix<T,STAR,STAR>& AFull, const DistMultiVec<T>& X )
+{
+    Int numMismatches = 0;
+    for( Int j=0; j<X.Width(); ++j )
+        for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+            if( X.GetLocal(iLoc,j) != AFull.GetLocal(X.GlobalRow(iLoc),j) )
+                ++numMismatches;
+    return numMismatches;
+}
+
+template<typename T>
+void TestInvariance
+( const Grid& grid, const Grid& otherGrid, Int m, Int n, bool gaussian,
+  std::uint64_t seed )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing ",(gaussian?"Gaussian":"Uniform")," with ",TypeName<T>());
+
+    auto generate = [&]( AbstractDistMatrix<T>& A )
+      {
+          SetCounterSeed( seed );
+          if( gaussian )
+              Gaussian( A, m, n );
+          else
+              Uniform( A, m, n );
+      };
+
+    DistMatrix<T,STAR,STAR> AFull(otherGrid);
+    generate( AFull );
+
+    DistMatrix<T> A(grid);
+    generate( A );
+    DistMatrix<T,VR,STAR> AVR(otherGrid);
+    generate( AVR );
+    DistMatrix<T,MC,MR,BLOCK> ABlock(grid);
+    generate( ABlock );
+
+    DistMultiVec<T> X(comm);
+    SetCounterSeed( seed );
+    if( gaussian )
+        Gaussian( X, m, n );
+    else
+        Uniform( X, m, n );
+
+    Int numMismatches = CountMismatches( AFull, A ) +
+      CountMismatches( AFull, AVR ) + CountMismatches( AFull, ABlock ) +
+      CountMismatches( AFull, X );
+    numMismatches = mpi::AllReduce( numMismatches, comm );
+    if( numMismatches != 0 )
+        LogicError(numMismatches," entries depended upon the distribution");
+
+    // Successive calls should yield different matrices
+    DistMatrix<T,STAR,STAR> BFull(otherGrid);
+    if( gaussian )
+        Gaussian( BFull, m, n );
+    else
+        Uniform( BFull, m, n );
+    if( m*n > 1 && CountMismatches( AFull, BFull ) == 0 )
+        LogicError("Successive random matrices were identical");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",37);
+        Int gridHeight = Input("--gridHeight","process grid height",0);
+        const Int seed = Input("--seed","counter-based seed",13);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( mpi::Size(comm) );
+        const Grid grid( comm, gridHeight );
+        const Grid otherGrid( comm, 1 );
+
+        for( const bool gaussian : { false, true } )
+        {
+            TestInvariance<float>( grid, otherGrid, m, n, gaussian, seed );
+            TestInvariance<double>( grid, otherGrid, m, n, gaussian, seed );
+            TestInvariance<Complex<float>>
+            ( grid, otherGrid, m, n, gaussian, seed );
+            TestInvariance<Complex<double>>
+            ( grid, otherGrid, m, n, gaussian, seed );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
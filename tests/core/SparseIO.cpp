@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <iomanip>
+#include <set>
+#include <El.hpp>
+using namespace El;
+
+// Write the lower triangle of a random sparse symmetric (or Hermitian)
+// matrix in the Matrix Market coordinate format
+template<typename T>
+void WriteMatrixMarket( Int n, Int numNonzeroPerRow, const string filename )
+{
+    const bool isComplex = IsComplex<T>::value;
+    Int numNonzero = 0;
+    ostringstream os;
+    os << std::setprecision( 17 );
+    for( Int i=0; i<n; ++i )
+    {
+        // Avoid duplicate entries so that the sums are order-independent
+        std::set<Int> cols;
+        for( Int k=0; k<numNonzeroPerRow; ++k )
+            cols.insert( SampleUniform<Int>( 0, i+1 ) );
+        for( const Int j : cols )
+        {
+            const T sample = SampleBall<T>( T(0), Base<T>(1) );
+            const T value = ( i == j ? T(RealPart(sample)) : sample );
+            os << i+1 << " " << j+1 << " " << RealPart(value);
+            if( isComplex )
+                os << " " << ImagPart(value);
+            os << "\n";
+            ++numNonzero;
+        }
+        // Comments and blank lines should be skipped
+        if( i % 7 == 0 )
+            os << "% comment\n\n";
+    }
+
+    ofstream file( filename.c_str() );
+    file << "%%MatrixMarket matrix coordinate "
+         << (isComplex ? "complex hermitian" : "real symmetric") << "\n"
+         << n << " " << n << " " << numNonzero << "\n"
+         << os.str();
+}
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const AbstractDistMatrix<T>& B, string msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": dimensions did not match");
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+    {
+        const Int j = B.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+        {
+            const Int i = B.GlobalRow(iLoc);
+            if( A.Get(i,j) != B.GetLocal(iLoc,jLoc) )
+                LogicError(msg,": entry (",i,",",j,") did not match");
+        }
+    }
+}
+
+template<typename T>
+void TestSparseIO
+( const Grid& grid, Int n, Int numNonzeroPerRow, const string basename )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    const string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    if( mpi::Rank(comm) == 0 )
+        WriteMatrixMarket<T>( n, numNonzeroPerRow, filename );
+    mpi::Barrier( comm );
+
+    // The dense reader serves as the reference
+    Matrix<T> ADense;
+    Read( ADense, filename );
+
+    SparseMatrix<T> ASeq;
+    Read( ASeq, filename );
+    DistMatrix<T,STAR,STAR> AFull(grid);
+    Copy( ASeq, AFull.Matrix() );
+    CheckEqual( ADense, AFull, "Sequential Matrix Market read" );
+
+    DistSparseMatrix<T> A(comm);
+    Read( A, filename );
+    DistMatrix<T> ADist(grid);
+    Copy( A, ADist );
+    CheckEqual( ADense, ADist, "Distributed Matrix Market read" );
+
+    // Round-trip through the binary format
+    Write( A, basename, BINARY_SPARSE );
+    mpi::Barrier( comm );
+    const string binaryName = basename + "." + FileExtension(BINARY_SPARSE);
+    DistSparseMatrix<T> B(comm);
+    Read( B, binaryName );
+    Copy( B, ADist );
+    CheckEqual( ADense, ADist, "Distributed binary read" );
+
+    SparseMatrix<T> C;
+    Read( C, binaryName );
+    Copy( C, AFull.Matrix() );
+    CheckEqual( ADense, AFull, "Sequential binary read" );
+    mpi::Barrier( comm );
+    OutputFromRoot(comm,"passed");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",200);
+        const Int numNonzeroPerRow =
+          Input("--numNonzeroPerRow","nonzeros per row of lower triangle",5);
+        const string basename =
+          Input("--basename","basename of scratch files","SparseIO-test");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestSparseIO<double>( grid, n, numNonzeroPerRow, basename );
+        TestSparseIO<Complex<double>>( grid, n, numNonzeroPerRow, basename );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A batch of matrices along with any externally-owned storage
+template<typename F>
+struct TestBatch
+{
+    MatrixBatch<F> A;
+    vector<F> storage;
+    vector<F*> pointers;
+
+    TestBatch( Int m, Int n, Int batchSize, BatchLayout layout )
+    {
+        if( layout == BATCH_POINTERS )
+        {
+            // Deliberately separate the matrices with some padding
+            const Int ldim = m+1;
+            const Int stride = ldim*n + 3;
+            storage.resize( stride*batchSize );
+            pointers.resize( batchSize );
+            for( Int b=0; b<batchSize; ++b )
+                pointers[b] = &storage[b*stride];
+            A.Attach( m, n, batchSize, pointers.data(), ldim );
+        }
+        else
+            A.Resize( m, n, batchSize, layout );
+    }
+};
+
+template<typename F>
+void CopyIn( const Matrix<F>& B, Int b, MatrixBatch<F>& A )
+{
+    for( Int j=0; j<B.Width(); ++j )
+        for( Int i=0; i<B.Height(); ++i )
+            A.Set( i, j, b, B.Get(i,j) );
+}
+
+template<typename F>
+void CopyOut( const MatrixBatch<F>& A, Int b, Matrix<F>& B )
+{
+    B.Resize( A.Height(), A.Width() );
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            B.Set( i, j, A.Get(i,j,b) );
+}
+
+template<typename F>
+void CheckClose
+( const Matrix<F>& A, const MatrixBatch<F>& B, Int b, const string& msg )
+{
+    typedef Base<F> Real;
+    Matrix<F> E;
+    CopyOut( B, b, E );
+    E -= A;
+    const Real relError = MaxNorm(E) / Max(MaxNorm(A),Real(1));
+    const Real tol = 100*A.Height()*limits::Epsilon<Real>();
+    if( relError > tol )
+        LogicError(msg,": relative error of ",relError," for matrix ",b);
+}
+
+// Return a random matrix with a dominant diagonal
+template<typename F>
+Matrix<F> Dominant( Int n )
+{
+    Matrix<F> A;
+    Uniform( A, n, n );
+    ShiftDiagonal( A, F(2*n) );
+    return A;
+}
+
+template<typename F>
+void TestBatched( Int n, Int batchSize, BatchLayout layout )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>()," and layout ",Int(layout));
+
+    // Gemm
+    {
+        const Int m = n+1, k = n+2;
+        TestBatch<F> A(m,k,batchSize,layout), B(n,k,batchSize,layout),
+                     C(m,n,batchSize,layout);
+        vector<Matrix<F>> CRef( batchSize );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            Matrix<F> ALoc, BLoc;
+            Uniform( ALoc, m, k );
+            Uniform( BLoc, n, k );
+            Uniform( CRef[b], m, n );
+            CopyIn( ALoc, b, A.A );
+            CopyIn( BLoc, b, B.A );
+            CopyIn( CRef[b], b, C.A );
+            Gemm( NORMAL, ADJOINT, F(2), ALoc, BLoc, F(-1), CRef[b] );
+        }
+        Gemm( NORMAL, ADJOINT, F(2), A.A, B.A, F(-1), C.A );
+        for( Int b=0; b<batchSize; ++b )
+            CheckClose( CRef[b], C.A, b, "Gemm" );
+    }
+
+    // Trsm
+    {
+        const Int numRHS = 3;
+        TestBatch<F> A(n,n,batchSize,layout), BLeft(n,numRHS,batchSize,layout),
+                     BRight(numRHS,n,batchSize,layout);
+        vector<Matrix<F>> XLeft( batchSize ), XRight( batchSize );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            auto ALoc = Dominant<F>( n );
+            Uniform( XLeft[b], n, numRHS );
+            Uniform( XRight[b], numRHS, n );
+            CopyIn( ALoc, b, A.A );
+            CopyIn( XLeft[b], b, BLeft.A );
+            CopyIn( XRight[b], b, BRight.A );
+            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(3), ALoc, XLeft[b] );
+            Trsm( RIGHT, UPPER, ADJOINT, UNIT, F(1), ALoc, XRight[b] );
+        }
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(3), A.A, BLeft.A );
+        Trsm( RIGHT, UPPER, ADJOINT, UNIT, F(1), A.A, BRight.A );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            CheckClose( XLeft[b], BLeft.A, b, "Left Trsm" );
+            CheckClose( XRight[b], BRight.A, b, "Right Trsm" );
+        }
+    }
+
+    // LU without and with partial pivoting
+    {
+        TestBatch<F> A(n,n,batchSize,layout), APiv(n,n,batchSize,layout);
+        vector<Matrix<F>> ARef( batchSize ), AOrig( batchSize );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            ARef[b] = Dominant<F>( n );
+            CopyIn( ARef[b], b, A.A );
+            Uniform( AOrig[b], n, n );
+            CopyIn( AOrig[b], b, APiv.A );
+            LU( ARef[b] );
+        }
+        LU( A.A );
+        Matrix<Int> pivots;
+        LU( APiv.A, pivots );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            CheckClose( ARef[b], A.A, b, "LU" );
+
+            // Check that P A = L U
+            Matrix<F> factors, L, U;
+            CopyOut( APiv.A, b, factors );
+            L = factors;
+            MakeTrapezoidal( LOWER, L );
+            FillDiagonal( L, F(1) );
+            U = factors;
+            MakeTrapezoidal( UPPER, U );
+            for( Int k=0; k<n; ++k )
+            {
+                const Int iPiv = pivots.Get(k,b);
+                if( iPiv != k )
+                    RowSwap( AOrig[b], k, iPiv );
+            }
+            Gemm( NORMAL, NORMAL, F(-1), L, U, F(1), AOrig[b] );
+            if( MaxNorm(AOrig[b]) > 100*n*limits::Epsilon<Real>() )
+                LogicError("Pivoted LU failed for matrix ",b);
+        }
+    }
+
+    // Cholesky and LDL
+    {
+        TestBatch<F> ALower(n,n,batchSize,layout), AUpper(n,n,batchSize,layout),
+                     ALDL(n,n,batchSize,layout);
+        vector<Matrix<F>> LRef( batchSize ), URef( batchSize ),
+                          LDLRef( batchSize );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            HermitianUniformSpectrum( LRef[b], n, Real(1), Real(10) );
+            URef[b] = LRef[b];
+            LDLRef[b] = LRef[b];
+            CopyIn( LRef[b], b, ALower.A );
+            CopyIn( URef[b], b, AUpper.A );
+            CopyIn( LDLRef[b], b, ALDL.A );
+            Cholesky( LOWER, LRef[b] );
+            Cholesky( UPPER, URef[b] );
+            LDL( LDLRef[b], true );
+        }
+        Cholesky( LOWER, ALower.A );
+        Cholesky( UPPER, AUpper.A );
+        LDL( ALDL.A, true );
+        for( Int b=0; b<batchSize; ++b )
+        {
+            CheckClose( LRef[b], ALower.A, b, "Lower Cholesky" );
+            CheckClose( URef[b], AUpper.A, b, "Upper Cholesky" );
+            CheckClose( LDLRef[b], ALDL.A, b, "LDL" );
+        }
+    }
+    Output("passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int n = Input("--n","size of each matrix",8);
+        const Int batchSize = Input("--batchSize","number of matrices",37);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            const BatchLayout layouts[] =
+              { BATCH_STRIDED, BATCH_POINTERS, BATCH_INTERLEAVED };
+            for( const BatchLayout layout : layouts )
+            {
+                TestBatched<float>( n, batchSize, layout );
+                TestBatched<Complex<float>>( n, batchSize, layout );
+                TestBatched<double>( n, batchSize, layout );
+                TestBatched<Complex<double>>( n, batchSize, layout );
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A one-dimensional convection-diffusion operator, which is nonsymmetric
+// but diagonally dominant
+template<typename F>
+void ConvectionDiffusion( DistSparseMatrix<F>& A, Int n, Base<F> shift )
+{
+    A.Resize( n, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, F(2+shift) );
+        if( i > 0 )
+            A.QueueLocalUpdate( iLoc, i-1, F(-1.3) );
+        if( i+1 < n )
+            A.QueueLocalUpdate( iLoc, i+1, F(-0.7) );
+    }
+    A.ProcessLocalQueues();
+}
+
+template<typename F>
+void CheckResidual
+( const DistSparseMatrix<F>& A, const DistMultiVec<F>& B,
+  const DistMultiVec<F>& X, Base<F> relTol, const string& msg )
+{
+    typedef Base<F> Real;
+    DistMultiVec<F> R(B.Comm());
+    R = B;
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    const Real relResid = FrobeniusNorm(R) / FrobeniusNorm(B);
+    OutputFromRoot(B.Comm(),msg,": || B - A X ||_F / || B ||_F = ",relResid);
+    if( !(relResid <= relTol) )
+        LogicError(msg," did not reach the requested tolerance");
+}
+
+template<typename F>
+void TestGMRES
+( mpi::Comm comm, Int n, Int numRHS, Int restart, Int maxIts )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    PushIndent();
+
+    const Real shift = 0.5;
+    const Real relTol = Pow(limits::Epsilon<Real>(),Real(0.5));
+    DistSparseMatrix<F> A(comm);
+    ConvectionDiffusion( A, n, shift );
+    DistMultiVec<F> B(comm);
+    Uniform( B, n, numRHS );
+
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    // Jacobi preconditioning, so that the pipelined recurrence for the
+    // preconditioned directions is exercised
+    auto precond = [&]( DistMultiVec<F>& W ) { W *= F(1)/F(2+shift); };
+
+    const GramSchmidtAlg algs[] =
+      { GRAM_SCHMIDT_MODIFIED,
+        GRAM_SCHMIDT_CLASSICAL_REORTH,
+        GRAM_SCHMIDT_ONE_REDUCE };
+    const string algNames[] = { "MGS", "CGS2", "one-reduce" };
+    for( Int k=0; k<3; ++k )
+    {
+        for( const bool pipeline : { false, true } )
+        {
+            const string suffix =
+              " with "+algNames[k]+(pipeline ? " (pipelined)" : "");
+
+            DistMultiVec<F> X(comm);
+            X = B;
+            const Int fgmresIts =
+              FGMRES
+              ( applyA, precond, X, relTol, restart, maxIts, false,
+                algs[k], pipeline );
+            OutputFromRoot
+            (comm,"FGMRES",suffix," took ",fgmresIts," iterations");
+            CheckResidual( A, B, X, relTol, "FGMRES"+suffix );
+
+            X = B;
+            const Int lgmresIts =
+              LGMRES
+              ( applyA, precond, X, relTol, restart, maxIts, false,
+                algs[k], pipeline );
+            OutputFromRoot
+            (comm,"LGMRES",suffix," took ",lgmresIts," iterations");
+            CheckResidual( A, B, X, relTol, "LGMRES"+suffix );
+        }
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",500);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int restart = Input("--restart","GMRES restart parameter",10);
+        const Int maxIts = Input("--maxIts","maximum iterations",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        TestGMRES<double>( comm, n, numRHS, restart, maxIts );
+        TestGMRES<Complex<double>>( comm, n, numRHS, restart, maxIts );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
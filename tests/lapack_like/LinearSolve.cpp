@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form A = X diag(sigma) Y^H, with singular values graded from one down to
+// 1/cond, so that the mixed-precision solver must fall back to the working
+// precision when cond exceeds the reciprocal of the demoted epsilon
+template<typename F>
+void GradedMatrix( DistMatrix<F>& A, Int n, Base<F> cond )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<F> X(g), Y(g);
+    Gaussian( X, n, n );
+    Gaussian( Y, n, n );
+    qr::ExplicitUnitary( X );
+    qr::ExplicitUnitary( Y );
+    DistMatrix<Real,VR,STAR> sigma( n, 1, g );
+    auto grading =
+      [&]( Int i, Int j ) { return Pow(cond,-Real(i)/Real(Max(n-1,1))); };
+    IndexDependentFill( sigma, function<Real(Int,Int)>(grading) );
+    DiagonalScale( RIGHT, NORMAL, sigma, X );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+}
+
+template<typename F>
+void CheckResidual
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& X,
+  const string& msg )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<F> R( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Real relResid =
+      InfinityNorm(R) / (InfinityNorm(A)*InfinityNorm(X)*eps*n);
+    OutputFromRoot
+    (A.Grid().Comm(),msg,": ||B - A X||_oo / (||A||_oo ||X||_oo eps n) = ",
+     relResid);
+    if( !(relResid <= Real(10)) )
+        LogicError(msg," produced an unacceptably large residual");
+}
+
+template<typename Real>
+void CheckPath
+( const LinearSolveCtrl<Real>& ctrl, bool expectFallback, const string& msg )
+{
+    if( ctrl.fellBack != expectFallback )
+        LogicError
+        (msg,( expectFallback ? " did not fall back" : " fell back" ),
+         " to the working precision");
+    if( !ctrl.fellBack && ctrl.numRefineIts == 0 )
+        LogicError(msg," did not refine the demoted solution");
+}
+
+template<typename F>
+void TestLinearSolve( const Grid& g, Int n, Int numRHS )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = true;
+
+    // The first matrix is well-conditioned relative to the demoted
+    // precision, whereas the second forces a fallback
+    const Real conds[] = { Real(10), Real(1)/limits::Epsilon<Real>() };
+    for( Int k=0; k<2; ++k )
+    {
+        const Real cond = conds[k];
+        const bool expectFallback = ( k == 1 );
+        OutputFromRoot(g.Comm(),"Condition number of ",cond);
+        DistMatrix<F> A(g), B(g), X(g);
+        GradedMatrix( A, n, cond );
+        Uniform( B, n, numRHS );
+
+        X = B;
+        LinearSolve( A, X, ctrl );
+        OutputFromRoot
+        (g.Comm(),"Distributed: fell back? ",ctrl.fellBack,", ",
+         ctrl.numRefineIts," refinement iterations");
+        CheckPath( ctrl, expectFallback, "Distributed" );
+        CheckResidual( A, B, X, "Distributed" );
+
+        DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), X_STAR_STAR( B );
+        LinearSolve( A_STAR_STAR.Matrix(), X_STAR_STAR.Matrix(), ctrl );
+        OutputFromRoot
+        (g.Comm(),"Sequential: fell back? ",ctrl.fellBack,", ",
+         ctrl.numRefineIts," refinement iterations");
+        CheckPath( ctrl, expectFallback, "Sequential" );
+        X = X_STAR_STAR;
+        CheckResidual( A, B, X, "Sequential" );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestLinearSolve<double>( g, n, numRHS );
+        TestLinearSolve<Complex<double>>( g, n, numRHS );
+#ifdef EL_HAVE_QD
+        TestLinearSolve<DoubleDouble>( g, n, numRHS );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
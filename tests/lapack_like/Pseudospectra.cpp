@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Adaptive refinement should only evaluate a fraction of the pixels (the
+// interpolated pixels are given an iteration count of zero) while placing
+// each of the epsilon-contours where the uniform window does. Pixels whose
+// estimates lie near a contour may legitimately land on either side of it,
+// so a small fraction of misclassified pixels is tolerated.
+template<typename Real>
+void CompareWindows
+( const Matrix<Real>& uniformMap,
+  const Matrix<Int>& uniformCounts,
+  const Matrix<Real>& adaptiveMap,
+  const Matrix<Int>& adaptiveCounts,
+  const vector<Real>& epsilons,
+  bool print )
+{
+    const Int realSize = uniformMap.Width();
+    const Int imagSize = uniformMap.Height();
+    const Int numPixels = realSize*imagSize;
+    Int numUniform=0, numAdaptive=0;
+    for( Int x=0; x<realSize; ++x )
+    {
+        for( Int y=0; y<imagSize; ++y )
+        {
+            if( uniformCounts(y,x) != 0 )
+                ++numUniform;
+            if( adaptiveCounts(y,x) != 0 )
+                ++numAdaptive;
+        }
+    }
+    if( print )
+        Output
+        ("Evaluated ",numAdaptive," of ",numPixels," shifts adaptively and ",
+         numUniform," uniformly");
+    if( numUniform != numPixels )
+        LogicError("The uniform window did not evaluate every shift");
+    if( numAdaptive >= numPixels )
+        LogicError("The adaptive window evaluated every shift");
+
+    for( const Real eps : epsilons )
+    {
+        const Real level = Real(1)/eps;
+        Int numMismatched=0;
+        for( Int x=0; x<realSize; ++x )
+            for( Int y=0; y<imagSize; ++y )
+                if( (uniformMap(y,x) >= level) !=
+                    (adaptiveMap(y,x) >= level) )
+                    ++numMismatched;
+        if( print )
+            Output
+            (numMismatched," pixels differed on the ",eps,"-contour");
+        if( numMismatched > numPixels/100 )
+            LogicError
+            ("The adaptive ",eps,"-contour differed in ",numMismatched,
+             " of ",numPixels," pixels");
+    }
+}
+
+template<typename Real>
+void TestPseudospectra
+( const Grid& g, Int n, Int realSize, Int imagSize, Int coarseSpacing )
+{
+    typedef Complex<Real> C;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<C>());
+    PushIndent();
+
+    // The window contains the spectrum of the Grcar matrix
+    const C center( 1.5, 0 );
+    const Real realWidth=4, imagWidth=6;
+    const vector<Real> epsilons = { Real(1e-2), Real(1e-5) };
+
+    PseudospecCtrl<Real> uniformCtrl, adaptiveCtrl;
+    adaptiveCtrl.adaptive = true;
+    adaptiveCtrl.coarseSpacing = coarseSpacing;
+    adaptiveCtrl.epsilons = epsilons;
+
+    if( g.Rank() == 0 )
+    {
+        Output("Sequential:");
+        PushIndent();
+        Matrix<C> A;
+        Grcar( A, n );
+        Matrix<Real> uniformMap, adaptiveMap;
+        auto uniformCounts =
+          SpectralWindow
+          ( A, uniformMap, center, realWidth, imagWidth, realSize, imagSize,
+            uniformCtrl );
+        auto adaptiveCounts =
+          SpectralWindow
+          ( A, adaptiveMap, center, realWidth, imagWidth, realSize, imagSize,
+            adaptiveCtrl );
+        CompareWindows
+        ( uniformMap, uniformCounts, adaptiveMap, adaptiveCounts, epsilons,
+          true );
+        PopIndent();
+    }
+
+    OutputFromRoot(g.Comm(),"Distributed:");
+    PushIndent();
+    DistMatrix<C> A(g);
+    Grcar( A, n );
+    DistMatrix<Real> uniformMap(g), adaptiveMap(g);
+    auto uniformCounts =
+      SpectralWindow
+      ( A, uniformMap, center, realWidth, imagWidth, realSize, imagSize,
+        uniformCtrl );
+    auto adaptiveCounts =
+      SpectralWindow
+      ( A, adaptiveMap, center, realWidth, imagWidth, realSize, imagSize,
+        adaptiveCtrl );
+    // Every process makes the same refinement decisions, so the comparison
+    // may be made redundantly
+    DistMatrix<Real,STAR,STAR> uniformMap_STAR_STAR( uniformMap ),
+                               adaptiveMap_STAR_STAR( adaptiveMap );
+    DistMatrix<Int,STAR,STAR> uniformCounts_STAR_STAR( uniformCounts ),
+                              adaptiveCounts_STAR_STAR( adaptiveCounts );
+    CompareWindows
+    ( uniformMap_STAR_STAR.Matrix(), uniformCounts_STAR_STAR.Matrix(),
+      adaptiveMap_STAR_STAR.Matrix(), adaptiveCounts_STAR_STAR.Matrix(),
+      epsilons, g.Rank() == 0 );
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of Grcar matrix",20);
+        const Int realSize = Input("--realSize","number of x samples",64);
+        const Int imagSize = Input("--imagSize","number of y samples",96);
+        const Int coarseSpacing =
+          Input("--coarseSpacing","initial adaptive spacing",8);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestPseudospectra<double>( g, n, realSize, imagSize, coarseSpacing );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
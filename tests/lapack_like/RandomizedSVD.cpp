@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestRandomizedSVD
+( const Grid& g, Int m, Int n, Int rank, SketchType sketch )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<F>()," and sketch ",Int(sketch));
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form an exactly rank-deficient A = X Y^H
+    DistMatrix<F> X(g), Y(g), A(g);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, A );
+    const Real frobA = FrobeniusNorm( A );
+
+    // A fixed-rank approximation should be exact up to round-off
+    RandomizedSVDCtrl<Real> ctrl;
+    ctrl.rank = rank;
+    ctrl.sketch = sketch;
+    DistMatrix<F> U(g), V(g), E(A);
+    DistMatrix<Real,VR,STAR> s(g);
+    RandomizedSVD( A, U, s, V, ctrl );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(-1), U, V, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / frobA;
+    OutputFromRoot(g.Comm(),"|| A - U S V' ||_F / || A ||_F = ",relError);
+    if( relError > 100*Max(m,n)*eps )
+        LogicError("Unacceptably large fixed-rank error");
+
+    // Starting from a rank of one, the adaptive variant should discover the
+    // numerical rank
+    ctrl.rank = 1;
+    ctrl.adaptive = true;
+    ctrl.relative = true;
+    ctrl.tol = Sqrt(eps);
+    RandomizedSVD( A, U, s, V, ctrl );
+    OutputFromRoot(g.Comm(),"Adaptive rank: ",ZeroNorm(s));
+    if( U.Width() < rank )
+        LogicError("Adaptive variant underestimated the rank");
+
+    // Randomized SVT, warm-started from the previous basis, should agree
+    // with the dense SVT
+    const Real tau = frobA / (2*rank);
+    DistMatrix<F,STAR,STAR> B(A);
+    DistMatrix<F> BRand(A), UBasis(U);
+    const Int denseRank = SVT( B.Matrix(), tau );
+    const Int randRank = svt::Randomized( BRand, tau, UBasis, ctrl );
+    DistMatrix<F,STAR,STAR> BRand_STAR_STAR(BRand);
+    BRand_STAR_STAR.Matrix() -= B.Matrix();
+    const Real svtError = FrobeniusNorm( BRand_STAR_STAR.Matrix() ) / frobA;
+    OutputFromRoot
+    (g.Comm(),"SVT ranks: ",denseRank," and ",randRank,", error ",svtError);
+    if( denseRank != randRank || svtError > Sqrt(eps) )
+        LogicError("Randomized SVT disagreed with the dense SVT");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",80);
+        const Int rank = Input("--rank","rank of matrix",7);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const SketchType sketches[] = { GAUSSIAN_SKETCH, SRHT_SKETCH };
+        for( const SketchType sketch : sketches )
+        {
+            TestRandomizedSVD<float>( g, m, n, rank, sketch );
+            TestRandomizedSVD<Complex<float>>( g, m, n, rank, sketch );
+            TestRandomizedSVD<double>( g, m, n, rank, sketch );
+            TestRandomizedSVD<Complex<double>>( g, m, n, rank, sketch );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// | A  C |, with the spectra of A and B in the right half-plane, as in the
+// | 0 -B |  solution of the Sylvester equation A X + X B = C
+template<typename F,class MatType>
+void SylvesterMatrix( MatType& S, Int m, Int n )
+{
+    Zeros( S, m+n, m+n );
+    auto A = S( IR(0,m), IR(0,m) );
+    auto B = S( IR(m,m+n), IR(m,m+n) );
+    auto C = S( IR(0,m), IR(m,m+n) );
+    MakeUniform( A );
+    ShiftDiagonal( A, F(m) );
+    MakeUniform( B );
+    ShiftDiagonal( B, F(n) );
+    B *= -1;
+    MakeUniform( C );
+}
+
+// | A    K  |, with K and L Hermitian, as in the solution of the Riccati
+// | L  -A^H |  equation X K X - A^H X - X A - L = 0
+template<typename F,class MatType>
+void RiccatiMatrix( MatType& H, Int n )
+{
+    Zeros( H, 2*n, 2*n );
+    auto A = H( IR(0,n), IR(0,n) );
+    auto K = H( IR(0,n), IR(n,2*n) );
+    auto L = H( IR(n,2*n), IR(0,n) );
+    auto AAdj = H( IR(n,2*n), IR(n,2*n) );
+    MakeUniform( A );
+    ShiftDiagonal( A, F(n) );
+    Adjoint( A, AAdj );
+    AAdj *= -1;
+
+    MatType W(H);
+    Uniform( W, n, n );
+    Herk( LOWER, NORMAL, Base<F>(1)/n, W, Base<F>(0), K );
+    MakeHermitian( LOWER, K );
+    Uniform( W, n, n );
+    Herk( LOWER, NORMAL, Base<F>(1)/n, W, Base<F>(0), L );
+    MakeHermitian( LOWER, L );
+}
+
+template<typename F,class MatType>
+void CheckSign
+( const MatType& S, const MatType& SRef, const string& msg, bool print )
+{
+    typedef Base<F> Real;
+    MatType E( S );
+    E -= SRef;
+    const Real relDiff = FrobeniusNorm(E) / FrobeniusNorm(SRef);
+    if( print )
+        Output(msg,": || S - SRef ||_F / || SRef ||_F = ",relDiff);
+    if( !(relDiff <= Pow(limits::Epsilon<Real>(),Real(0.5))) )
+        LogicError(msg," did not match the unstructured sign");
+}
+
+// Compare the structured variants, with and without the Newton-Schulz
+// switchover, against the unstructured Newton iteration
+template<typename F,class MatType>
+void TestStructuredSigns( MatType& S, MatType& H, Int n, bool print )
+{
+    SignCtrl<Base<F>> newtonCtrl, schulzCtrl;
+    schulzCtrl.newtonSchulz = true;
+
+    SylvesterMatrix<F>( S, n, n/2 );
+    MatType SRef( S );
+    Sign( SRef, newtonCtrl );
+    MatType SSign( S );
+    Sign( SSign, schulzCtrl );
+    CheckSign<F>( SSign, SRef, "Sylvester Newton-Schulz", print );
+    for( const auto& ctrl : { newtonCtrl, schulzCtrl } )
+    {
+        const string suffix = ( ctrl.newtonSchulz ? " Newton-Schulz" : "" );
+        MatType SStruct( S );
+        BlockTriangularSign( n, SStruct, ctrl );
+        CheckSign<F>( SStruct, SRef, "Block-triangular"+suffix, print );
+    }
+
+    RiccatiMatrix<F>( H, n );
+    MatType HRef( H );
+    Sign( HRef, newtonCtrl );
+    MatType HSign( H );
+    Sign( HSign, schulzCtrl );
+    CheckSign<F>( HSign, HRef, "Riccati Newton-Schulz", print );
+    for( const auto& ctrl : { newtonCtrl, schulzCtrl } )
+    {
+        const string suffix = ( ctrl.newtonSchulz ? " Newton-Schulz" : "" );
+        MatType HStruct( H );
+        HamiltonianSign( HStruct, ctrl );
+        CheckSign<F>( HStruct, HRef, "Hamiltonian"+suffix, print );
+    }
+}
+
+template<typename F>
+void TestSign( const Grid& g, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    if( g.Rank() == 0 )
+    {
+        Output("Sequential:");
+        PushIndent();
+        Matrix<F> S, H;
+        TestStructuredSigns<F>( S, H, n, true );
+        PopIndent();
+    }
+
+    OutputFromRoot(g.Comm(),"Distributed:");
+    PushIndent();
+    DistMatrix<F> S(g), H(g);
+    TestStructuredSigns<F>( S, H, n, g.Rank() == 0 );
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of the diagonal blocks",40);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSign<double>( g, n );
+        TestSign<Complex<double>>( g, n );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
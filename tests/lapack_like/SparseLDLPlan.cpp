@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Plan>
+void CheckNumAnalyses( const Plan& plan, Int numAnalyses, const string& msg )
+{
+    if( plan.NumAnalyses() != numAnalyses )
+        LogicError
+        (msg,": expected ",numAnalyses," analyses but found ",
+         plan.NumAnalyses());
+}
+
+template<typename F>
+void CheckSolve
+( const SparseMatrix<F>& A, const ldl::FactorizationPlan<F>& plan,
+  const string& msg )
+{
+    typedef Base<F> Real;
+    Matrix<F> B, X;
+    Uniform( B, A.Height(), 2 );
+    X = B;
+    ldl::SolveAfter( plan.invMap, plan.info, plan.front, X );
+    Multiply( NORMAL, F(-1), A, X, F(1), B );
+    const Real relResid = FrobeniusNorm(B) / FrobeniusNorm(X);
+    if( !(relResid <= Sqrt(limits::Epsilon<Real>())) )
+        LogicError(msg,": relative residual was ",relResid);
+}
+
+template<typename F>
+void CheckSolve
+( const DistSparseMatrix<F>& A, const ldl::DistFactorizationPlan<F>& plan,
+  const string& msg )
+{
+    typedef Base<F> Real;
+    DistMultiVec<F> B(A.Comm()), X(A.Comm());
+    Uniform( B, A.Height(), 2 );
+    X = B;
+    ldl::SolveAfter( plan.invMap, plan.info, plan.front, X );
+    Multiply( NORMAL, F(-1), A, X, F(1), B );
+    const Real relResid = FrobeniusNorm(B) / FrobeniusNorm(X);
+    if( !(relResid <= Sqrt(limits::Epsilon<Real>())) )
+        LogicError(msg,": relative residual was ",relResid);
+}
+
+// Refactor a sequence of matrices and check that the analysis is only
+// recomputed when the sparsity pattern or the bisection control changes
+template<typename F,class SparseMat,class Plan>
+void TestPlan( SparseMat& A, Plan& plan, Int n )
+{
+    BisectCtrl ctrl;
+    ctrl.cutoff = 16;
+
+    Laplacian( A, n, n, n );
+    plan.Factor( A, LDL_2D, false, ctrl );
+    CheckNumAnalyses( plan, 1, "Initial factorization" );
+    CheckSolve( A, plan, "Initial factorization" );
+
+    // Only the values change
+    A *= F(-2);
+    plan.Factor( A, LDL_2D, false, ctrl );
+    CheckNumAnalyses( plan, 1, "Refactorization" );
+    CheckSolve( A, plan, "Refactorization" );
+
+    // The separator control changes
+    ctrl.cutoff = 32;
+    plan.Factor( A, LDL_2D, false, ctrl );
+    CheckNumAnalyses( plan, 2, "Changed bisection control" );
+    CheckSolve( A, plan, "Changed bisection control" );
+
+    // The sparsity pattern changes
+    Laplacian( A, n+1, n, n );
+    plan.Factor( A, LDL_2D, false, ctrl );
+    CheckNumAnalyses( plan, 3, "Changed sparsity pattern" );
+    CheckSolve( A, plan, "Changed sparsity pattern" );
+
+    // The analysis is explicitly discarded
+    plan.Reset();
+    plan.Factor( A, LDL_2D, false, ctrl );
+    CheckNumAnalyses( plan, 4, "Reset" );
+    CheckSolve( A, plan, "Reset" );
+}
+
+template<typename F>
+void TestFactorizationPlans( mpi::Comm comm, Int n )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<F>());
+    if( mpi::Rank(comm) == 0 )
+    {
+        SparseMatrix<F> A;
+        ldl::FactorizationPlan<F> plan;
+        TestPlan<F>( A, plan, n );
+    }
+    DistSparseMatrix<F> A(comm);
+    ldl::DistFactorizationPlan<F> plan;
+    TestPlan<F>( A, plan, n );
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","grid dimension of the Laplacian",12);
+        ProcessInput();
+        PrintInputReport();
+
+        TestFactorizationPlans<double>( comm, n );
+        TestFactorizationPlans<Complex<double>>( comm, n );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
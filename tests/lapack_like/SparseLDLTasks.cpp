@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Recompute the subtree flop estimates which were cached by the analysis
+double CheckSubtreeGFlops( const ldl::NodeInfo& info )
+{
+    double gflops = 0;
+    for( const ldl::NodeInfo* child : info.children )
+        gflops += CheckSubtreeGFlops( *child );
+    const double n = info.size;
+    const double u = info.lowerStruct.size();
+    gflops += ((1./3.)*n*n*n + n*n*u + n*u*u)/1.e9;
+    if( Abs(gflops-info.subtreeGFlops) > 1e-10*gflops )
+        LogicError
+        ("Cached subtree GFlops of ",info.subtreeGFlops," did not match ",
+         gflops);
+    return gflops;
+}
+
+template<typename F>
+void Solve
+( const SparseMatrix<F>& A, const Matrix<F>& B, Matrix<F>& X,
+  const string& msg )
+{
+    typedef Base<F> Real;
+    X = B;
+    SymmetricSolve( A, X );
+
+    Matrix<F> R( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    const Real eps = limits::Epsilon<Real>();
+    const Real relResid =
+      FrobeniusNorm(R) / (FrobeniusNorm(A)*FrobeniusNorm(X)*eps);
+    Output(msg,": ||B - A X||_F / (||A||_F ||X||_F eps) = ",relResid);
+    if( !(relResid <= Real(10*A.Height())) )
+        LogicError(msg," produced an unacceptably large residual");
+}
+
+template<typename F>
+void TestSparseLDLTasks( Int n1, Int n2, Int n3, Int numRHS )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    SparseMatrix<F> A;
+    Laplacian( A, n1, n2, n3 );
+    Matrix<F> B;
+    Uniform( B, A.Height(), numRHS );
+
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    vector<Int> map;
+    ldl::NestedDissection( A.LockedGraph(), map, rootSep, info );
+    CheckSubtreeGFlops( info );
+
+    const double gflopCutoff = ldl::SubtreeTaskGFlopCutoff();
+    const double memoryLimit = ldl::SubtreeTaskMemoryLimit();
+
+    // Never factor the subtrees as tasks
+    Matrix<F> XSerial;
+    ldl::SetSubtreeTaskGFlopCutoff( 1e300 );
+    Solve( A, B, XSerial, "Serial subtrees" );
+
+    // Factor every pair of sibling subtrees as tasks (which is a no-op for
+    // types which are not thread-safe)
+    Matrix<F> XTasks;
+    ldl::SetSubtreeTaskGFlopCutoff( 0 );
+    ldl::SetSubtreeTaskMemoryLimit( 1e300 );
+    Solve( A, B, XTasks, "Subtree tasks" );
+
+    ldl::SetSubtreeTaskGFlopCutoff( gflopCutoff );
+    ldl::SetSubtreeTaskMemoryLimit( memoryLimit );
+
+    XTasks -= XSerial;
+    const Real relDiff = FrobeniusNorm(XTasks) / FrobeniusNorm(XSerial);
+    Output("|| XTasks - XSerial ||_F / || XSerial ||_F = ",relDiff);
+    if( !(relDiff <= Real(10*A.Height())*limits::Epsilon<Real>()) )
+        LogicError("Task-based factorization did not match serial one");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+#ifdef EL_HAVE_MPC
+        const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
+#endif
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MPC
+        mpfr::SetPrecision( prec );
+#endif
+
+        // The sequential factorization only needs to be tested by one process
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSparseLDLTasks<double>( n1, n2, n3, numRHS );
+            TestSparseLDLTasks<Complex<double>>( n1, n2, n3, numRHS );
+#ifdef EL_HAVE_MPC
+            // Fronts formed within worker threads would only be accurate to
+            // double-precision
+            TestSparseLDLTasks<BigFloat>( n1/2, n2/2, n3/2, numRHS );
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
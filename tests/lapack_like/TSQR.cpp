@@ -62,6 +62,7 @@ void TestQR
   bool correctness,
   bool print )
 {
+    typedef Base<F> Real;
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
     PushIndent();
 
@@ -91,7 +92,25 @@ void TestQR
         Print( R, "R" );
     }
     if( correctness )
+    {
+        // Ensure that applying the implicit Q^H to A yields R
+        OutputFromRoot(g.Comm(),"Testing implicit application of Q^H...");
+        PushIndent();
+        auto treeData = qr::TS( A );
+        DistMatrix<F,STAR,STAR> QAdjA(g);
+        qr::ts::ApplyQAdjoint( A, treeData, A, QAdjA );
+        QAdjA -= R;
+        const Real eps = limits::Epsilon<Real>();
+        const Real relError =
+          FrobeniusNorm( QAdjA ) / (eps*Max(m,n)*FrobeniusNorm(A));
+        OutputFromRoot
+        (g.Comm(),"||Q^H A - R||_F / (eps Max(m,n) ||A||_F) = ",relError);
+        PopIndent();
+        if( relError > Real(10) )
+            LogicError("Unacceptably large implicit Q^H error");
+
         TestCorrectness( AFact, R, A );
+    }
     PopIndent();
 }
 
@@ -110,6 +129,10 @@ main( int argc, char* argv[] )
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
+        const Int tree =
+          Input("--tree","reduction tree: 0) binary, 1) flat, 2) hybrid",0);
+        const Int nodeSize =
+          Input("--nodeSize","ranks per node for hybrid trees (0=detect)",0);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -123,6 +146,8 @@ main( int argc, char* argv[] )
         const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
         const Grid g( comm, order );
         SetBlocksize( nb );
+        qr::ts::SetTree( static_cast<TSQRTree>(tree) );
+        qr::ts::SetNodeSize( nodeSize );
         ComplainIfDebug();
         OutputFromRoot(comm,"Will test TSQR");
 
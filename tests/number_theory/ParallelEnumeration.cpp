@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+Real Enumerate
+( const Matrix<Real>& d, const Matrix<Real>& N, const Matrix<Real>& u,
+  Int numThreads, Int parallelDepth, mpi::Comm comm, const string& msg )
+{
+#ifdef EL_HYBRID
+    const int maxThreads = omp_get_max_threads();
+    omp_set_num_threads( numThreads );
+#endif
+    EnumCtrl<Real> ctrl;
+    ctrl.enumType = FULL_ENUM;
+    ctrl.parallel = true;
+    ctrl.parallelDepth = parallelDepth;
+    ctrl.parallelComm = comm;
+    Matrix<Real> v;
+    const Real norm = svp::ParallelEnumeration( d, N, u, v, ctrl );
+#ifdef EL_HYBRID
+    omp_set_num_threads( maxThreads );
+#endif
+
+    if( !(norm < u(u.Height()-1)) )
+        LogicError(msg,": no lattice member was found");
+    if( MaxNorm(v) == Real(0) )
+        LogicError(msg,": the zero vector was returned");
+    const Real vNorm = svp::CoordinatesToNorm( d, N, v );
+    if( Abs(vNorm-norm) > 10*limits::Epsilon<Real>()*norm )
+        LogicError
+        (msg,": returned norm of ",norm," but the vector had norm ",vNorm);
+    OutputFromRoot(mpi::COMM_WORLD,msg,": shortest norm was ",norm);
+    return norm;
+}
+
+// Every combination of threads and processes must find the same shortest
+// norm (the vectors may differ when several have the minimal norm)
+template<typename Real>
+void TestParallelEnumeration( mpi::Comm comm, Int n, Real radius )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<Real>());
+    PushIndent();
+
+    // Every process forms the same basis
+    Matrix<Real> B;
+    if( mpi::Rank(comm) == 0 )
+        KnapsackTypeBasis( B, n, radius );
+    else
+        B.Resize( n+1, n );
+    mpi::Broadcast( B.Buffer(), B.Height()*B.Width(), 0, comm );
+
+    Matrix<Real> R;
+    LLL( B, R );
+    auto d = GetRealPartOfDiagonal( R );
+    auto N( R );
+    auto NT = N( IR(0,n), ALL );
+    DiagonalSolve( LEFT, NORMAL, d, NT );
+
+    // The search is bounded by a slight enlargement of || b_0 ||_2
+    const Real b0Norm = FrobeniusNorm( B(ALL,IR(0)) );
+    Matrix<Real> u;
+    Ones( u, n, 1 );
+    u *= b0Norm*(1+Sqrt(limits::Epsilon<Real>()));
+
+    const Real tol = 10*limits::Epsilon<Real>()*b0Norm;
+    const Real serialNorm =
+      Enumerate( d, N, u, 1, 0, mpi::COMM_SELF, "One thread" );
+    const Int maxThreads =
+#ifdef EL_HYBRID
+      omp_get_max_threads();
+#else
+      1;
+#endif
+    const Real threadedNorm =
+      Enumerate( d, N, u, maxThreads, 0, mpi::COMM_SELF, "All threads" );
+    const Real splitNorm =
+      Enumerate( d, N, u, maxThreads, 3, mpi::COMM_SELF, "Depth 3 split" );
+    const Real distNorm =
+      Enumerate( d, N, u, maxThreads, 0, comm, "All processes" );
+    if( Abs(threadedNorm-serialNorm) > tol ||
+        Abs(splitNorm-serialNorm) > tol ||
+        Abs(distNorm-serialNorm) > tol )
+        LogicError("The parallel enumerations disagreed");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","lattice dimension",24);
+        const double radius = Input("--radius","knapsack radius",1e6);
+        ProcessInput();
+        PrintInputReport();
+
+        TestParallelEnumeration<double>( comm, n, radius );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
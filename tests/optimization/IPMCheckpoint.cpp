@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve a random, feasible LP in 'direct' conic form after interrupting the
+// IPM and resuming it from its last checkpoint
+template<typename Real>
+void TestCheckpoint
+( const Grid& grid, Int m, Int n, Int interruptIts, const string basename )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Real>());
+
+    // Form b = A x0 and c = A^T y0 + z0 with x0, z0 > 0 so that the primal and
+    // dual problems are feasible
+    DistMatrix<Real> A(grid), b(grid), c(grid), x0(grid), y0(grid), z0(grid);
+    Gaussian( A, m, n );
+    Uniform( x0, n, 1, Real(1), Real(1)/Real(2) );
+    Gaussian( y0, m, 1 );
+    Uniform( z0, n, 1, Real(1), Real(1)/Real(2) );
+    Zeros( b, m, 1 );
+    Gemv( NORMAL, Real(1), A, x0, Real(0), b );
+    c = z0;
+    Gemv( TRANSPOSE, Real(1), A, y0, Real(1), c );
+
+    lp::direct::Ctrl<Real> ctrl(false);
+    DistMatrix<Real> x(grid), y(grid), z(grid);
+    LP( A, b, c, x, y, z, ctrl );
+    const Real objective = Dot( c, x );
+
+    // Interrupt the solve, which checkpoints every iteration, by limiting the
+    // number of iterations
+    ctrl.mehrotraCtrl.maxIts = interruptIts;
+    ctrl.mehrotraCtrl.checkpoint.frequency = 1;
+    ctrl.mehrotraCtrl.checkpoint.basename = basename;
+    bool interrupted = false;
+    try { LP( A, b, c, x, y, z, ctrl ); }
+    catch( std::exception& ) { interrupted = true; }
+    if( !interrupted )
+        LogicError("The IPM converged in fewer than ",interruptIts," its.");
+
+    DistMatrix<Real> xSaved(grid), ySaved(grid), zSaved(grid);
+    const Int numSavedIts =
+      ipm::ReadCheckpoint( basename, xSaved, ySaved, zSaved );
+    if( numSavedIts != interruptIts )
+        LogicError
+        ("Checkpoint was from iteration ",numSavedIts," rather than ",
+         interruptIts);
+
+    ctrl.mehrotraCtrl.maxIts = 1000;
+    ctrl.mehrotraCtrl.checkpoint.frequency = 0;
+    ctrl.mehrotraCtrl.checkpoint.resume = true;
+    LP( A, b, c, x, y, z, ctrl );
+    const Real resumedObjective = Dot( c, x );
+    const Real objectiveError =
+      Abs(objective-resumedObjective) / (1+Abs(objective));
+    OutputFromRoot
+    (grid.Comm(),"  original objective: ",objective,"\n",
+     "  resumed objective:  ",resumedObjective);
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.3));
+    if( objectiveError > tol )
+        LogicError("Relative objective error was ",objectiveError);
+    OutputFromRoot(grid.Comm(),"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of A",50);
+        const Int n = Input("--n","width of A",100);
+        const Int interruptIts =
+          Input("--interruptIts","iteration to interrupt the IPM at",3);
+        const string basename =
+          Input("--basename","basename of checkpoint files","IPM-test");
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestCheckpoint<double>( grid, m, n, interruptIts, basename );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}